@@ -1,28 +1,43 @@
 #include "AIStoryteller.h"
+#include "GameSession.h"
 #include "Player.h"
-#include <cstdlib>
-#include <ctime>
 #include <iostream>
 
-AIStoryteller* AIStoryteller::instance = nullptr;
-
 AIStoryteller::AIStoryteller() 
 	: gameTimeSeconds(0), totalMoves(0), playerHealthRatio(1.0f), 
 	  playerLevel(1), difficultyMultiplier(1.0f), tensionLevel(0.0f),
-	  movesSinceLastEvent(0), eventCooldown(0), clueSpawnCooldown(0) {
-	srand(static_cast<unsigned int>(time(0)));
+	  movesSinceLastEvent(0), eventCooldown(0), clueSpawnCooldown(0), rng(&defaultRng),
+	  output(&std::cout), silentOutput(nullptr) {
 }
 
 AIStoryteller* AIStoryteller::getInstance() {
-	if (!instance) {
-		instance = new AIStoryteller();
-	}
-	return instance;
+	return &GameSession::getDefault()->getStoryteller();
+}
+
+void AIStoryteller::setRandomStreams(RandomStreams* streams) {
+	rng = streams != nullptr ? streams : &defaultRng;
+}
+
+void AIStoryteller::setOutput(std::ostream* stream) {
+	output = stream != nullptr ? stream : &silentOutput;
+}
+
+void AIStoryteller::reset() {
+	gameTimeSeconds = 0;
+	totalMoves = 0;
+	playerHealthRatio = 1.0f;
+	playerLevel = 1;
+	difficultyMultiplier = 1.0f;
+	tensionLevel = 0.0f;
+	movesSinceLastEvent = 0;
+	eventCooldown = 0;
+	spawnedClueIDs.clear();
+	availableClueIDs.clear();
+	clueSpawnCooldown = 0;
 }
 
 void AIStoryteller::destroyInstance() {
-	delete instance;
-	instance = nullptr;
+	GameSession::getDefault()->getStoryteller().reset();
 }
 
 void AIStoryteller::update(Player* player, int moves) {
@@ -73,7 +88,7 @@ void AIStoryteller::updateDifficulty() {
 	
 	if (playerHealthRatio < 0.3f) {
 		difficultyMultiplier *= 0.6f;
-		std::cout << "\n  [AI STORYTELLER] Player struggling - reducing difficulty\n";
+		out() << "\n  [AI STORYTELLER] Player struggling - reducing difficulty\n";
 	}
 	else if (playerHealthRatio < 0.5f) {
 		difficultyMultiplier *= 0.8f;
@@ -95,20 +110,20 @@ bool AIStoryteller::shouldSpawnZombie() {
 	// High HP players face more combat
 	if (playerHealthRatio > 0.7f) {
 		baseChance += 15;  // 30% when healthy
-		std::cout << "  [AI] High HP detected - increasing zombie spawn chance to " << baseChance << "%\n";
+		out() << "  [AI] High HP detected - increasing zombie spawn chance to " << baseChance << "%\n";
 	}
 	else if (playerHealthRatio < 0.3f) {
 		baseChance -= 10;  // 5% when critical
-		std::cout << "  [AI] Low HP detected - reducing zombie spawn chance to " << baseChance << "%\n";
+		out() << "  [AI] Low HP detected - reducing zombie spawn chance to " << baseChance << "%\n";
 	}
 
 	// More combat in late game
 	if (gameTimeSeconds > 300) {
 		baseChance += 10;
-		std::cout << "  [AI] Late game detected - increasing difficulty\n";
+		out() << "  [AI] Late game detected - increasing difficulty\n";
 	}
 
-	return (rand() % 100) < baseChance;
+	return rng->events().rollPercent(baseChance);
 }
 
 bool AIStoryteller::shouldSpawnLoot() {
@@ -118,13 +133,13 @@ bool AIStoryteller::shouldSpawnLoot() {
 	// Low HP players find more loot
 	if (playerHealthRatio < 0.3f) {
 		baseChance += 25;  // 70% when critical
-		std::cout << "  [AI] Increasing loot chance (low HP)\n";
+		out() << "  [AI] Increasing loot chance (low HP)\n";
 	}
 	else if (playerHealthRatio < 0.5f) {
 		baseChance += 15;  // 60% when hurt
 	}
 	
-	return (rand() % 100) < baseChance;
+	return rng->loot().rollPercent(baseChance);
 }
 
 bool AIStoryteller::shouldSpawnClue() {
@@ -136,20 +151,20 @@ bool AIStoryteller::shouldSpawnClue() {
 	// Increase chance if player hasn't found clues in a while
 	if (totalMoves > 20 && spawnedClueIDs.size() < availableClueIDs.size()) {
 		baseChance += 20;  // +20% boost (was +15%)
-		std::cout << "  [AI] Boosting clue chance - you haven't found many yet!\n";
+		out() << "  [AI] Boosting clue chance - you haven't found many yet!\n";
 	}
 
 	// Ensure all clues eventually spawn
 	if (spawnedClueIDs.size() < availableClueIDs.size()) {
 		// Guarantee spawn after many moves
-		if (totalMoves > 30 && (rand() % 100) < 70) {  // Earlier guarantee (was 50 moves, 60%)
+		if (totalMoves > 30 && rng->events().rollPercent(70)) {  // Earlier guarantee (was 50 moves, 60%)
 			clueSpawnCooldown = 5;  // Shorter cooldown (was 10)
-			std::cout << "  [AI] Guaranteeing clue spawn - ensuring story completion!\n";
+			out() << "  [AI] Guaranteeing clue spawn - ensuring story completion!\n";
 			return true;
 		}
 	}
 
-	if ((rand() % 100) < baseChance) {
+	if (rng->events().rollPercent(baseChance)) {
 		clueSpawnCooldown = 5;  // Shorter cooldown (was 10)
 		return true;
 	}
@@ -164,26 +179,26 @@ bool AIStoryteller::shouldSpawnClue() {
 int AIStoryteller::getZombieWaveCount() {
 	// High HP: More waves
 	if (playerHealthRatio > 0.7f) {
-		int waves = 2 + (rand() % 2);  // 2-3 waves
-		std::cout << "  [AI] High HP - spawning " << waves << " waves\n";
+		int waves = rng->combat().nextRange(2, 3);  // 2-3 waves
+		out() << "  [AI] High HP - spawning " << waves << " waves\n";
 		return waves;
 	}
 	// Low HP: Fewer waves
 	else if (playerHealthRatio < 0.3f) {
-		std::cout << "  [AI] Low HP - spawning only 1 wave (mercy)\n";
+		out() << "  [AI] Low HP - spawning only 1 wave (mercy)\n";
 		return 1;  // Just 1 wave
 	}
 	// Medium HP: Normal
-	int waves = 1 + (rand() % 2);  // 1-2 waves
+	int waves = rng->combat().nextRange(1, 2);  // 1-2 waves
 	return waves;
 }
 
 std::string AIStoryteller::getZombieType() {
 	// High HP (>70%): Tougher zombies
 	if (playerHealthRatio > 0.7f) {
-		int type = rand() % 100;
+		int type = rng->combat().nextInt(100);
 		if (type < 30) {
-			std::cout << "  [AI] Spawning Tank (you're doing well!)\n";
+			out() << "  [AI] Spawning Tank (you're doing well!)\n";
 			return "Tank";      // 30% Tank
 		}
 		if (type < 55) return "Smoker";    // 25% Smoker
@@ -192,9 +207,9 @@ std::string AIStoryteller::getZombieType() {
 	}
 	// Low HP (<30%): Easier zombies
 	else if (playerHealthRatio < 0.3f) {
-		int type = rand() % 100;
+		int type = rng->combat().nextInt(100);
 		if (type < 50) {
-			std::cout << "  [AI] Spawning weaker zombies (you need a break)\n";
+			out() << "  [AI] Spawning weaker zombies (you need a break)\n";
 			return "Boomer";    // 50% Boomer (easiest)
 		}
 		if (type < 80) return "Spitter";   // 30% Spitter
@@ -202,7 +217,7 @@ std::string AIStoryteller::getZombieType() {
 	}
 	// Medium HP: Mixed
 	else {
-		int type = rand() % 100;
+		int type = rng->combat().nextInt(100);
 		if (type < 40) return "Boomer";
 		if (type < 65) return "Spitter";
 		if (type < 85) return "Smoker";
@@ -215,7 +230,7 @@ std::string AIStoryteller::getZombieType() {
 // ============================================================================
 
 std::string AIStoryteller::generateRandomLoot() {
-	int lootType = rand() % 100;
+	int lootType = rng->loot().nextInt(100);
 	
 	// Low HP: More medical items
 	if (playerHealthRatio < 0.5f) {
@@ -236,9 +251,9 @@ std::string AIStoryteller::generateRandomLoot() {
 int AIStoryteller::getLootQuantity() {
 	// Low HP: More loot
 	if (playerHealthRatio < 0.3f) {
-		return 2 + (rand() % 2);  // 2-3 items
+		return rng->loot().nextRange(2, 3);  // 2-3 items
 	}
-	return 1 + (rand() % 2);  // 1-2 items
+	return rng->loot().nextRange(1, 2);  // 1-2 items
 }
 
 // ============================================================================
@@ -266,10 +281,10 @@ int AIStoryteller::generateRandomClue() {
 	}
 	
 	// Pick random unspawned clue
-	int clueID = unspawnedClues[rand() % unspawnedClues.size()];
+	int clueID = unspawnedClues[rng->events().nextInt(static_cast<int>(unspawnedClues.size()))];
 	spawnedClueIDs.push_back(clueID);
 	
-	std::cout << "  [AI] Spawning random clue encounter!\n";
+	out() << "  [AI] Spawning random clue encounter!\n";
 	return clueID;
 }
 
@@ -280,7 +295,7 @@ int AIStoryteller::generateRandomClue() {
 int AIStoryteller::adjustZombieCount(int baseCount) {
 	if (playerHealthRatio < 0.3f) {
 		baseCount -= 2;
-		std::cout << "  [AI] Reducing zombie count (low HP)\n";
+		out() << "  [AI] Reducing zombie count (low HP)\n";
 	}
 	else if (playerHealthRatio < 0.5f) {
 		baseCount -= 1;
@@ -288,14 +303,14 @@ int AIStoryteller::adjustZombieCount(int baseCount) {
 	
 	if (gameTimeSeconds > 600) {
 		baseCount += 2;
-		std::cout << "  [AI] Increasing zombie count (late game)\n";
+		out() << "  [AI] Increasing zombie count (late game)\n";
 	}
 	else if (gameTimeSeconds > 300) {
 		baseCount += 1;
 	}
 	
-	if (baseCount < 2) baseCount = 2;
-	if (baseCount > 8) baseCount = 8;
+	if (baseCount < MIN_ZOMBIE_COUNT) baseCount = MIN_ZOMBIE_COUNT;
+	if (baseCount > MAX_ZOMBIE_COUNT) baseCount = MAX_ZOMBIE_COUNT;
 	
 	return baseCount;
 }
@@ -306,7 +321,7 @@ float AIStoryteller::getZombieDifficultyModifier() {
 
 bool AIStoryteller::shouldSpawnSpecialZombie() {
 	int chance = static_cast<int>(tensionLevel * 30) + (gameTimeSeconds / 60);
-	return (rand() % 100) < chance;
+	return rng->combat().rollPercent(chance);
 }
 
 // ============================================================================
@@ -315,7 +330,7 @@ bool AIStoryteller::shouldSpawnSpecialZombie() {
 
 float AIStoryteller::getLootQualityModifier() {
 	if (playerHealthRatio < 0.3f) {
-		std::cout << "  [AI] Improving loot quality (low HP)\n";
+		out() << "  [AI] Improving loot quality (low HP)\n";
 		return 1.8f;
 	}
 	else if (playerHealthRatio < 0.5f) {
@@ -344,8 +359,8 @@ int AIStoryteller::getBonusLootChance() {
 }
 
 bool AIStoryteller::shouldGrantBonusLoot() {
-	if (playerHealthRatio < 0.3f && (rand() % 100) < 40) {
-		std::cout << "  [AI] Granting bonus loot (struggling player)\n";
+	if (playerHealthRatio < 0.3f && rng->loot().rollPercent(40)) {
+		out() << "  [AI] Granting bonus loot (struggling player)\n";
 		return true;
 	}
 	return false;
@@ -369,7 +384,7 @@ bool AIStoryteller::shouldTriggerEvent() {
 		baseChance += 10;
 	}
 	
-	return (rand() % 100) < baseChance;
+	return rng->events().rollPercent(baseChance);
 }
 
 std::string AIStoryteller::generateRandomEvent() {
@@ -378,21 +393,21 @@ std::string AIStoryteller::generateRandomEvent() {
 
 	// Event selection based on player state
 	if (playerHealthRatio < 0.3f) {
-		int event = rand() % 4;  // Added STORY_CLUE option
+		int event = rng->events().nextInt(4);  // Added STORY_CLUE option
 		if (event == 0) return "SUPPLY_DROP";
 		if (event == 1) return "SAFE_ZONE";
 		if (event == 2) return "STORY_CLUE";  // NEW: Give struggling player story clues
 		return "MEDICAL_CACHE";
 	}
 	else if (tensionLevel > 0.7f) {
-		int event = rand() % 4;
+		int event = rng->events().nextInt(4);
 		if (event == 0) return "HORDE_INCOMING";
 		if (event == 1) return "ENVIRONMENTAL_HAZARD";
 		if (event == 2) return "TOXIC_FOG";
 		return "ELITE_ZOMBIE";
 	}
 	else {
-		int event = rand() % 7;  // Added STORY_CLUE option
+		int event = rng->events().nextInt(7);  // Added STORY_CLUE option
 		if (event == 0) return "SUPPLY_DROP";
 		if (event == 1) return "WANDERING_TRADER";
 		if (event == 2) return "ZOMBIE_PATROL";
@@ -404,62 +419,59 @@ std::string AIStoryteller::generateRandomEvent() {
 }
 
 void AIStoryteller::handleEvent(const std::string& eventType) {
-	std::cout << "\n" << std::string(60, '=') << "\n";
-	std::cout << "  [RANDOM EVENT] " << eventType << "\n";
-	std::cout << std::string(60, '=') << "\n\n";
+	out() << "\n" << std::string(60, '=') << "\n";
+	out() << "  [RANDOM EVENT] " << eventType << "\n";
+	out() << std::string(60, '=') << "\n\n";
 	
 	if (eventType == "SUPPLY_DROP") {
-		std::cout << "  A supply crate has been spotted nearby!\n";
-		std::cout << "  You find extra medical supplies and ammunition.\n";
+		out() << "  A supply crate has been spotted nearby!\n";
+		out() << "  You find extra medical supplies and ammunition.\n";
 	}
 	else if (eventType == "SAFE_ZONE") {
-		std::cout << "  You discover a fortified safe zone!\n";
-		std::cout << "  You can rest here safely.\n";
+		out() << "  You discover a fortified safe zone!\n";
+		out() << "  You can rest here safely.\n";
 	}
 	else if (eventType == "MEDICAL_CACHE") {
-		std::cout << "  You stumble upon an abandoned medical cache!\n";
-		std::cout << "  Bandages and medicine are yours for the taking.\n";
+		out() << "  You stumble upon an abandoned medical cache!\n";
+		out() << "  Bandages and medicine are yours for the taking.\n";
 	}
 	else if (eventType == "HORDE_INCOMING") {
-		std::cout << "  WARNING: A zombie horde is approaching!\n";
-		std::cout << "  Prepare for intense combat ahead.\n";
+		out() << "  WARNING: A zombie horde is approaching!\n";
+		out() << "  Prepare for intense combat ahead.\n";
 	}
 	else if (eventType == "ENVIRONMENTAL_HAZARD") {
-		std::cout << "  DANGER: The area is unstable!\n";
-		std::cout << "  Proceed with caution.\n";
+		out() << "  DANGER: The area is unstable!\n";
+		out() << "  Proceed with caution.\n";
 	}
 	else if (eventType == "TOXIC_FOG") {
-		std::cout << "  TOXIC FOG is rolling in!\n";
-		std::cout << "  The air becomes thick and dangerous.\n";
-		std::cout << "  You take 10 damage from the toxic fumes!\n";
+		out() << "  TOXIC FOG is rolling in!\n";
+		out() << "  The air becomes thick and dangerous.\n";
+		out() << "  You take 10 damage from the toxic fumes!\n";
 	}
 	else if (eventType == "ELITE_ZOMBIE") {
-		std::cout << "  A powerful elite zombie has appeared!\n";
-		std::cout << "  This will be a tough fight.\n";
+		out() << "  A powerful elite zombie has appeared!\n";
+		out() << "  This will be a tough fight.\n";
 	}
 	else if (eventType == "WANDERING_TRADER") {
-		std::cout << "  A mysterious trader offers supplies...\n";
-		std::cout << "  But at what cost?\n";
+		out() << "  A mysterious trader offers supplies...\n";
+		out() << "  But at what cost?\n";
 	}
 	else if (eventType == "ZOMBIE_PATROL") {
-		std::cout << "  You spot a zombie patrol in the distance.\n";
-		std::cout << "  You can avoid them or engage.\n";
+		out() << "  You spot a zombie patrol in the distance.\n";
+		out() << "  You can avoid them or engage.\n";
 	}
 	else if (eventType == "MYSTERIOUS_SOUND") {
-		std::cout << "  You hear strange sounds nearby...\n";
-		std::cout << "  Something is out there.\n";
+		out() << "  You hear strange sounds nearby...\n";
+		out() << "  Something is out there.\n";
 	}
 	else if (eventType == "ABANDONED_CAMP") {
-		std::cout << "  You find an abandoned survivor camp.\n";
-		std::cout << "  There might be useful supplies here.\n";
+		out() << "  You find an abandoned survivor camp.\n";
+		out() << "  There might be useful supplies here.\n";
 	}
 	else if (eventType == "STORY_CLUE") {
-		std::cout << "  You discover an important document!\n";
-		std::cout << "  This could shed light on what happened...\n";
+		out() << "  You discover an important document!\n";
+		out() << "  This could shed light on what happened...\n";
 	}
-
-	std::cout << "\n  Press ENTER to continue...";
-	std::cin.get();
 }
 
 std::string AIStoryteller::getStorytellerStatus() {
@@ -1,16 +1,16 @@
 #ifndef AISTORYTELLER_H
 #define AISTORYTELLER_H
 
+#include <ostream>
 #include <string>
 #include <vector>
+#include "Random.h"
 
 class Player;
 class Location;
 
 class AIStoryteller {
 private:
-	static AIStoryteller* instance;
-	
 	// Criteria 1: Time tracking
 	int gameTimeSeconds;
 	int totalMoves;
@@ -32,12 +32,29 @@ private:
 	std::vector<int> availableClueIDs;
 	int clueSpawnCooldown;
 	
-	AIStoryteller();
+	// Random streams (the session's, once injected)
+	RandomStreams defaultRng;
+	RandomStreams* rng;
+	
+	// Commentary output (silentOutput discards everything)
+	std::ostream* output;
+	std::ostream silentOutput;
 	
 	void calculateTension();
 	void updateDifficulty();
+	std::ostream& out() { return *output; }
 	
 public:
+	static const int MIN_ZOMBIE_COUNT = 2;
+	static const int MAX_ZOMBIE_COUNT = 8;
+	
+	// Constructor (each GameSession owns one; simulations own one per worker)
+	AIStoryteller();
+	
+	AIStoryteller(const AIStoryteller&) = delete;
+	AIStoryteller& operator=(const AIStoryteller&) = delete;
+	
+	// Compatibility shims: the default session's storyteller, and resetting it
 	static AIStoryteller* getInstance();
 	static void destroyInstance();
 	
@@ -45,6 +62,9 @@ public:
 	void update(Player* player, int moves);
 	void incrementTime(int seconds);
 	void initializeClues(const std::vector<int>& allClueIDs);
+	void setRandomStreams(RandomStreams* streams);  // nullptr restores the storyteller's own streams
+	void setOutput(std::ostream* stream);  // nullptr silences the [AI] commentary
+	void reset();  // Back to a fresh game's state (streams and output are kept)
 	
 	// NEW: Spawn decision methods (replace hardcoded percentages)
 	bool shouldSpawnZombie();
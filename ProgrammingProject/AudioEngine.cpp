@@ -1,6 +1,12 @@
 #include "AudioEngine.h"
+#include <windows.h>
+#include <dsound.h>
+#include <mmsystem.h>
 #include <iostream>
 #include <fstream>
+#pragma comment(lib, "dsound.lib")
+#pragma comment(lib, "dxguid.lib")
+#pragma comment(lib, "winmm.lib")
 
 // Initialize static member
 AudioEngine* AudioEngine::instance = nullptr;
@@ -587,64 +593,41 @@ void AudioEngine::playSaveGameSound() {
 // LOCATION-BASED MUSIC CONTROL
 // ============================================================================
 
-bool AudioEngine::playLocationMusic(const std::string& locationID) {
+bool AudioEngine::playLocationMusic(Symbol locationID) {
 	// Don't switch if in combat music
 	if (inCombatMusic) {
 		//std::cout << "[AUDIO] Combat music playing - location music will resume after combat\n";
 		return false;
 	}
 
-	std::string musicPath;
-
 	// Map location IDs to music files (10 locations with 10 unique soundtracks)
-	if (locationID == "loc_ruined_city") {
-		musicPath = "Audio\\Music\\ruined_city.wav";
-		// std::cout << "[AUDIO] Switching to Ruined City music\n";
-	}
-	else if (locationID == "loc_industrial") {
-		musicPath = "Audio\\Music\\industrial_district.wav";
-		// std::cout << "[AUDIO] Switching to Industrial District music\n";
-	}
-	else if (locationID == "loc_hollow_woods") {
-		musicPath = "Audio\\Music\\hollow_woods.wav";
-		// std::cout << "[AUDIO] Switching to Hollow Woods music\n";
-	}
-	else if (locationID == "loc_old_mill") {
-		musicPath = "Audio\\Music\\old_mill.wav";
-		// std::cout << "[AUDIO] Switching to Old Mill music\n";
-	}
-	else if (locationID == "loc_cemetery") {
-		musicPath = "Audio\\Music\\cemetery.wav";
-		// std::cout << "[AUDIO] Switching to Cemetery music\n";
-	}
-	else if (locationID == "loc_canal") {
-		musicPath = "Audio\\Music\\polluted_canal.wav";
-		// std::cout << "[AUDIO] Switching to Polluted Canal music\n";
-	}
-	else if (locationID == "loc_pump_station") {
-		musicPath = "Audio\\Music\\pump_station.wav";
-		// std::cout << "[AUDIO] Switching to Pump Station music\n";
-	}
-	else if (locationID == "loc_suburban") {
-		musicPath = "Audio\\Music\\suburban_wasteland.wav";
-		// std::cout << "[AUDIO] Switching to Suburban Wasteland music\n";
-	}
-	else if (locationID == "loc_hospital") {
-		musicPath = "Audio\\Music\\hospital.wav";
-		// std::cout << "[AUDIO] Switching to Hospital music\n";
-	}
-	else if (locationID == "loc_sanctuary") {
-		musicPath = "Audio\\Music\\sanctuary.wav";
-		// std::cout << "[AUDIO] Switching to Sanctuary music\n";
-	}
-	else {
-		// Default/unknown location - no music or use generic exploration music
-		// std::cout << "[AUDIO] No specific music for location: " << locationID << "\n";
-		return false;
+	struct LocationTrack {
+		Symbol locationID;
+		const char* musicPath;
+	};
+	static const LocationTrack tracks[] = {
+		{ Symbol("loc_ruined_city"), "Audio\\Music\\ruined_city.wav" },
+		{ Symbol("loc_industrial"), "Audio\\Music\\industrial_district.wav" },
+		{ Symbol("loc_hollow_woods"), "Audio\\Music\\hollow_woods.wav" },
+		{ Symbol("loc_old_mill"), "Audio\\Music\\old_mill.wav" },
+		{ Symbol("loc_cemetery"), "Audio\\Music\\cemetery.wav" },
+		{ Symbol("loc_canal"), "Audio\\Music\\polluted_canal.wav" },
+		{ Symbol("loc_pump_station"), "Audio\\Music\\pump_station.wav" },
+		{ Symbol("loc_suburban"), "Audio\\Music\\suburban_wasteland.wav" },
+		{ Symbol("loc_hospital"), "Audio\\Music\\hospital.wav" },
+		{ Symbol("loc_sanctuary"), "Audio\\Music\\sanctuary.wav" }
+	};
+
+	for (const LocationTrack& track : tracks) {
+		if (track.locationID == locationID) {
+			// Play the location-specific music
+			return playBackgroundMusic(track.musicPath);
+		}
 	}
 
-	// Play the location-specific music
-	return playBackgroundMusic(musicPath);
+	// Default/unknown location - no music or use generic exploration music
+	// std::cout << "[AUDIO] No specific music for location: " << locationID << "\n";
+	return false;
 }
 
 bool AudioEngine::stopAllMusic() {
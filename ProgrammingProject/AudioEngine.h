@@ -1,38 +1,36 @@
 #ifndef AUDIOENGINE_H
 #define AUDIOENGINE_H
+#include "Symbol.h"
 #include <string>
-#include <windows.h>
-#include <dsound.h>
-#include <mmsystem.h>
-#pragma comment(lib, "dsound.lib")
-#pragma comment(lib, "dxguid.lib")
-#pragma comment(lib, "winmm.lib")
 
+// DirectSound interfaces, defined by <dsound.h> in the Windows backend only
+struct IDirectSound8;
+struct IDirectSoundBuffer;
+
+// Audio playback. AudioEngine.cpp is the DirectSound backend; NullAudioEngine.cpp provides
+// the same interface as no-ops for headless builds.
 class AudioEngine {
 private:
-	// Singleton instance
+	// Process-wide instance (the console's sound device)
 	static AudioEngine* instance;
 
-	// Private constructor (singleton pattern)
-	AudioEngine();
-
 	// DirectSound interfaces
-	LPDIRECTSOUND8 pDirectSound;
-	LPDIRECTSOUNDBUFFER pPrimaryBuffer;
-	LPDIRECTSOUNDBUFFER pMusicBuffer;
+	IDirectSound8* pDirectSound;
+	IDirectSoundBuffer* pPrimaryBuffer;
+	IDirectSoundBuffer* pMusicBuffer;
 
 	// Sound effect buffers
-	LPDIRECTSOUNDBUFFER pMenuSelectBuffer;
-	LPDIRECTSOUNDBUFFER pMenuNavigateBuffer;
-	LPDIRECTSOUNDBUFFER pCombatAttackBuffer;
-	LPDIRECTSOUNDBUFFER pCombatHitBuffer;
-	LPDIRECTSOUNDBUFFER pCombatMissBuffer;
-	LPDIRECTSOUNDBUFFER pLootPickupBuffer;
-	LPDIRECTSOUNDBUFFER pZombieDeathBuffer;
-	LPDIRECTSOUNDBUFFER pEnvironmentalHazardBuffer;
-	LPDIRECTSOUNDBUFFER pLevelUpBuffer;
-	LPDIRECTSOUNDBUFFER pSkillUnlockBuffer;
-	LPDIRECTSOUNDBUFFER pSaveGameBuffer;
+	IDirectSoundBuffer* pMenuSelectBuffer;
+	IDirectSoundBuffer* pMenuNavigateBuffer;
+	IDirectSoundBuffer* pCombatAttackBuffer;
+	IDirectSoundBuffer* pCombatHitBuffer;
+	IDirectSoundBuffer* pCombatMissBuffer;
+	IDirectSoundBuffer* pLootPickupBuffer;
+	IDirectSoundBuffer* pZombieDeathBuffer;
+	IDirectSoundBuffer* pEnvironmentalHazardBuffer;
+	IDirectSoundBuffer* pLevelUpBuffer;
+	IDirectSoundBuffer* pSkillUnlockBuffer;
+	IDirectSoundBuffer* pSaveGameBuffer;
 
 	// Flag to track if music is playing
 	bool isMusicPlaying;
@@ -42,17 +40,20 @@ private:
 	bool inCombatMusic;              // True when combat music is playing
 
 	// Helper functions for DirectSound
-	HRESULT loadWaveFile(const std::string& filePath, LPDIRECTSOUNDBUFFER* ppBuffer);
-	void releaseBuffer(LPDIRECTSOUNDBUFFER* ppBuffer);
+	long loadWaveFile(const std::string& filePath, IDirectSoundBuffer** ppBuffer); // Returns an HRESULT
+	void releaseBuffer(IDirectSoundBuffer** ppBuffer);
 	bool isMp3File(const std::string& filePath);
 	void playMP3Sound(const std::string& filePath);  // NEW: For MP3 sound effects
 
 public:
+	// Constructor (the console game shares getInstance; hosted sessions may own one each)
+	AudioEngine();
+
 	// Delete copy constructor and assignment operator
 	AudioEngine(const AudioEngine&) = delete;
 	AudioEngine& operator=(const AudioEngine&) = delete;
 
-	// Get singleton instance
+	// Get the process-wide instance (the default GameSession plays through it)
 	static AudioEngine* getInstance();
 
 	// Play background music (DirectSound - WAV only, DirectX requirement)
@@ -74,7 +75,7 @@ public:
 	bool isPlayingMusic() const;
 
 	// NEW: Location-based music control
-	bool playLocationMusic(const std::string& locationID);
+	bool playLocationMusic(Symbol locationID);
 	bool stopAllMusic();  // Stops all music (for returning to title screen)
 	std::string getCurrentMusicTrack() const { return currentMusicTrack; }
 
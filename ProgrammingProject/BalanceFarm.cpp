@@ -0,0 +1,217 @@
+#include "ContentPack.h"
+#include "GameSession.h"
+#include "PlaythroughSimulator.h"
+#include "Random.h"
+#include "WorkStealingPool.h"
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Monte Carlo balance farm: plays many scripted headless playthroughs across a work-stealing
+// thread pool and prints endings, clue completion and where survivors die.
+// Run from ProgrammingProject/ so Content/ resolves.
+// Playthrough i always runs on seed deriveSeed(--seed, i), so the report does not depend on --threads.
+
+namespace {
+
+const char* const ENDING_NAMES[PlaythroughSimulator::ENDING_COUNT] = {
+	"Bad (died)", "Normal", "True"
+};
+
+void printUsage() {
+	std::cerr << "Usage: balance_farm [options]\n"
+		<< "  --runs N         Playthroughs to simulate (default 100000)\n"
+		<< "  --threads N      Worker threads (default one per hardware thread)\n"
+		<< "  --seed N         Seed for a reproducible run (default random)\n"
+		<< "  --grain N        Playthroughs per task once split (default 64)\n"
+		<< "  --rest N         Rest while HP is below N% of max, 0 never rests (default 50)\n"
+		<< "  --eat N          Eat food at or below N hunger (default 30)\n"
+		<< "  --flee N         Try to flee regular fights below N% of max HP, 0 never flees (default 40)\n"
+		<< "  --max-steps N    Abandon a playthrough after N steps (default 2000)\n";
+}
+
+bool parseInteger(const char* aText, long long& aValue) {
+	char* end = nullptr;
+	aValue = std::strtoll(aText, &end, 10);
+	return end != aText && *end == '\0';
+}
+
+bool parseUnsigned(const char* aText, std::uint64_t& aValue) {
+	char* end = nullptr;
+	aValue = std::strtoull(aText, &end, 10);
+	return end != aText && *end == '\0';
+}
+
+void printHistogram(const char* aLabel, const CombatSimulator::Histogram& aHistogram) {
+	std::cout << "  " << std::left << std::setw(18) << aLabel << std::right
+		<< " mean " << std::setw(8) << std::fixed << std::setprecision(1) << aHistogram.getMean()
+		<< "  p50 " << std::setw(5) << aHistogram.getPercentile(0.50)
+		<< "  p90 " << std::setw(5) << aHistogram.getPercentile(0.90)
+		<< "  p99 " << std::setw(5) << aHistogram.getPercentile(0.99)
+		<< "  max " << std::setw(5) << aHistogram.getMax() << "\n";
+}
+
+// Everything a worker mutates, so workers share nothing but the content pack: a game session of
+// its own (engines, world, storyteller, random streams, audio) and its tallies
+struct WorkerContext {
+	GameSession session;
+	PlaythroughSimulator::Report report;
+
+	WorkerContext(const ContentPack& aContent, int aLocationCount) : session(nullptr, &aContent), report(aLocationCount) {}
+};
+
+class Farm {
+private:
+	const PlaythroughSimulator& fSimulator;
+	WorkStealingPool& fPool;
+	std::vector<WorkerContext*>& fContexts;
+	std::uint64_t fSeed;
+	std::int64_t fGrain;
+
+public:
+	// Constructor
+	Farm(const PlaythroughSimulator& aSimulator, WorkStealingPool& aPool, std::vector<WorkerContext*>& aContexts,
+		std::uint64_t aSeed, std::int64_t aGrain)
+		: fSimulator(aSimulator), fPool(aPool), fContexts(aContexts), fSeed(aSeed), fGrain(aGrain) {}
+
+	// Hand the upper half of the range to the pool until it is one grain, then play it
+	void runRange(int aWorker, std::int64_t aBegin, std::int64_t aEnd) {
+		while (aEnd - aBegin > fGrain) {
+			std::int64_t middle = aBegin + (aEnd - aBegin) / 2;
+			std::int64_t end = aEnd;
+			fPool.submit([this, middle, end](int aNextWorker) { runRange(aNextWorker, middle, end); });
+			aEnd = middle;
+		}
+
+		WorkerContext& context = *fContexts[aWorker];
+		for (std::int64_t i = aBegin; i < aEnd; ++i) {
+			fSimulator.play(context.session, RandomStreams::deriveSeed(fSeed, static_cast<std::uint64_t>(i)), context.report);
+		}
+	}
+};
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+	long long runs = 100000;
+	long long threads = 0;
+	long long grain = 64;
+	std::uint64_t seed = RandomStreams::generateSeed();
+	PlaythroughSimulator::Policy policy;
+
+	for (int i = 1; i < argc; ++i) {
+		std::string option = argv[i];
+		bool hasValue = i + 1 < argc;
+		bool valid = true;
+		long long value = 0;
+
+		if (option == "--help" || option == "-h") {
+			printUsage();
+			return 0;
+		}
+		else if (!hasValue) {
+			valid = false;
+		}
+		else if (option == "--runs") {
+			valid = parseInteger(argv[++i], runs) && runs > 0;
+		}
+		else if (option == "--threads") {
+			valid = parseInteger(argv[++i], threads) && threads >= 0;
+		}
+		else if (option == "--seed") {
+			valid = parseUnsigned(argv[++i], seed);
+		}
+		else if (option == "--grain") {
+			valid = parseInteger(argv[++i], grain) && grain >= 1;
+		}
+		else if (option == "--rest") {
+			valid = parseInteger(argv[++i], value) && value >= 0 && value <= 100;
+			policy.restBelowPercent = static_cast<int>(value);
+		}
+		else if (option == "--eat") {
+			valid = parseInteger(argv[++i], value) && value >= 0;
+			policy.eatAtHunger = static_cast<int>(value);
+		}
+		else if (option == "--flee") {
+			valid = parseInteger(argv[++i], value) && value >= 0 && value <= 100;
+			policy.fleeBelowPercent = static_cast<int>(value);
+		}
+		else if (option == "--max-steps") {
+			valid = parseInteger(argv[++i], value) && value >= 1;
+			policy.maxSteps = static_cast<int>(value);
+		}
+		else {
+			valid = false;
+		}
+
+		if (!valid) {
+			std::cerr << "Invalid option: " << option << "\n";
+			printUsage();
+			return 1;
+		}
+	}
+
+	ContentPack content;
+	if (!content.load()) {
+		std::cerr << "Failed to load content: " << content.getLastError() << "\n";
+		return 1;
+	}
+
+	PlaythroughSimulator simulator(content, policy);
+	WorkStealingPool pool(static_cast<int>(threads));
+
+	std::vector<WorkerContext*> contexts;
+	for (int i = 0; i < pool.getWorkerCount(); ++i) {
+		contexts.push_back(new WorkerContext(content, simulator.getLocationCount()));
+	}
+
+	std::cout << "Simulating " << runs << " playthroughs on " << pool.getWorkerCount()
+		<< (pool.getWorkerCount() == 1 ? " thread" : " threads") << " (seed " << seed << ")\n\n";
+
+	Farm farm(simulator, pool, contexts, seed, grain);
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	pool.submit([&farm, runs](int aWorker) { farm.runRange(aWorker, 0, runs); });
+	pool.wait();
+	double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	PlaythroughSimulator::Report report(simulator.getLocationCount());
+	for (WorkerContext* context : contexts) {
+		report.merge(context->report);
+		delete context;
+	}
+	contexts.clear();
+
+	std::cout << std::fixed << std::setprecision(2);
+	std::cout << "Endings:\n";
+	for (int i = 0; i < PlaythroughSimulator::ENDING_COUNT; ++i) {
+		std::cout << "  " << std::left << std::setw(18) << ENDING_NAMES[i] << std::right
+			<< std::setw(10) << report.endings[i] << "  " << std::setw(6)
+			<< report.endings[i] * 100.0 / report.playthroughs << "%\n";
+	}
+	std::cout << "  " << std::left << std::setw(18) << "Unfinished" << std::right
+		<< std::setw(10) << report.unfinished << "  " << std::setw(6)
+		<< report.unfinished * 100.0 / report.playthroughs << "%\n";
+
+	std::cout << "\nPer playthrough:\n";
+	printHistogram("Clues collected", report.cluesCollected);
+	printHistogram("Steps", report.steps);
+	printHistogram("Rounds per fight", report.combat.roundsPerFight);
+	std::cout << std::setprecision(2) << "  Fight win rate: " << report.combat.getWinRate() * 100.0 << "%\n";
+
+	std::cout << "\nDeaths by location:\n";
+	for (int i = 0; i < simulator.getLocationCount(); ++i) {
+		if (report.deathsByLocation[i] > 0) {
+			std::cout << "  " << std::left << std::setw(28) << content.getLocation(i).name << std::right
+				<< std::setw(10) << report.deathsByLocation[i] << "\n";
+		}
+	}
+
+	std::cout << "\n  Time: " << std::setprecision(2) << seconds << " s, " << std::setprecision(0)
+		<< report.playthroughs / seconds << " playthroughs/s, " << pool.getStealCount() << " steals\n";
+
+	return 0;
+}
@@ -79,11 +79,12 @@ void Boomer::displayInformation() {
 }
 
 // Phase 2: Special Ability - Explosion on Death and Enraged state
-void Boomer::onDeath(Player* target) {
-	if (target != nullptr) {
-		// EXPLOSION DAMAGE when Boomer dies
-		std::cout << "\n  [CRITICAL HIT] " << fName << " EXPLODES in a shower of acid!\n";
-		target->takeDamage(EXPLOSION_DAMAGE);
-		std::cout << "  [DAMAGE] You took " << EXPLOSION_DAMAGE << " damage from the explosion!\n";
+std::string Boomer::onDeath(Player* target) {
+	if (target == nullptr) {
+		return "";
 	}
+	// EXPLOSION DAMAGE when Boomer dies
+	target->takeDamage(EXPLOSION_DAMAGE);
+	return "\n  [CRITICAL HIT] " + getName() + " EXPLODES in a shower of acid!\n"
+		"  [DAMAGE] You took " + std::to_string(EXPLOSION_DAMAGE) + " damage from the explosion!\n";
 }
\ No newline at end of file
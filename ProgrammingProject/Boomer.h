@@ -40,7 +40,8 @@ public:
 	// Phase 2: Special Abilities
 	virtual bool hasSpecialAbility() const override { return true; }
 	virtual int getSpecialAbilityChance() const override { return 100; } // Always explodes on death
-	virtual void onDeath(class Player* target) override;
+	virtual std::string onDeath(class Player* target) override;
+	virtual int getDeathDamage() const override { return EXPLOSION_DAMAGE; }
 	virtual std::string getSpecialAbilityName() const override { return "Explosion"; }
 
 	// Display information
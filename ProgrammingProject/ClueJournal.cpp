@@ -114,53 +114,61 @@ ClueJournal::ClueJournal()
 ClueJournal::~ClueJournal() {
 }
 
+// Add a registered clue to the ID and location indexes
+void ClueJournal::indexClue(Clue* aClue) {
+	int clueID = aClue->getClueID();
+	if (clueID < 0) {
+		return;
+	}
+
+	if (clueID >= static_cast<int>(fCluesByID.size())) {
+		fCluesByID.resize(clueID + 1, nullptr);
+		fCollectedFlags.resize(clueID + 1, false);
+	}
+	if (fCluesByID[clueID] != nullptr) {
+		return; // Keep the first clue registered under an ID
+	}
+	fCluesByID[clueID] = aClue;
+
+	const std::string location = aClue->getLocationFound();
+	fCluesByLocation.emplace(location).push_back(clueID);
+}
+
 // Add clue to journal (register as available, not collected)
 void ClueJournal::addClue(const Clue& aClue) {
 	fAllClues.pushBack(aClue);
+	indexClue(&(*--fAllClues.end()));
+	fTotalCluesInGame++;
+}
+
+void ClueJournal::addClue(Clue&& aClue) {
+	indexClue(&fAllClues.emplaceBack(std::move(aClue)));
 	fTotalCluesInGame++;
 }
 
 // Collect clue by ID (move from available to collected)
 void ClueJournal::collectClue(int aClueID) {
-	DoublyLinkedList<Clue>::Iterator it = fAllClues.begin();
-	while (it != fAllClues.end()) {
-		if ((*it).getClueID() == aClueID) {
-			if (!(*it).isCollected()) {
-				Clue collectedClue = *it;
-				collectedClue.setCollected(true);
-				fCollectedClues.pushBack(collectedClue);
-				(*it).setCollected(true);
-				fCluesCollected++;
-			}
-			return;
-		}
-		++it;
+	Clue* clue = getClue(aClueID);
+	if (clue != nullptr && !fCollectedFlags[aClueID]) {
+		fCollectedFlags[aClueID] = true;
+		clue->setCollected(true);
+		fCollectedClues.pushBack(*clue);
+		fCollectedIDs.push_back(aClueID);
+		fCluesCollected++;
 	}
 }
 
 // Check if clue is in journal (registered)
 bool ClueJournal::hasClue(int aClueID) const {
-	DoublyLinkedList<Clue>& clues = const_cast<DoublyLinkedList<Clue>&>(fAllClues);
-	DoublyLinkedList<Clue>::Iterator it = clues.begin();
-	while (it != clues.end()) {
-		if ((*it).getClueID() == aClueID) {
-			return true;
-		}
-		++it;
-	}
-	return false;
+	return aClueID >= 0 && aClueID < static_cast<int>(fCluesByID.size()) && fCluesByID[aClueID] != nullptr;
 }
 
 // Retrieve clue by ID from all clues
 Clue* ClueJournal::getClue(int aClueID) {
-	DoublyLinkedList<Clue>::Iterator it = fAllClues.begin();
-	while (it != fAllClues.end()) {
-		if ((*it).getClueID() == aClueID) {
-			return &(it.getCurrent()->value);
-		}
-		++it;
+	if (!hasClue(aClueID)) {
+		return nullptr;
 	}
-	return nullptr;
+	return fCluesByID[aClueID];
 }
 
 // Get total collected clues
@@ -175,15 +183,14 @@ int ClueJournal::getTotalCluesInGame() const {
 
 // Check if specific clue is collected
 bool ClueJournal::isClueCollected(int aClueID) const {
-	DoublyLinkedList<Clue>& clues = const_cast<DoublyLinkedList<Clue>&>(fCollectedClues);
-	DoublyLinkedList<Clue>::Iterator it = clues.begin();
-	while (it != clues.end()) {
-		if ((*it).getClueID() == aClueID) {
-			return true;
-		}
-		++it;
-	}
-	return false;
+	return aClueID >= 0 && aClueID < static_cast<int>(fCollectedFlags.size()) && fCollectedFlags[aClueID];
+}
+
+// Get the IDs of every clue registered at a location
+const std::vector<int>& ClueJournal::getClueIDsAtLocation(std::string_view aLocation) const {
+	static const std::vector<int> noClues;
+	const std::vector<int>* clueIDs = fCluesByLocation.search(aLocation);
+	return clueIDs != nullptr ? *clueIDs : noClues;
 }
 
 // Display all collected clues
@@ -199,11 +206,8 @@ void ClueJournal::displayAllCluesCollected() const {
 		return;
 	}
 
-	DoublyLinkedList<Clue>& clues = const_cast<DoublyLinkedList<Clue>&>(fCollectedClues);
-	DoublyLinkedList<Clue>::Iterator it = clues.begin();
-	while (it != clues.end()) {
-		(*it).displayClue();
-		++it;
+	for (const Clue& clue : fCollectedClues) {
+		clue.displayClue();
 	}
 }
 
@@ -220,14 +224,8 @@ void ClueJournal::displayAllCluesReverse() const {
 		return;
 	}
 
-	DoublyLinkedList<Clue>& clues = const_cast<DoublyLinkedList<Clue>&>(fCollectedClues);
-	int totalNodes = fCollectedClues.size();
-	for (int i = totalNodes - 1; i >= 0; i--) {
-		DoublyLinkedList<Clue>::Iterator it = clues.begin();
-		for (int j = 0; j < i; j++) {
-			++it;
-		}
-		(*it).displayClue();
+	for (auto it = fCollectedClues.rbegin(); it != fCollectedClues.rend(); ++it) {
+		it->displayClue();
 	}
 }
 
@@ -239,16 +237,13 @@ void ClueJournal::displayClueByLocation(const std::string& aLocation) const {
 	std::cout << "================================================================\n";
 	
 	bool found = false;
-	DoublyLinkedList<Clue>& clues = const_cast<DoublyLinkedList<Clue>&>(fCollectedClues);
-	DoublyLinkedList<Clue>::Iterator it = clues.begin();
-	while (it != clues.end()) {
-		if ((*it).getLocationFound() == aLocation) {
-			(*it).displayClue();
+	for (int clueID : getClueIDsAtLocation(aLocation)) {
+		if (isClueCollected(clueID)) {
+			fCluesByID[clueID]->displayClue();
 			found = true;
 		}
-		++it;
 	}
-	
+
 	if (!found) {
 		std::cout << "No clues found at this location.\n";
 	}
@@ -270,11 +265,8 @@ void ClueJournal::displayCluesSummary() const {
 		return;
 	}
 
-	DoublyLinkedList<Clue>& clues = const_cast<DoublyLinkedList<Clue>&>(fCollectedClues);
-	DoublyLinkedList<Clue>::Iterator it = clues.begin();
-	while (it != clues.end()) {
-		(*it).displayClueCompact();
-		++it;
+	for (const Clue& clue : fCollectedClues) {
+		clue.displayClueCompact();
 	}
 	std::cout << "================================================================\n";
 }
@@ -328,34 +320,25 @@ DoublyLinkedList<Clue>& ClueJournal::getClues() {
 }
 
 // Get list of collected clue IDs for saving
-std::vector<int> ClueJournal::getCollectedClueIDs() const {
-	std::vector<int> ids;
-	for (auto it = fCollectedClues.begin(); it != fCollectedClues.end(); ++it) {
-		ids.push_back((*it).getClueID());
-	}
-	return ids;
+const std::vector<int>& ClueJournal::getCollectedClueIDs() const {
+	return fCollectedIDs;
 }
 
 // Restore collected clues from saved IDs
 void ClueJournal::setCollectedClueIDs(const std::vector<int>& clueIDs) {
 	// CRITICAL FIX: Clear first to avoid duplicates, then mark clues as collected in both lists
-	fCollectedClues = DoublyLinkedList<Clue>();  // Clear collected list
+	fCollectedClues.clear();
+	fCollectedIDs.clear();
 	fCluesCollected = 0;
+	for (size_t i = 0; i < fCollectedFlags.size(); ++i) {
+		if (fCollectedFlags[i]) {
+			fCollectedFlags[i] = false;
+			fCluesByID[i]->setCollected(false);
+		}
+	}
 
 	for (int clueID : clueIDs) {
-		// Find in all clues and mark as collected
-		DoublyLinkedList<Clue>::Iterator it = fAllClues.begin();
-		while (it != fAllClues.end()) {
-			if ((*it).getClueID() == clueID) {
-				// Mark as collected in fAllClues
-				(*it).setCollected(true);
-				
-				// Add to fCollectedClues
-				fCollectedClues.pushBack(*it);
-				fCluesCollected++;
-				break;
-			}
-			++it;
-		}
+		// Find in all clues, mark as collected and add to fCollectedClues
+		collectClue(clueID);
 	}
 }
\ No newline at end of file
@@ -1,7 +1,9 @@
 #ifndef CLUEJOURNAL_H
 #define CLUEJOURNAL_H
 #include "DoublyLinkedList.h"
+#include "HashTable.h"
 #include <string>
+#include <string_view>
 #include <vector>
 #include <iostream>
 #include <iomanip>
@@ -23,6 +25,12 @@ public:
 	// Parameterised constructor
 	Clue(int aClueID, const std::string& aName, const std::string& aContent, const std::string& aLocationFound, const std::string& aPlayerEffect);
 
+	// Copy and move (defaulted so the virtual destructor does not suppress moves)
+	Clue(const Clue&) = default;
+	Clue(Clue&&) = default;
+	Clue& operator=(const Clue&) = default;
+	Clue& operator=(Clue&&) = default;
+
 	// Destructor
 	virtual ~Clue();
 
@@ -50,21 +58,35 @@ private:
 	int fTotalCluesInGame; // Total available clues
 	int fCluesCollected; // Number of clues collected
 
+	// Indexes over fAllClues (list nodes never move, so the pointers stay valid)
+	std::vector<Clue*> fCluesByID; // Dense clue ID -> registered clue
+	std::vector<bool> fCollectedFlags; // Bitset of collected clue IDs
+	std::vector<int> fCollectedIDs; // Collected clue IDs in collection order
+	HashTable<std::string, std::vector<int>> fCluesByLocation; // Location name -> clue IDs found there
+
+	void indexClue(Clue* aClue);
+
 public:
 	// Constructor
 	ClueJournal();
 
+	// Delete copy constructor and assignment operator (the indexes point into this journal's own list nodes)
+	ClueJournal(const ClueJournal&) = delete;
+	ClueJournal& operator=(const ClueJournal&) = delete;
+
 	// Destructor
 	virtual ~ClueJournal();
 
 	// Clue management methods
 	virtual void addClue(const Clue& aClue); // Add clue to journal
+	virtual void addClue(Clue&& aClue);
 	virtual void collectClue(int aClueID); // Mark clue as collected
 	virtual bool hasClue(int aClueID) const; // Check if clue is in journal
 	virtual Clue* getClue(int aClueID); // Retrieve clue by ID
 	virtual int getTotalCollected() const; // Total collected clues by the player
 	virtual int getTotalCluesInGame() const; // Total clues available in the game
 	virtual bool isClueCollected(int aClueID) const; // Check if specific clue is collected
+	virtual const std::vector<int>& getClueIDsAtLocation(std::string_view aLocation) const; // Registered clue IDs for a location
 
 	// Traversal methods (using the DoublyLinkedList)
 	virtual void displayAllCluesCollected() const; // Display all collected clues
@@ -82,7 +104,7 @@ public:
 
 	// Save/Load support
 	virtual int getCollectedClueCount() const { return fCluesCollected; }
-	virtual std::vector<int> getCollectedClueIDs() const;
+	virtual const std::vector<int>& getCollectedClueIDs() const;
 	virtual void setCollectedClueIDs(const std::vector<int>& clueIDs);
 };
 
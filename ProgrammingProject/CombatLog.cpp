@@ -0,0 +1,170 @@
+#include "CombatLog.h"
+#include <fstream>
+#include <stdexcept>
+
+namespace {
+
+// A CSV field in quotes, any quote in it doubled: names can hold commas, quotes or line breaks
+// (a player's name is whatever they typed)
+void writeQuoted(std::ostream& aOut, const char* aText) {
+	aOut << '"';
+	for (const char* c = aText; *c != '\0'; ++c) {
+		if (*c == '"') {
+			aOut << '"';
+		}
+		aOut << *c;
+	}
+	aOut << '"';
+}
+
+}
+
+// Constructor
+CombatLog::CombatLog(int aCapacity)
+	: fEvents(nullptr), fCapacity(aCapacity > 0 ? aCapacity : 1), fHead(0), fCount(0),
+	fRound(0), fTotalRecorded(0) {
+	fEvents = new CombatEvent[fCapacity];
+}
+
+// Destructor
+CombatLog::~CombatLog() {
+	delete[] fEvents;
+}
+
+// Copy a name into a fixed buffer, truncating if needed
+void CombatLog::copyName(char* aDestination, const std::string& aSource) {
+	size_t length = aSource.copy(aDestination, CombatEvent::NAME_LENGTH - 1);
+	aDestination[length] = '\0';
+}
+
+// Recording
+void CombatLog::record(CombatEvent::Action aAction, const std::string& aActor, const std::string& aTarget, int aAmount) {
+	int index;
+	if (fCount < fCapacity) {
+		index = (fHead + fCount) % fCapacity;
+		fCount++;
+	} else {
+		// Full, overwrite the oldest event
+		index = fHead;
+		fHead = (fHead + 1) % fCapacity;
+	}
+
+	CombatEvent& event = fEvents[index];
+	event.action = aAction;
+	event.amount = aAmount;
+	event.round = fRound;
+	copyName(event.actor, aActor);
+	copyName(event.target, aTarget);
+	fTotalRecorded++;
+}
+
+void CombatLog::nextRound() {
+	fRound++;
+}
+
+void CombatLog::clear() {
+	fHead = 0;
+	fCount = 0;
+	fRound = 0;
+	fTotalRecorded = 0;
+}
+
+// Access
+bool CombatLog::isEmpty() const {
+	return fCount == 0;
+}
+
+int CombatLog::size() const {
+	return fCount;
+}
+
+int CombatLog::getCapacity() const {
+	return fCapacity;
+}
+
+long CombatLog::getTotalRecorded() const {
+	return fTotalRecorded;
+}
+
+const CombatEvent& CombatLog::peek(int aDepth) const {
+	if (aDepth < 0 || aDepth >= fCount) {
+		throw std::out_of_range("CombatLog peek depth out of range.");
+	}
+	return fEvents[(fHead + fCount - 1 - aDepth) % fCapacity];
+}
+
+// Formatting
+std::string CombatLog::format(const CombatEvent& aEvent) {
+	std::string amount = std::to_string(aEvent.amount);
+
+	switch (aEvent.action) {
+	case CombatEvent::Action::KILLED:
+		return std::string("Killed ") + aEvent.target;
+	case CombatEvent::Action::DEALT_DAMAGE:
+		return "Dealt " + amount + " dmg to " + aEvent.target;
+	case CombatEvent::Action::TOOK_DAMAGE:
+		return "Took " + amount + " dmg from " + aEvent.actor;
+	case CombatEvent::Action::DODGED:
+		return std::string("Dodged ") + aEvent.actor + "'s attack";
+	case CombatEvent::Action::PARTIAL_DODGE:
+		return "Took " + amount + " dmg (partial dodge)";
+	case CombatEvent::Action::CRITICAL_STRIKE:
+		return "CRITICAL STRIKE: " + amount + " dmg!";
+	case CombatEvent::Action::SPECIAL_ATTACK:
+		return "Special attack: " + amount + " dmg";
+	case CombatEvent::Action::FLED:
+		return "Fled from combat";
+	case CombatEvent::Action::FLEE_FAILED:
+		return "Failed to flee";
+	case CombatEvent::Action::FLEE_DAMAGE:
+		return "Took " + amount + " dmg (flee failed)";
+	case CombatEvent::Action::AI_HEAL:
+		return "AI HEALED: +" + amount + " HP";
+	case CombatEvent::Action::USED_HEALING_ITEM:
+		return std::string("Used ") + aEvent.target + " (+" + amount + " HP)";
+	case CombatEvent::Action::USED_FOOD_ITEM:
+		return std::string("Used ") + aEvent.target + " (+" + amount + " Hunger)";
+	}
+	return "";
+}
+
+const char* CombatLog::actionToString(CombatEvent::Action aAction) {
+	switch (aAction) {
+	case CombatEvent::Action::KILLED: return "killed";
+	case CombatEvent::Action::DEALT_DAMAGE: return "dealt_damage";
+	case CombatEvent::Action::TOOK_DAMAGE: return "took_damage";
+	case CombatEvent::Action::DODGED: return "dodged";
+	case CombatEvent::Action::PARTIAL_DODGE: return "partial_dodge";
+	case CombatEvent::Action::CRITICAL_STRIKE: return "critical_strike";
+	case CombatEvent::Action::SPECIAL_ATTACK: return "special_attack";
+	case CombatEvent::Action::FLED: return "fled";
+	case CombatEvent::Action::FLEE_FAILED: return "flee_failed";
+	case CombatEvent::Action::FLEE_DAMAGE: return "flee_damage";
+	case CombatEvent::Action::AI_HEAL: return "ai_heal";
+	case CombatEvent::Action::USED_HEALING_ITEM: return "used_healing_item";
+	case CombatEvent::Action::USED_FOOD_ITEM: return "used_food_item";
+	}
+	return "unknown";
+}
+
+// Export
+void CombatLog::exportCSV(std::ostream& aOut) const {
+	aOut << "round,action,actor,target,amount\n";
+	for (int i = fCount - 1; i >= 0; --i) {
+		const CombatEvent& event = peek(i);
+		aOut << event.round << "," << actionToString(event.action) << ",";
+		writeQuoted(aOut, event.actor);
+		aOut << ",";
+		writeQuoted(aOut, event.target);
+		aOut << "," << event.amount << "\n";
+	}
+}
+
+bool CombatLog::exportCSV(const std::string& aFilePath) const {
+	std::ofstream file(aFilePath);
+	if (!file.is_open()) {
+		return false;
+	}
+	exportCSV(file);
+	return true;
+}
@@ -0,0 +1,77 @@
+#ifndef COMBATLOG_H
+#define COMBATLOG_H
+#include <ostream>
+#include <string>
+
+// One combat action, stored as plain data and only turned into text when displayed
+struct CombatEvent {
+	enum class Action : unsigned char {
+		KILLED,
+		DEALT_DAMAGE,
+		TOOK_DAMAGE,
+		DODGED,
+		PARTIAL_DODGE,
+		CRITICAL_STRIKE,
+		SPECIAL_ATTACK,
+		FLED,
+		FLEE_FAILED,
+		FLEE_DAMAGE,
+		AI_HEAL,
+		USED_HEALING_ITEM,
+		USED_FOOD_ITEM
+	};
+
+	static const int NAME_LENGTH = 24;
+
+	Action action;
+	int amount; // Damage, healing or hunger restored
+	int round; // Combat round the event happened in
+	char actor[NAME_LENGTH]; // Who acted ("Player", "AI" or a zombie type)
+	char target[NAME_LENGTH]; // Who or what was affected (zombie type or item name)
+};
+
+// Fixed-capacity ring buffer of combat events.
+// Recording overwrites the oldest event once full, so memory stays constant over a fight.
+class CombatLog {
+private:
+	CombatEvent* fEvents; // Ring storage
+	int fCapacity;
+	int fHead; // Index of the oldest event
+	int fCount;
+	int fRound; // Current combat round
+	long fTotalRecorded; // Events recorded since the last clear, including overwritten ones
+
+	static void copyName(char* aDestination, const std::string& aSource);
+
+public:
+	static const int DEFAULT_CAPACITY = 64;
+
+	// Constructor
+	CombatLog(int aCapacity = DEFAULT_CAPACITY);
+
+	// Destructor
+	~CombatLog();
+
+	CombatLog(const CombatLog&) = delete;
+	CombatLog& operator=(const CombatLog&) = delete;
+
+	// Recording
+	void record(CombatEvent::Action aAction, const std::string& aActor, const std::string& aTarget, int aAmount = 0);
+	void nextRound();
+	void clear();
+
+	// Access (depth 0 is the latest event)
+	bool isEmpty() const;
+	int size() const;
+	int getCapacity() const;
+	long getTotalRecorded() const;
+	const CombatEvent& peek(int aDepth) const;
+
+	// Formatting and export
+	static std::string format(const CombatEvent& aEvent);
+	static const char* actionToString(CombatEvent::Action aAction);
+	void exportCSV(std::ostream& aOut) const; // Oldest first; actor and target quoted
+	bool exportCSV(const std::string& aFilePath) const;
+};
+
+#endif /* COMBATLOG_H */
@@ -0,0 +1,119 @@
+#include "CombatRules.h"
+
+CombatRules::PlayerStats CombatRules::getPlayerStats(const Player& aPlayer) {
+	PlayerStats stats;
+	stats.damage = aPlayer.getDamage();
+	stats.hunger = aPlayer.getHunger();
+	return stats;
+}
+
+CombatRules::ZombieStats CombatRules::getZombieStats(const Zombie& aZombie) {
+	ZombieStats stats;
+	stats.health = aZombie.getHealth();
+	stats.damage = aZombie.getDamage();
+	stats.canUseSpecial = aZombie.canUseSpecialAbility();
+	stats.specialChance = aZombie.getSpecialAbilityChance();
+	stats.deathDamage = aZombie.getDeathDamage();
+	return stats;
+}
+
+CombatRules::RoundResult CombatRules::resolveAction(Action aAction, const PlayerStats& aPlayer, const ZombieStats& aZombie, Random& aRandom) {
+	RoundResult result = {};
+
+	switch (aAction) {
+	case Action::ATTACK: {
+		int baseDamage = aPlayer.damage + aRandom.nextRange(-DAMAGE_SPREAD, DAMAGE_SPREAD);
+
+		// Hunger penalty
+		float hungerMultiplier = 1.0f;
+		if (aPlayer.hunger <= HUNGRY_THRESHOLD) {
+			hungerMultiplier = 0.5f;
+			result.weakened = true;
+		}
+		int damage = (int)(baseDamage * hungerMultiplier);
+
+		if (aRandom.rollPercent(HIT_CHANCE)) {
+			result.hit = true;
+			result.damageDealt = damage;
+		}
+		else {
+			// Zombie punishes a miss
+			result.damageTaken = aZombie.damage;
+		}
+		break;
+	}
+
+	case Action::DODGE: {
+		if (aRandom.rollPercent(DODGE_CHANCE)) {
+			result.dodged = true;
+		}
+		else {
+			result.damageTaken = aZombie.damage / 2;
+		}
+		break;
+	}
+
+	case Action::SPECIAL_ATTACK: {
+		int damage = aPlayer.damage * 2;
+		if (aRandom.rollPercent(CRIT_CHANCE)) {
+			damage = (int)(damage * 2.5f);
+			result.critical = true;
+		}
+		result.hit = true;
+		result.damageDealt = damage;
+		break;
+	}
+
+	case Action::FLEE: {
+		if (aRandom.rollPercent(FLEE_CHANCE)) {
+			result.escaped = true;
+		}
+		else {
+			// Zombie punishes a failed escape
+			result.damageTaken = aZombie.damage;
+		}
+		break;
+	}
+	}
+
+	return result;
+}
+
+void CombatRules::resolveCounterAttack(RoundResult& aRound, const ZombieStats& aZombie, Random& aRandom) {
+	if (aZombie.canUseSpecial && aRandom.rollPercent(aZombie.specialChance)) {
+		aRound.special = true;
+		aRound.damageTaken = (int)(aZombie.damage * 1.5f);
+	}
+	else {
+		aRound.damageTaken = aZombie.damage;
+	}
+}
+
+int CombatRules::rollBossHeal(int aHealth, int aMaxHealth, Random& aRandom) {
+	if (aHealth > aMaxHealth / 4) {
+		return 0;
+	}
+	if (!aRandom.rollPercent(BOSS_HEAL_CHANCE)) {
+		return 0;
+	}
+	return aMaxHealth / 2;
+}
+
+int CombatRules::rollWaveSize(Random& aRandom) {
+	return aRandom.nextRange(MIN_WAVE_SIZE, MAX_WAVE_SIZE);
+}
+
+ContentPack::ZombieKind CombatRules::rollZombieKind(Random& aRandom) {
+	int type = aRandom.nextInt(100);
+
+	if (type < 40) { // 40% Boomer
+		return ContentPack::ZombieKind::BOOMER;
+	}
+	if (type < 65) { // 25% Spitter
+		return ContentPack::ZombieKind::SPITTER;
+	}
+	if (type < 85) { // 20% Smoker
+		return ContentPack::ZombieKind::SMOKER;
+	}
+	return ContentPack::ZombieKind::TANK; // 15% Tank
+}
@@ -0,0 +1,77 @@
+#ifndef COMBATRULES_H
+#define COMBATRULES_H
+#include "ContentPack.h"
+#include "Player.h"
+#include "Random.h"
+#include "Zombie.h"
+
+// Combat arithmetic shared by the combat screen and the batch simulator.
+// Nothing here prints, waits or touches a singleton; the only side effect is drawing from the
+// given stream, always in the order the combat screen has used, so a seed resolves the same way in both.
+class CombatRules {
+public:
+	enum class Action {
+		ATTACK,
+		DODGE,
+		SPECIAL_ATTACK, // Boss fights only
+		FLEE
+	};
+
+	static const int HIT_CHANCE = 80;
+	static const int DODGE_CHANCE = 40;
+	static const int FLEE_CHANCE = 50;
+	static const int CRIT_CHANCE = 40; // Special attack critical strike
+	static const int BOSS_HEAL_CHANCE = 60;
+	static const int HUNGRY_THRESHOLD = 30; // At or below this hunger, attacks deal half damage
+	static const int DAMAGE_SPREAD = 2; // Attacks vary by +/- this much
+	static const int MIN_WAVE_SIZE = 3;
+	static const int MAX_WAVE_SIZE = 6;
+	static const int KILL_EXPERIENCE = 10;
+
+	// What a round needs to know about the player
+	struct PlayerStats {
+		int damage;
+		int hunger;
+	};
+
+	// What a round needs to know about the zombie being fought
+	struct ZombieStats {
+		int health;
+		int damage;
+		bool canUseSpecial;
+		int specialChance; // Percent, rolled only if canUseSpecial
+		int deathDamage; // Dealt to the player when it dies
+	};
+
+	// Outcome of one player action
+	struct RoundResult {
+		bool hit; // Attack or special attack landed
+		bool weakened; // Hunger halved the attack
+		bool special; // Zombie countered with its special ability
+		bool critical; // Special attack crit
+		bool dodged; // Dodge avoided all damage
+		bool escaped; // Flee succeeded
+		int damageDealt;
+		int damageTaken;
+	};
+
+	static PlayerStats getPlayerStats(const Player& aPlayer);
+	static ZombieStats getZombieStats(const Zombie& aZombie);
+
+	// Resolve one player action against the current zombie. An attack that hits leaves the
+	// counter-attack to resolveCounterAttack, once the hit has been applied.
+	static RoundResult resolveAction(Action aAction, const PlayerStats& aPlayer, const ZombieStats& aZombie, Random& aRandom);
+
+	// A zombie that survived a hit strikes back, possibly with its special ability. aZombie is taken
+	// after the hit: a Tank it enraged counters with its enraged damage.
+	static void resolveCounterAttack(RoundResult& aRound, const ZombieStats& aZombie, Random& aRandom);
+
+	// Boss fight assistance: HP restored this round (0 if none)
+	static int rollBossHeal(int aHealth, int aMaxHealth, Random& aRandom);
+
+	// Wave composition
+	static int rollWaveSize(Random& aRandom);
+	static ContentPack::ZombieKind rollZombieKind(Random& aRandom);
+};
+
+#endif /* COMBATRULES_H */
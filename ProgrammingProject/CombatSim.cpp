@@ -0,0 +1,280 @@
+#include "Boomer.h"
+#include "CombatSimulator.h"
+#include "ContentPack.h"
+#include "Player.h"
+#include "Random.h"
+#include "Tank.h"
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Balance sweep driver: runs scripted fights headlessly and prints the aggregate results.
+// Run from ProgrammingProject/ when using --location or --weapon so Content/ resolves.
+
+namespace {
+
+void printUsage() {
+	std::cerr << "Usage: combat_sim [options]\n"
+		<< "  --fights N       Fights to simulate (default 1000000)\n"
+		<< "  --seed N         Seed for a reproducible run (default random)\n"
+		<< "  --level N        Player level (default 1)\n"
+		<< "  --skills A,B     Skill IDs to unlock, in order (e.g. combat_melee_1,combat_melee_2)\n"
+		<< "  --weapon ID      Equip a weapon by its loot ID from the content pack\n"
+		<< "  --damage N       Override the final damage stat\n"
+		<< "  --health N       Override max and current health\n"
+		<< "  --hunger N       Hunger during the fight (default 100)\n"
+		<< "  --location ID    Take wave count and boss fight from a content pack location\n"
+		<< "  --waves N        Waves per fight (default 1)\n"
+		<< "  --boss           Sanctuary boss fight (one Tank per wave, special attacks)\n"
+		<< "  --check          Check the combat rules against known rounds, then exit\n";
+}
+
+bool parseInteger(const char* aText, long long& aValue) {
+	char* end = nullptr;
+	aValue = std::strtoll(aText, &end, 10);
+	return end != aText && *end == '\0';
+}
+
+bool parseUnsigned(const char* aText, std::uint64_t& aValue) {
+	char* end = nullptr;
+	aValue = std::strtoull(aText, &end, 10);
+	return end != aText && *end == '\0';
+}
+
+void printHistogram(const char* aLabel, const CombatSimulator::Histogram& aHistogram) {
+	std::cout << "  " << std::left << std::setw(18) << aLabel << std::right
+		<< " mean " << std::setw(8) << std::fixed << std::setprecision(1) << aHistogram.getMean()
+		<< "  p50 " << std::setw(5) << aHistogram.getPercentile(0.50)
+		<< "  p90 " << std::setw(5) << aHistogram.getPercentile(0.90)
+		<< "  p99 " << std::setw(5) << aHistogram.getPercentile(0.99)
+		<< "  max " << std::setw(5) << aHistogram.getMax() << "\n";
+}
+
+// One attack as conductCombat plays it: the hit lands, then the zombie as it is now strikes back.
+// Draws seeds until the attack hits and the zombie survives it.
+CombatRules::RoundResult playHit(Zombie& aZombie, int aPlayerDamage) {
+	CombatRules::PlayerStats player = { aPlayerDamage, 100 };
+	for (std::uint64_t seed = 1;; ++seed) {
+		Random random(seed);
+		CombatRules::RoundResult round = CombatRules::resolveAction(CombatRules::Action::ATTACK,
+			player, CombatRules::getZombieStats(aZombie), random);
+		if (round.hit && round.damageDealt < aZombie.getHealth()) {
+			aZombie.takeDamage(round.damageDealt);
+			CombatRules::resolveCounterAttack(round, CombatRules::getZombieStats(aZombie), random);
+			return round;
+		}
+	}
+}
+
+bool check(const char* aName, int aActual, int aExpected) {
+	std::cout << (aActual == aExpected ? "  ok    " : "  FAIL  ") << aName << ": " << aActual;
+	if (aActual != aExpected) {
+		std::cout << ", expected " << aExpected;
+	}
+	std::cout << "\n";
+	return aActual == aExpected;
+}
+
+// Rounds whose outcome is known without rolling: what the counter-attack after a hit deals
+int runChecks() {
+	bool passed = true;
+
+	Boomer boomer;
+	int boomerDamage = boomer.getDamage();
+	CombatRules::RoundResult round = playHit(boomer, 10);
+	passed = check("Boomer counters a hit with its damage", round.damageTaken,
+		round.special ? (int)(boomerDamage * 1.5f) : boomerDamage) && passed;
+
+	// A hit that takes a Tank to its threshold enrages it, and the counter to that hit is enraged
+	Tank tank;
+	int tankDamage = tank.getDamage();
+	tank.takeDamage(tank.getHealth() - tank.getHealthThreshold() - 1);
+	int enraged = (int)(tankDamage * tank.getEnrageMultiplier());
+	round = playHit(tank, 20);
+	passed = check("Tank enraged by the hit", tank.isEnraged() ? 1 : 0, 1) && passed;
+	passed = check("Tank counters the enraging hit with enraged damage", round.damageTaken,
+		round.special ? (int)(enraged * 1.5f) : enraged) && passed;
+
+	Tank calm;
+	round = playHit(calm, 20);
+	passed = check("Tank above its threshold counters with its damage", round.damageTaken,
+		round.special ? (int)(tankDamage * 1.5f) : tankDamage) && passed;
+
+	return passed ? 0 : 1;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+	long long fights = 1000000;
+	std::uint64_t seed = RandomStreams::generateSeed();
+	long long level = 1;
+	long long damage = -1;
+	long long health = -1;
+	long long hunger = -1;
+	long long waves = -1;
+	bool boss = false;
+	std::string skills;
+	std::string weaponID;
+	std::string locationID;
+
+	for (int i = 1; i < argc; ++i) {
+		std::string option = argv[i];
+		bool hasValue = i + 1 < argc;
+		bool valid = true;
+
+		if (option == "--help" || option == "-h") {
+			printUsage();
+			return 0;
+		}
+		else if (option == "--boss") {
+			boss = true;
+		}
+		else if (option == "--check") {
+			return runChecks();
+		}
+		else if (!hasValue) {
+			valid = false;
+		}
+		else if (option == "--fights") {
+			valid = parseInteger(argv[++i], fights) && fights > 0;
+		}
+		else if (option == "--seed") {
+			valid = parseUnsigned(argv[++i], seed);
+		}
+		else if (option == "--level") {
+			valid = parseInteger(argv[++i], level) && level >= 1;
+		}
+		else if (option == "--damage") {
+			valid = parseInteger(argv[++i], damage) && damage >= 0;
+		}
+		else if (option == "--health") {
+			valid = parseInteger(argv[++i], health) && health >= 1;
+		}
+		else if (option == "--hunger") {
+			valid = parseInteger(argv[++i], hunger) && hunger >= 0;
+		}
+		else if (option == "--waves") {
+			valid = parseInteger(argv[++i], waves) && waves >= 1;
+		}
+		else if (option == "--skills") {
+			skills = argv[++i];
+		}
+		else if (option == "--weapon") {
+			weaponID = argv[++i];
+		}
+		else if (option == "--location") {
+			locationID = argv[++i];
+		}
+		else {
+			valid = false;
+		}
+
+		if (!valid) {
+			std::cerr << "Invalid option: " << option << "\n";
+			printUsage();
+			return 1;
+		}
+	}
+
+	ContentPack content;
+	if ((!weaponID.empty() || !locationID.empty()) && !content.load()) {
+		std::cerr << "Failed to load content: " << content.getLastError() << "\n";
+		return 1;
+	}
+
+	// Build the player the way a new game would, then level, skill and equip it
+	CombatSimulator::PlayerBuild build;
+	build.level = static_cast<int>(level);
+	std::stringstream skillList(skills);
+	std::string skillID;
+	while (std::getline(skillList, skillID, ',')) {
+		build.skills.push_back(skillID);
+	}
+
+	if (!weaponID.empty()) {
+		for (int i = 0; i < content.getLocationCount() && build.weapon == nullptr; ++i) {
+			for (const ContentPack::LootEntry& entry : content.getLoot(i)) {
+				if (entry.lootID == weaponID) {
+					build.weapon = &entry.item;
+					break;
+				}
+			}
+		}
+		if (build.weapon == nullptr || build.weapon->getCategory() != Item::Category::WEAPON) {
+			std::cerr << "Unknown weapon loot ID: " << weaponID << "\n";
+			return 1;
+		}
+	}
+	build.damage = static_cast<int>(damage);
+	build.health = static_cast<int>(health);
+	build.hunger = static_cast<int>(hunger);
+
+	// Check the build once up front, and show what it comes to
+	std::string error;
+	Player* player = build.createPlayer(error);
+	if (player == nullptr) {
+		std::cerr << error << "\n";
+		return 1;
+	}
+
+	CombatSimulator::Encounter encounter;
+	if (!locationID.empty()) {
+		int locationIndex = content.findLocation(locationID);
+		if (locationIndex < 0) {
+			std::cerr << "Unknown location: " << locationID << "\n";
+			delete player;
+			return 1;
+		}
+		encounter = CombatSimulator::Encounter::fromLocation(content.getLocation(locationIndex));
+	}
+	if (waves >= 1) {
+		encounter.waveCount = static_cast<int>(waves);
+	}
+	if (boss) {
+		encounter.bossFight = true;
+	}
+
+	std::cout << "Simulating " << fights << " fights (seed " << seed << ")\n";
+	std::cout << "  Player: level " << player->getLevel() << ", " << player->getDamage() << " damage, "
+		<< player->getHealth() << "/" << player->getMaxHealth() << " HP, hunger " << player->getHunger()
+		<< ", weapon " << player->getEquippedWeapon() << "\n";
+	std::cout << "  Encounter: " << encounter.waveCount << (encounter.waveCount == 1 ? " wave" : " waves")
+		<< (encounter.bossFight ? ", boss fight" : "") << "\n\n";
+	delete player;
+
+	CombatSimulator simulator(build, encounter, content);
+	CombatSimulator::Report report;
+
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	if (!simulator.run(fights, seed, report, error)) {
+		std::cerr << error << "\n";
+		return 1;
+	}
+	double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	std::cout << std::fixed << std::setprecision(2);
+	std::cout << "  Win rate: " << report.getWinRate() * 100.0 << "% (" << report.wins << "/" << report.fights << ")\n";
+	std::cout << "  Time: " << seconds << " s, " << std::setprecision(0)
+		<< report.fights / seconds << " fights/s, " << report.rounds / seconds << " rounds/s\n\n";
+
+	std::cout << "Per fight:\n";
+	printHistogram("Damage dealt", report.damageDealt);
+	printHistogram("Damage taken", report.damageTaken);
+	printHistogram("Rounds", report.roundsPerFight);
+
+	std::cout << "\nTurns to kill:\n";
+	for (int i = 0; i < CombatSimulator::ZOMBIE_KIND_COUNT; ++i) {
+		if (report.turnsToKill[i].getTotal() > 0) {
+			printHistogram(CombatSimulator::KIND_NAMES[i], report.turnsToKill[i]);
+		}
+	}
+
+	return 0;
+}
@@ -0,0 +1,252 @@
+#include "CombatSimulator.h"
+#include "AIStoryteller.h"
+#include "ExplorationRules.h"
+
+const char* const CombatSimulator::KIND_NAMES[CombatSimulator::ZOMBIE_KIND_COUNT] = {
+	"Common Infected", "Boomer", "Spitter", "Smoker", "Tank"
+};
+
+// ============================================================================
+// PLAYER BUILD & ENCOUNTER
+// ============================================================================
+
+Player* CombatSimulator::PlayerBuild::createPlayer(std::string& aError) const {
+	// Same stats as a new game's character, without the starting kit
+	Player* player = new Player("sim", "Survivor", 1, 8, 125, 125);
+	for (int i = 1; i < level; ++i) {
+		player->levelUp();
+	}
+
+	SkillTree& tree = player->getSkillTree();
+	for (const std::string& skillID : skills) {
+		SkillNode* skill = tree.getSkill(skillID);
+		if (skill == nullptr) {
+			aError = "Unknown skill: " + skillID;
+			delete player;
+			return nullptr;
+		}
+		tree.addSkillPoints(skill->getCost());
+		if (!tree.unlockSkill(skillID)) {
+			aError = "Cannot unlock skill (locked prerequisite?): " + skillID;
+			delete player;
+			return nullptr;
+		}
+	}
+	player->applySkillBonuses();
+
+	if (weapon != nullptr) {
+		// Same damage formula as equipping from the inventory screen
+		player->setDamage(8 + weapon->getDamageBoost());
+		player->setEquippedWeapon(weapon->getName());
+	}
+	if (damage >= 0) {
+		player->setDamage(damage);
+	}
+	if (health >= 1) {
+		player->setMaxHealth(health);
+		player->setHealth(health);
+	}
+	if (hunger >= 0) {
+		player->setHunger(hunger);
+	}
+	return player;
+}
+
+CombatSimulator::Encounter CombatSimulator::Encounter::fromLocation(const ContentPack::LocationEntry& aLocation) {
+	// Same rules as GameplayEngine::setCurrentLocation and startCombat
+	Encounter encounter;
+	encounter.waveCount = ExplorationRules::getWaveCount(aLocation.hazardDamage);
+	encounter.bossFight = ExplorationRules::isBossLocation(aLocation.id);
+	return encounter;
+}
+
+// ============================================================================
+// HISTOGRAM
+// ============================================================================
+
+// Constructor
+CombatSimulator::Histogram::Histogram(int aBucketCount)
+	: fCounts(aBucketCount > 0 ? aBucketCount : 1, 0), fTotal(0), fSum(0), fMax(0) {
+}
+
+void CombatSimulator::Histogram::record(int aValue) {
+	if (aValue < 0) {
+		aValue = 0;
+	}
+	int bucket = aValue < static_cast<int>(fCounts.size()) ? aValue : static_cast<int>(fCounts.size()) - 1;
+	fCounts[bucket]++;
+	fTotal++;
+	fSum += aValue;
+	if (aValue > fMax) {
+		fMax = aValue;
+	}
+}
+
+void CombatSimulator::Histogram::merge(const Histogram& aOther) {
+	if (aOther.fCounts.size() > fCounts.size()) {
+		fCounts.resize(aOther.fCounts.size(), 0);
+	}
+	for (size_t i = 0; i < aOther.fCounts.size(); ++i) {
+		fCounts[i] += aOther.fCounts[i];
+	}
+	fTotal += aOther.fTotal;
+	fSum += aOther.fSum;
+	if (aOther.fMax > fMax) {
+		fMax = aOther.fMax;
+	}
+}
+
+std::int64_t CombatSimulator::Histogram::getTotal() const {
+	return fTotal;
+}
+
+double CombatSimulator::Histogram::getMean() const {
+	return fTotal > 0 ? static_cast<double>(fSum) / fTotal : 0.0;
+}
+
+int CombatSimulator::Histogram::getPercentile(double aFraction) const {
+	if (fTotal == 0) {
+		return 0;
+	}
+	std::int64_t target = static_cast<std::int64_t>(aFraction * fTotal);
+	if (target < 1) {
+		target = 1;
+	}
+	std::int64_t seen = 0;
+	for (size_t i = 0; i < fCounts.size(); ++i) {
+		seen += fCounts[i];
+		if (seen >= target) {
+			return static_cast<int>(i);
+		}
+	}
+	return fMax;
+}
+
+int CombatSimulator::Histogram::getMax() const {
+	return fMax;
+}
+
+// ============================================================================
+// REPORT
+// ============================================================================
+
+// Constructor
+CombatSimulator::Report::Report() : fights(0), wins(0), rounds(0) {
+}
+
+void CombatSimulator::Report::merge(const Report& aOther) {
+	fights += aOther.fights;
+	wins += aOther.wins;
+	rounds += aOther.rounds;
+	damageDealt.merge(aOther.damageDealt);
+	damageTaken.merge(aOther.damageTaken);
+	roundsPerFight.merge(aOther.roundsPerFight);
+	for (int i = 0; i < ZOMBIE_KIND_COUNT; ++i) {
+		turnsToKill[i].merge(aOther.turnsToKill[i]);
+	}
+}
+
+double CombatSimulator::Report::getWinRate() const {
+	return fights > 0 ? static_cast<double>(wins) / fights : 0.0;
+}
+
+// ============================================================================
+// SCRIPTED PLAYER
+// ============================================================================
+
+// Constructor
+CombatSimulator::ScriptedPlayer::ScriptedPlayer(Report& aReport, int aFleeBelowPercent)
+	: fReport(aReport), fFleeBelowPercent(aFleeBelowPercent), fTurnsOnZombie(0), fFights(0) {
+}
+
+bool CombatSimulator::ScriptedPlayer::takeLoot(const Item& /*aItem*/) {
+	return true;
+}
+
+CombatRules::Action CombatSimulator::ScriptedPlayer::chooseCombatAction(const Player& aPlayer, const Zombie& /*aZombie*/, bool aBossFight) {
+	fTurnsOnZombie++;
+	if (aBossFight) {
+		return CombatRules::Action::SPECIAL_ATTACK;
+	}
+	if (fFleeBelowPercent > 0 && aPlayer.getHealth() * 100 < aPlayer.getMaxHealth() * fFleeBelowPercent) {
+		return CombatRules::Action::FLEE;
+	}
+	return CombatRules::Action::ATTACK;
+}
+
+void CombatSimulator::ScriptedPlayer::zombieKilled(const Zombie& aZombie) {
+	int kind = getKindIndex(aZombie);
+	if (kind >= 0) {
+		fReport.turnsToKill[kind].record(fTurnsOnZombie);
+	}
+	fTurnsOnZombie = 0;
+}
+
+void CombatSimulator::ScriptedPlayer::combatEnded(const CombatResult& aResult) {
+	fTurnsOnZombie = 0;
+	fFights++;
+
+	fReport.fights++;
+	if (aResult.playerWon) {
+		fReport.wins++;
+	}
+	fReport.rounds += aResult.rounds;
+	fReport.damageDealt.record(aResult.playerDamageDealt);
+	fReport.damageTaken.record(aResult.playerDamageTaken);
+	fReport.roundsPerFight.record(aResult.rounds);
+}
+
+int CombatSimulator::ScriptedPlayer::getFightCount() const {
+	return fFights;
+}
+
+// ============================================================================
+// SIMULATOR
+// ============================================================================
+
+// Constructor
+CombatSimulator::CombatSimulator(const PlayerBuild& aBuild, const Encounter& aEncounter, const ContentPack& aContent)
+	: fBuild(aBuild), fEncounter(aEncounter), fSession(nullptr, &aContent) {
+	fSession.getStoryteller().setOutput(nullptr);
+	fSession.getGameplayEngine().setOutput(nullptr);
+}
+
+bool CombatSimulator::run(std::int64_t aFights, std::uint64_t aSeed, Report& aReport, std::string& aError) {
+	ScriptedPlayer fighter(aReport);
+	GameplayEngine& gameplay = fSession.getGameplayEngine();
+	gameplay.setAutopilot(&fighter);
+	gameplay.setSeed(aSeed);
+
+	bool built = true;
+	for (std::int64_t i = 0; i < aFights && built; ++i) {
+		Player* player = fBuild.createPlayer(aError);
+		built = player != nullptr;
+		if (built) {
+			gameplay.initialize(player, nullptr, nullptr);
+			gameplay.startEncounter(fEncounter.waveCount, fEncounter.bossFight);
+			delete player;
+		}
+	}
+
+	gameplay.initialize(nullptr, nullptr, nullptr);
+	gameplay.setAutopilot(nullptr);
+	return built;
+}
+
+const CombatSimulator::PlayerBuild& CombatSimulator::getBuild() const {
+	return fBuild;
+}
+
+const CombatSimulator::Encounter& CombatSimulator::getEncounter() const {
+	return fEncounter;
+}
+
+int CombatSimulator::getKindIndex(const Zombie& aZombie) {
+	std::string type = aZombie.getType();
+	for (int i = 0; i < ZOMBIE_KIND_COUNT; ++i) {
+		if (type == KIND_NAMES[i]) {
+			return i;
+		}
+	}
+	return -1;
+}
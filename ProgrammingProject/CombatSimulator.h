@@ -0,0 +1,126 @@
+#ifndef COMBATSIMULATOR_H
+#define COMBATSIMULATOR_H
+#include "CombatRules.h"
+#include "ContentPack.h"
+#include "GameSession.h"
+#include "GameplayEngine.h"
+#include "Item.h"
+#include "Player.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Headless batch combat for balance sweeps.
+// Every fight is the game's own: GameplayEngine::startEncounter on a session of the simulator's,
+// so waves, storyteller adjustments, kill XP and levelling, Boomer explosions and boss assistance
+// all follow the engine. A scripted player attacks every round (special attacks in boss fights)
+// and nothing is printed or waited for.
+class CombatSimulator {
+public:
+	static const int ZOMBIE_KIND_COUNT = static_cast<int>(ContentPack::ZombieKind::TANK) + 1;
+	static const char* const KIND_NAMES[ZOMBIE_KIND_COUNT]; // As Zombie::getType() reports them
+
+	// The fighter: a new game's character, levelled, skilled and equipped, then any overrides
+	struct PlayerBuild {
+		int level;
+		std::vector<std::string> skills; // Skill IDs to unlock, in order
+		const Item* weapon; // Equipped as from the inventory screen; nullptr for none
+		int damage; // Final damage, -1 to keep the built value
+		int health; // Max and current health, -1 to keep
+		int hunger; // -1 to keep
+
+		PlayerBuild() : level(1), weapon(nullptr), damage(-1), health(-1), hunger(-1) {}
+
+		// The player described, or nullptr with aError set if a skill cannot be unlocked
+		Player* createPlayer(std::string& aError) const;
+	};
+
+	// The fight being simulated: how many waves and whether it is the sanctuary boss
+	struct Encounter {
+		int waveCount;
+		bool bossFight;
+
+		Encounter() : waveCount(1), bossFight(false) {}
+		static Encounter fromLocation(const ContentPack::LocationEntry& aLocation);
+	};
+
+	// Counts of non-negative values; values at or past the last bucket share it
+	class Histogram {
+	private:
+		std::vector<std::int64_t> fCounts;
+		std::int64_t fTotal;
+		std::int64_t fSum;
+		int fMax;
+
+	public:
+		// Constructor
+		explicit Histogram(int aBucketCount = 4096);
+
+		void record(int aValue);
+		void merge(const Histogram& aOther);
+
+		std::int64_t getTotal() const;
+		double getMean() const;
+		int getPercentile(double aFraction) const; // Smallest value with at least aFraction of samples at or below it
+		int getMax() const;
+	};
+
+	struct Report {
+		std::int64_t fights;
+		std::int64_t wins;
+		std::int64_t rounds;
+		Histogram damageDealt; // Per fight
+		Histogram damageTaken; // Per fight
+		Histogram roundsPerFight;
+		Histogram turnsToKill[ZOMBIE_KIND_COUNT]; // Player actions per kill, by zombie kind
+
+		// Constructor
+		Report();
+
+		void merge(const Report& aOther);
+		double getWinRate() const;
+	};
+
+	// Answers the engine's prompts for a scripted player and tallies its fights into a report:
+	// always takes loot, attacks (special attack against the boss), and outside boss fights tries to
+	// flee while below aFleeBelowPercent of max HP (0 fights to the end)
+	class ScriptedPlayer : public Autopilot {
+	private:
+		Report& fReport;
+		int fFleeBelowPercent;
+		int fTurnsOnZombie;
+		int fFights;
+
+	public:
+		// Constructor
+		explicit ScriptedPlayer(Report& aReport, int aFleeBelowPercent = 0);
+
+		bool takeLoot(const Item& aItem) override;
+		CombatRules::Action chooseCombatAction(const Player& aPlayer, const Zombie& aZombie, bool aBossFight) override;
+		void zombieKilled(const Zombie& aZombie) override;
+		void combatEnded(const CombatResult& aResult) override;
+
+		int getFightCount() const;
+	};
+
+private:
+	PlayerBuild fBuild;
+	Encounter fEncounter;
+	GameSession fSession; // Fights run on its gameplay engine
+
+public:
+	// Constructor (aContent may be empty; fights need no world)
+	CombatSimulator(const PlayerBuild& aBuild, const Encounter& aEncounter, const ContentPack& aContent);
+
+	// aFights fights from one seed, each on a freshly built player, accumulated into aReport.
+	// False with aError set if the build cannot be made.
+	bool run(std::int64_t aFights, std::uint64_t aSeed, Report& aReport, std::string& aError);
+
+	const PlayerBuild& getBuild() const;
+	const Encounter& getEncounter() const;
+
+	// Zombie kind of a Zombie, by its type name; -1 if it is none of them
+	static int getKindIndex(const Zombie& aZombie);
+};
+
+#endif /* COMBATSIMULATOR_H */
@@ -0,0 +1,790 @@
+#include "ContentPack.h"
+#include "KeyHash.h"
+#include "CommonInfected.h"
+#include "Boomer.h"
+#include "Spitter.h"
+#include "Smoker.h"
+#include "Tank.h"
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <utility>
+
+const char* const ContentPack::DEFAULT_SOURCE_PATH = "Content/outbreak_content.txt";
+const char* const ContentPack::DEFAULT_PACK_PATH = "Content/outbreak_content.pak";
+
+// ============================================================================
+// FILE FORMAT HELPERS
+// ============================================================================
+
+// Binary pack header: magic, format version, hash of the text source it was compiled from
+static const char PACK_MAGIC[4] = { 'O', 'B', 'P', 'K' };
+static const std::uint32_t PACK_VERSION = 1;
+
+static const char* const LOCATION_TYPE_NAMES[] = { "CITY", "INDUSTRIAL", "FOREST", "SUBURBAN", "HOSPITAL", "MILITARY", "SANCTUARY" };
+static const char* const HAZARD_NAMES[] = { "NONE", "TOXIC_FOG", "ACID_RAIN", "COLLAPSED_FLOOR", "CONTAMINATED_WATER", "DARKNESS" };
+static const char* const DIRECTION_NAMES[] = { "UP", "DOWN", "LEFT", "RIGHT", "CENTER" };
+static const char* const CATEGORY_NAMES[] = { "WEAPON", "MEDICAL", "FOOD", "MATERIAL", "TOOL", "KEY_ITEM", "CONSUMABLE" };
+static const char* const ZOMBIE_KIND_NAMES[] = { "COMMON_INFECTED", "BOOMER", "SPITTER", "SMOKER", "TANK" };
+
+// Look an enum up by its name in the file (the name's position is the enum value)
+template <class Enum, size_t N>
+static bool parseName(const std::string& aText, const char* const (&aNames)[N], Enum& aResult) {
+	for (size_t i = 0; i < N; ++i) {
+		if (aText == aNames[i]) {
+			aResult = static_cast<Enum>(i);
+			return true;
+		}
+	}
+	return false;
+}
+
+static bool parseInt(const std::string& aText, int& aResult) {
+	if (aText.empty()) {
+		return false;
+	}
+	char* end = nullptr;
+	long value = std::strtol(aText.c_str(), &end, 10);
+	if (*end != '\0') {
+		return false;
+	}
+	aResult = static_cast<int>(value);
+	return true;
+}
+
+static bool parseBool(const std::string& aText, bool& aResult) {
+	if (aText == "0" || aText == "1") {
+		aResult = aText == "1";
+		return true;
+	}
+	return false;
+}
+
+// Split a record on '|' and unescape \n, \| and \\ inside fields
+static std::vector<std::string> splitFields(const std::string& aLine) {
+	std::vector<std::string> fields(1);
+	for (size_t i = 0; i < aLine.size(); ++i) {
+		char c = aLine[i];
+		if (c == '\\' && i + 1 < aLine.size()) {
+			char next = aLine[++i];
+			fields.back() += next == 'n' ? '\n' : next;
+		}
+		else if (c == '|') {
+			fields.emplace_back();
+		}
+		else {
+			fields.back() += c;
+		}
+	}
+	return fields;
+}
+
+// Little-endian binary writer/reader for the compiled pack
+class PackWriter {
+private:
+	std::string fBuffer;
+
+public:
+	void writeU32(std::uint32_t aValue) {
+		for (int i = 0; i < 4; ++i) {
+			fBuffer += static_cast<char>((aValue >> (8 * i)) & 0xFF);
+		}
+	}
+
+	void writeInt(int aValue) {
+		writeU32(static_cast<std::uint32_t>(aValue));
+	}
+
+	void writeString(const std::string& aValue) {
+		writeU32(static_cast<std::uint32_t>(aValue.size()));
+		fBuffer += aValue;
+	}
+
+	void writeBytes(const char* aData, size_t aLength) {
+		fBuffer.append(aData, aLength);
+	}
+
+	const std::string& getBuffer() const {
+		return fBuffer;
+	}
+};
+
+class PackReader {
+private:
+	const std::string& fBuffer;
+	size_t fPosition;
+	bool fValid;
+
+	bool require(size_t aLength) {
+		if (!fValid || fBuffer.size() - fPosition < aLength) {
+			fValid = false;
+		}
+		return fValid;
+	}
+
+public:
+	PackReader(const std::string& aBuffer) : fBuffer(aBuffer), fPosition(0), fValid(true) {}
+
+	std::uint32_t readU32() {
+		if (!require(4)) {
+			return 0;
+		}
+		std::uint32_t value = 0;
+		for (int i = 0; i < 4; ++i) {
+			value |= static_cast<std::uint32_t>(static_cast<unsigned char>(fBuffer[fPosition + i])) << (8 * i);
+		}
+		fPosition += 4;
+		return value;
+	}
+
+	int readInt() {
+		return static_cast<int>(readU32());
+	}
+
+	// Table sizes are bounded by the bytes left, so a corrupt count cannot trigger a huge allocation
+	int readCount() {
+		std::uint32_t count = readU32();
+		if (count > fBuffer.size() - fPosition) {
+			fValid = false;
+			return 0;
+		}
+		return static_cast<int>(count);
+	}
+
+	std::string readString() {
+		std::uint32_t length = readU32();
+		if (!require(length)) {
+			return std::string();
+		}
+		std::string value = fBuffer.substr(fPosition, length);
+		fPosition += length;
+		return value;
+	}
+
+	bool readBytes(char* aData, size_t aLength) {
+		if (!require(aLength)) {
+			return false;
+		}
+		std::memcpy(aData, fBuffer.data() + fPosition, aLength);
+		fPosition += aLength;
+		return true;
+	}
+
+	// Read an enum stored as an int, rejecting out of range values
+	template <class Enum>
+	Enum readEnum(int aCount) {
+		int value = readInt();
+		if (value < 0 || value >= aCount) {
+			fValid = false;
+			value = 0;
+		}
+		return static_cast<Enum>(value);
+	}
+
+	bool isValid() const {
+		return fValid;
+	}
+
+	bool isAtEnd() const {
+		return fPosition == fBuffer.size();
+	}
+};
+
+static bool readFile(const std::string& aPath, std::string& aContents) {
+	std::ifstream file(aPath, std::ios::binary);
+	if (!file.is_open()) {
+		return false;
+	}
+	std::ostringstream stream;
+	stream << file.rdbuf();
+	aContents = stream.str();
+	return true;
+}
+
+// Stable counting sort of (location index, row) pairs into aTable, filling each location's range
+template <class T>
+static void groupByLocation(std::vector<std::pair<int, T>>& aPending, std::vector<T>& aTable,
+	std::vector<ContentPack::LocationEntry>& aLocations, ContentPack::Range ContentPack::LocationEntry::* aRange) {
+	std::vector<int> counts(aLocations.size() + 1, 0);
+	for (const auto& row : aPending) {
+		counts[row.first + 1]++;
+	}
+	for (size_t i = 0; i < aLocations.size(); ++i) {
+		counts[i + 1] += counts[i];
+		(aLocations[i].*aRange).begin = counts[i];
+		(aLocations[i].*aRange).end = counts[i + 1];
+	}
+
+	std::vector<int> next(counts.begin(), counts.end() - 1);
+	std::vector<T*> order(aPending.size());
+	for (auto& row : aPending) {
+		order[next[row.first]++] = &row.second;
+	}
+
+	aTable.clear();
+	aTable.reserve(aPending.size());
+	for (T* row : order) {
+		aTable.push_back(std::move(*row));
+	}
+}
+
+// ============================================================================
+// CONSTRUCTION
+// ============================================================================
+
+// Constructor
+ContentPack::ContentPack() {
+}
+
+void ContentPack::reset() {
+	fLocations.clear();
+	fZombies.clear();
+	fConnections.clear();
+	fLoot.clear();
+	fClueSpawns.clear();
+	fLore.clear();
+	fStartLocationID.clear();
+	fLocationIndex = HashTable<std::string, int>();
+	fItemIndex = HashTable<std::string, int>();
+	fLastError.clear();
+}
+
+void ContentPack::buildLocationIndex() {
+	fLocationIndex = HashTable<std::string, int>(static_cast<int>(fLocations.size()));
+	for (size_t i = 0; i < fLocations.size(); ++i) {
+		fLocationIndex.insert(fLocations[i].id, static_cast<int>(i));
+	}
+}
+
+void ContentPack::buildItemIndex() {
+	fItemIndex = HashTable<std::string, int>(static_cast<int>(fLoot.size()));
+	for (size_t i = 0; i < fLoot.size(); ++i) {
+		if (fItemIndex.search(fLoot[i].item.getID()) == nullptr) {
+			fItemIndex.insert(fLoot[i].item.getID(), static_cast<int>(i));
+		}
+	}
+}
+
+bool ContentPack::fail(const std::string& aMessage) {
+	std::string message = aMessage;
+	reset();
+	fLastError = message;
+	return false;
+}
+
+// ============================================================================
+// LOADING
+// ============================================================================
+
+// Use the compiled pack while it matches the source; otherwise recompile it from the source.
+// A shipped pack with no source next to it is trusted as-is.
+bool ContentPack::load(const std::string& aSourcePath, const std::string& aPackPath) {
+	std::string source;
+	bool hasSource = readFile(aSourcePath, source);
+	unsigned int sourceHash = hasSource ? hashSource(source) : 0;
+
+	if (loadPack(aPackPath, sourceHash, hasSource)) {
+		return true;
+	}
+	if (!hasSource) {
+		return fail("Content source '" + aSourcePath + "' not found and no usable pack at '" + aPackPath + "'.");
+	}
+	if (!parseSource(source)) {
+		fLastError = aSourcePath + ", " + fLastError;
+		return false;
+	}
+
+	// A stale or unwritable pack only costs a reparse next time
+	savePack(aPackPath, sourceHash);
+	return true;
+}
+
+bool ContentPack::loadSource(const std::string& aSourcePath) {
+	std::string source;
+	if (!readFile(aSourcePath, source)) {
+		return fail("Content source '" + aSourcePath + "' not found.");
+	}
+	if (!parseSource(source)) {
+		fLastError = aSourcePath + ", " + fLastError;
+		return false;
+	}
+	return true;
+}
+
+// Text format, one record per line, fields separated by '|':
+//   location|id|name|type|hazard|hazardDamage|chapter|chapterTitle|description|atmosphere|story
+//   zombie|locationID|kind|zombieID|name
+//   connection|fromLocationID|toLocationID
+//   loot|locationID|direction|lootID|name|category|description|quantity|space|consumable|usable|health|hunger|cure|damage
+//   clue|locationID|direction|clueID
+//   lore|clueID|name|content|locationName|effect
+//   start|locationID
+// Blank lines and lines starting with '#' are ignored.
+bool ContentPack::parseSource(const std::string& aText) {
+	reset();
+
+	// Child rows keep their owner's ID until every location has been read
+	std::vector<std::pair<std::string, ZombieEntry>> zombies;
+	std::vector<std::pair<std::string, std::string>> connections;
+	std::vector<std::pair<std::string, LootEntry>> loot;
+	std::vector<std::pair<std::string, ClueSpawnEntry>> clueSpawns;
+
+	std::istringstream stream(aText);
+	std::string line;
+	int lineNumber = 0;
+	while (std::getline(stream, line)) {
+		lineNumber++;
+		if (!line.empty() && line.back() == '\r') {
+			line.pop_back();
+		}
+		if (line.empty() || line[0] == '#') {
+			continue;
+		}
+
+		std::vector<std::string> fields = splitFields(line);
+		const std::string& record = fields[0];
+		std::string where = "line " + std::to_string(lineNumber) + ": ";
+
+		if (record == "location") {
+			LocationEntry entry;
+			if (fields.size() != 11
+				|| !parseName(fields[3], LOCATION_TYPE_NAMES, entry.type)
+				|| !parseName(fields[4], HAZARD_NAMES, entry.hazard)
+				|| !parseInt(fields[5], entry.hazardDamage)
+				|| !parseInt(fields[6], entry.chapterNumber)) {
+				return fail(where + "malformed location record.");
+			}
+			entry.id = fields[1];
+			entry.name = fields[2];
+			entry.chapterTitle = fields[7];
+			entry.description = fields[8];
+			entry.atmosphere = fields[9];
+			entry.chapterStory = fields[10];
+			entry.zombies = entry.connections = entry.loot = entry.clueSpawns = Range{ 0, 0 };
+			fLocations.push_back(std::move(entry));
+		}
+		else if (record == "zombie") {
+			ZombieEntry entry;
+			if (fields.size() != 5 || !parseName(fields[2], ZOMBIE_KIND_NAMES, entry.kind)) {
+				return fail(where + "malformed zombie record.");
+			}
+			entry.id = fields[3];
+			entry.name = fields[4];
+			zombies.emplace_back(fields[1], std::move(entry));
+		}
+		else if (record == "connection") {
+			if (fields.size() != 3) {
+				return fail(where + "malformed connection record.");
+			}
+			connections.emplace_back(fields[1], fields[2]);
+		}
+		else if (record == "loot") {
+			Direction direction;
+			Item::Category category;
+			int quantity, space, health, hunger, cure, damage;
+			bool consumable, usable;
+			if (fields.size() != 15
+				|| !parseName(fields[2], DIRECTION_NAMES, direction)
+				|| !parseName(fields[5], CATEGORY_NAMES, category)
+				|| !parseInt(fields[7], quantity) || !parseInt(fields[8], space)
+				|| !parseBool(fields[9], consumable) || !parseBool(fields[10], usable)
+				|| !parseInt(fields[11], health) || !parseInt(fields[12], hunger)
+				|| !parseInt(fields[13], cure) || !parseInt(fields[14], damage)) {
+				return fail(where + "malformed loot record.");
+			}
+			LootEntry entry{ fields[3], direction,
+				Item(fields[3], fields[4], category, fields[6], quantity, space, consumable, usable, health, hunger, cure, damage) };
+			loot.emplace_back(fields[1], std::move(entry));
+		}
+		else if (record == "clue") {
+			ClueSpawnEntry entry;
+			if (fields.size() != 4
+				|| !parseName(fields[2], DIRECTION_NAMES, entry.direction)
+				|| !parseInt(fields[3], entry.clueID)) {
+				return fail(where + "malformed clue record.");
+			}
+			clueSpawns.emplace_back(fields[1], std::move(entry));
+		}
+		else if (record == "lore") {
+			LoreEntry entry;
+			if (fields.size() != 6 || !parseInt(fields[1], entry.clueID)) {
+				return fail(where + "malformed lore record.");
+			}
+			entry.name = fields[2];
+			entry.content = fields[3];
+			entry.location = fields[4];
+			entry.effect = fields[5];
+			fLore.push_back(std::move(entry));
+		}
+		else if (record == "start") {
+			if (fields.size() != 2) {
+				return fail(where + "malformed start record.");
+			}
+			fStartLocationID = fields[1];
+		}
+		else {
+			return fail(where + "unknown record '" + record + "'.");
+		}
+	}
+
+	buildLocationIndex();
+	if (fLocationIndex.getSize() != static_cast<int>(fLocations.size())) {
+		return fail("duplicate location ID.");
+	}
+	if (findLocation(fStartLocationID) < 0) {
+		return fail("missing or unknown start location '" + fStartLocationID + "'.");
+	}
+
+	// Swap owner IDs for location indices, rejecting dangling references
+	std::vector<std::pair<int, ZombieEntry>> zombieRows;
+	for (auto& row : zombies) {
+		int owner = findLocation(row.first);
+		if (owner < 0) {
+			return fail("zombie '" + row.second.id + "' placed in unknown location '" + row.first + "'.");
+		}
+		zombieRows.emplace_back(owner, std::move(row.second));
+	}
+
+	std::vector<std::pair<int, std::string>> connectionRows;
+	for (auto& row : connections) {
+		int owner = findLocation(row.first);
+		if (owner < 0 || findLocation(row.second) < 0) {
+			return fail("connection '" + row.first + "' -> '" + row.second + "' names an unknown location.");
+		}
+		connectionRows.emplace_back(owner, std::move(row.second));
+	}
+
+	std::vector<std::pair<int, LootEntry>> lootRows;
+	for (auto& row : loot) {
+		int owner = findLocation(row.first);
+		if (owner < 0) {
+			return fail("loot '" + row.second.lootID + "' placed in unknown location '" + row.first + "'.");
+		}
+		lootRows.emplace_back(owner, std::move(row.second));
+	}
+
+	std::vector<std::pair<int, ClueSpawnEntry>> clueRows;
+	for (auto& row : clueSpawns) {
+		int owner = findLocation(row.first);
+		if (owner < 0) {
+			return fail("clue " + std::to_string(row.second.clueID) + " placed in unknown location '" + row.first + "'.");
+		}
+		const LoreEntry* lore = nullptr;
+		for (const LoreEntry& entry : fLore) {
+			if (entry.clueID == row.second.clueID) {
+				lore = &entry;
+				break;
+			}
+		}
+		if (lore == nullptr) {
+			return fail("clue " + std::to_string(row.second.clueID) + " has no lore record.");
+		}
+		row.second.clueName = lore->name;
+		clueRows.emplace_back(owner, std::move(row.second));
+	}
+
+	groupByLocation(zombieRows, fZombies, fLocations, &LocationEntry::zombies);
+	groupByLocation(connectionRows, fConnections, fLocations, &LocationEntry::connections);
+	groupByLocation(lootRows, fLoot, fLocations, &LocationEntry::loot);
+	groupByLocation(clueRows, fClueSpawns, fLocations, &LocationEntry::clueSpawns);
+	buildItemIndex();
+	return true;
+}
+
+// ============================================================================
+// COMPILED PACK
+// ============================================================================
+
+static void writeRange(PackWriter& aWriter, const ContentPack::Range& aRange) {
+	aWriter.writeInt(aRange.begin);
+	aWriter.writeInt(aRange.end);
+}
+
+static ContentPack::Range readRange(PackReader& aReader, int aTableSize) {
+	ContentPack::Range range;
+	range.begin = aReader.readInt();
+	range.end = aReader.readInt();
+	if (range.begin < 0 || range.begin > range.end || range.end > aTableSize) {
+		range.begin = range.end = 0;
+	}
+	return range;
+}
+
+bool ContentPack::savePack(const std::string& aPackPath, unsigned int aSourceHash) const {
+	PackWriter writer;
+	writer.writeBytes(PACK_MAGIC, sizeof(PACK_MAGIC));
+	writer.writeU32(PACK_VERSION);
+	writer.writeU32(aSourceHash);
+	writer.writeString(fStartLocationID);
+
+	// Child tables come first so location ranges can be checked against their sizes on load
+	writer.writeInt(static_cast<int>(fZombies.size()));
+	for (const ZombieEntry& entry : fZombies) {
+		writer.writeInt(static_cast<int>(entry.kind));
+		writer.writeString(entry.id);
+		writer.writeString(entry.name);
+	}
+
+	writer.writeInt(static_cast<int>(fConnections.size()));
+	for (const std::string& target : fConnections) {
+		writer.writeString(target);
+	}
+
+	writer.writeInt(static_cast<int>(fLoot.size()));
+	for (const LootEntry& entry : fLoot) {
+		const Item& item = entry.item;
+		writer.writeString(entry.lootID);
+		writer.writeInt(static_cast<int>(entry.direction));
+		writer.writeString(item.getName());
+		writer.writeInt(static_cast<int>(item.getCategory()));
+		writer.writeString(item.getDescription());
+		writer.writeInt(item.getQuantity());
+		writer.writeInt(item.getInventorySpace());
+		writer.writeInt(item.isConsumable() ? 1 : 0);
+		writer.writeInt(item.isUsable() ? 1 : 0);
+		writer.writeInt(item.getHealthRestore());
+		writer.writeInt(item.getHungerRestore());
+		writer.writeInt(item.getInfectionCure());
+		writer.writeInt(item.getDamageBoost());
+	}
+
+	writer.writeInt(static_cast<int>(fClueSpawns.size()));
+	for (const ClueSpawnEntry& entry : fClueSpawns) {
+		writer.writeInt(entry.clueID);
+		writer.writeInt(static_cast<int>(entry.direction));
+		writer.writeString(entry.clueName);
+	}
+
+	writer.writeInt(static_cast<int>(fLore.size()));
+	for (const LoreEntry& entry : fLore) {
+		writer.writeInt(entry.clueID);
+		writer.writeString(entry.name);
+		writer.writeString(entry.content);
+		writer.writeString(entry.location);
+		writer.writeString(entry.effect);
+	}
+
+	writer.writeInt(static_cast<int>(fLocations.size()));
+	for (const LocationEntry& entry : fLocations) {
+		writer.writeString(entry.id);
+		writer.writeString(entry.name);
+		writer.writeInt(static_cast<int>(entry.type));
+		writer.writeInt(static_cast<int>(entry.hazard));
+		writer.writeInt(entry.hazardDamage);
+		writer.writeInt(entry.chapterNumber);
+		writer.writeString(entry.chapterTitle);
+		writer.writeString(entry.description);
+		writer.writeString(entry.atmosphere);
+		writer.writeString(entry.chapterStory);
+		writeRange(writer, entry.zombies);
+		writeRange(writer, entry.connections);
+		writeRange(writer, entry.loot);
+		writeRange(writer, entry.clueSpawns);
+	}
+
+	std::ofstream file(aPackPath, std::ios::binary | std::ios::trunc);
+	if (!file.is_open()) {
+		return false;
+	}
+	const std::string& buffer = writer.getBuffer();
+	file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+	return static_cast<bool>(file);
+}
+
+bool ContentPack::loadPack(const std::string& aPackPath, unsigned int aExpectedSourceHash, bool aCheckHash) {
+	std::string buffer;
+	if (!readFile(aPackPath, buffer)) {
+		return fail("Content pack '" + aPackPath + "' not found.");
+	}
+
+	reset();
+	PackReader reader(buffer);
+	char magic[sizeof(PACK_MAGIC)];
+	if (!reader.readBytes(magic, sizeof(magic)) || std::memcmp(magic, PACK_MAGIC, sizeof(magic)) != 0
+		|| reader.readU32() != PACK_VERSION) {
+		return fail("Content pack '" + aPackPath + "' has an unknown format.");
+	}
+	unsigned int sourceHash = reader.readU32();
+	if (aCheckHash && sourceHash != aExpectedSourceHash) {
+		return fail("Content pack '" + aPackPath + "' is out of date.");
+	}
+	fStartLocationID = reader.readString();
+
+	int count = reader.readCount();
+	fZombies.reserve(count);
+	for (int i = 0; i < count && reader.isValid(); ++i) {
+		ZombieEntry entry;
+		entry.kind = reader.readEnum<ZombieKind>(5);
+		entry.id = reader.readString();
+		entry.name = reader.readString();
+		fZombies.push_back(std::move(entry));
+	}
+
+	count = reader.readCount();
+	fConnections.reserve(count);
+	for (int i = 0; i < count && reader.isValid(); ++i) {
+		fConnections.push_back(reader.readString());
+	}
+
+	count = reader.readCount();
+	fLoot.reserve(count);
+	for (int i = 0; i < count && reader.isValid(); ++i) {
+		std::string lootID = reader.readString();
+		Direction direction = reader.readEnum<Direction>(5);
+		std::string name = reader.readString();
+		Item::Category category = reader.readEnum<Item::Category>(7);
+		std::string description = reader.readString();
+		int quantity = reader.readInt();
+		int space = reader.readInt();
+		bool consumable = reader.readInt() != 0;
+		bool usable = reader.readInt() != 0;
+		int health = reader.readInt();
+		int hunger = reader.readInt();
+		int cure = reader.readInt();
+		int damage = reader.readInt();
+		fLoot.push_back(LootEntry{ lootID, direction,
+			Item(lootID, name, category, description, quantity, space, consumable, usable, health, hunger, cure, damage) });
+	}
+
+	count = reader.readCount();
+	fClueSpawns.reserve(count);
+	for (int i = 0; i < count && reader.isValid(); ++i) {
+		ClueSpawnEntry entry;
+		entry.clueID = reader.readInt();
+		entry.direction = reader.readEnum<Direction>(5);
+		entry.clueName = reader.readString();
+		fClueSpawns.push_back(std::move(entry));
+	}
+
+	count = reader.readCount();
+	fLore.reserve(count);
+	for (int i = 0; i < count && reader.isValid(); ++i) {
+		LoreEntry entry;
+		entry.clueID = reader.readInt();
+		entry.name = reader.readString();
+		entry.content = reader.readString();
+		entry.location = reader.readString();
+		entry.effect = reader.readString();
+		fLore.push_back(std::move(entry));
+	}
+
+	count = reader.readCount();
+	fLocations.reserve(count);
+	for (int i = 0; i < count && reader.isValid(); ++i) {
+		LocationEntry entry;
+		entry.id = reader.readString();
+		entry.name = reader.readString();
+		entry.type = reader.readEnum<Location::LocationType>(7);
+		entry.hazard = reader.readEnum<Location::Hazard>(6);
+		entry.hazardDamage = reader.readInt();
+		entry.chapterNumber = reader.readInt();
+		entry.chapterTitle = reader.readString();
+		entry.description = reader.readString();
+		entry.atmosphere = reader.readString();
+		entry.chapterStory = reader.readString();
+		entry.zombies = readRange(reader, static_cast<int>(fZombies.size()));
+		entry.connections = readRange(reader, static_cast<int>(fConnections.size()));
+		entry.loot = readRange(reader, static_cast<int>(fLoot.size()));
+		entry.clueSpawns = readRange(reader, static_cast<int>(fClueSpawns.size()));
+		fLocations.push_back(std::move(entry));
+	}
+
+	if (!reader.isValid() || !reader.isAtEnd()) {
+		return fail("Content pack '" + aPackPath + "' is truncated or corrupt.");
+	}
+	buildLocationIndex();
+	if (findLocation(fStartLocationID) < 0) {
+		return fail("Content pack '" + aPackPath + "' has an unknown start location.");
+	}
+	buildItemIndex();
+	return true;
+}
+
+const std::string& ContentPack::getLastError() const {
+	return fLastError;
+}
+
+unsigned int ContentPack::hashSource(const std::string& aText) {
+	return hashChars(aText.data(), aText.size());
+}
+
+// ============================================================================
+// ACCESS
+// ============================================================================
+
+bool ContentPack::isLoaded() const {
+	return !fLocations.empty();
+}
+
+int ContentPack::getLocationCount() const {
+	return static_cast<int>(fLocations.size());
+}
+
+int ContentPack::findLocation(std::string_view aLocationID) const {
+	int* index = fLocationIndex.search(aLocationID);
+	return index != nullptr ? *index : -1;
+}
+
+const ContentPack::LocationEntry& ContentPack::getLocation(int aIndex) const {
+	return fLocations.at(aIndex);
+}
+
+const std::string& ContentPack::getStartLocationID() const {
+	return fStartLocationID;
+}
+
+const Item* ContentPack::findItem(std::string_view aItemID) const {
+	int* index = fItemIndex.search(aItemID);
+	return index != nullptr ? &fLoot[*index].item : nullptr;
+}
+
+template <class T>
+ContentPack::Slice<T> ContentPack::slice(const std::vector<T>& aTable, int aLocationIndex, Range LocationEntry::* aRange) const {
+	if (aLocationIndex < 0 || aLocationIndex >= static_cast<int>(fLocations.size())) {
+		return Slice<T>();
+	}
+	const Range& range = fLocations[aLocationIndex].*aRange;
+	return Slice<T>(aTable.data() + range.begin, aTable.data() + range.end);
+}
+
+ContentPack::Slice<ContentPack::ZombieEntry> ContentPack::getZombies(int aLocationIndex) const {
+	return slice(fZombies, aLocationIndex, &LocationEntry::zombies);
+}
+
+ContentPack::Slice<std::string> ContentPack::getConnections(int aLocationIndex) const {
+	return slice(fConnections, aLocationIndex, &LocationEntry::connections);
+}
+
+ContentPack::Slice<ContentPack::LootEntry> ContentPack::getLoot(int aLocationIndex) const {
+	return slice(fLoot, aLocationIndex, &LocationEntry::loot);
+}
+
+ContentPack::Slice<ContentPack::ClueSpawnEntry> ContentPack::getClueSpawns(int aLocationIndex) const {
+	return slice(fClueSpawns, aLocationIndex, &LocationEntry::clueSpawns);
+}
+
+const std::vector<ContentPack::LoreEntry>& ContentPack::getLore() const {
+	return fLore;
+}
+
+// ============================================================================
+// ZOMBIE FACTORY
+// ============================================================================
+
+Zombie* ContentPack::createZombie(const ZombieEntry& aEntry) {
+	switch (aEntry.kind) {
+	case ZombieKind::BOOMER:
+		return new Boomer(aEntry.id, aEntry.name);
+	case ZombieKind::SPITTER:
+		return new Spitter(aEntry.id, aEntry.name);
+	case ZombieKind::SMOKER:
+		return new Smoker(aEntry.id, aEntry.name);
+	case ZombieKind::TANK:
+		return new Tank(aEntry.id, aEntry.name);
+	case ZombieKind::COMMON_INFECTED:
+	default:
+		return new CommonInfected(aEntry.id, aEntry.name);
+	}
+}
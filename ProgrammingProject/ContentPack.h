@@ -0,0 +1,153 @@
+#ifndef CONTENTPACK_H
+#define CONTENTPACK_H
+#include "Direction.h"
+#include "HashTable.h"
+#include "Item.h"
+#include "Location.h"
+#include "Zombie.h"
+#include <string>
+#include <string_view>
+#include <vector>
+
+// World content (locations, zombies, loot, clue spawns and lore) loaded from a content pack.
+// The text source is compiled into a binary pack next to it; the pack is reused while its
+// recorded source hash still matches, so editing the text needs no recompile of the game.
+// Every child table is grouped by location, so a location's rows are one contiguous slice.
+class ContentPack {
+public:
+	static const char* const DEFAULT_SOURCE_PATH;
+	static const char* const DEFAULT_PACK_PATH;
+
+	enum class ZombieKind : unsigned char {
+		COMMON_INFECTED,
+		BOOMER,
+		SPITTER,
+		SMOKER,
+		TANK
+	};
+
+	// Half-open range of rows in a child table
+	struct Range {
+		int begin;
+		int end;
+	};
+
+	struct LocationEntry {
+		std::string id;
+		std::string name;
+		Location::LocationType type;
+		Location::Hazard hazard;
+		int hazardDamage;
+		int chapterNumber;
+		std::string chapterTitle;
+		std::string description;
+		std::string atmosphere;
+		std::string chapterStory;
+		Range zombies;
+		Range connections;
+		Range loot;
+		Range clueSpawns;
+	};
+
+	struct ZombieEntry {
+		ZombieKind kind;
+		std::string id;
+		std::string name;
+	};
+
+	struct LootEntry {
+		std::string lootID;
+		Direction direction;
+		Item item;
+	};
+
+	struct ClueSpawnEntry {
+		int clueID;
+		Direction direction;
+		std::string clueName; // Copied from the matching lore entry
+	};
+
+	struct LoreEntry {
+		int clueID;
+		std::string name;
+		std::string content;
+		std::string location;
+		std::string effect;
+	};
+
+	// Read-only view over a run of table rows
+	template <class T>
+	class Slice {
+	private:
+		const T* fFirst;
+		const T* fLast;
+
+	public:
+		Slice() : fFirst(nullptr), fLast(nullptr) {}
+		Slice(const T* aFirst, const T* aLast) : fFirst(aFirst), fLast(aLast) {}
+
+		const T* begin() const { return fFirst; }
+		const T* end() const { return fLast; }
+		int size() const { return static_cast<int>(fLast - fFirst); }
+		bool isEmpty() const { return fFirst == fLast; }
+		const T& operator[](int aIndex) const { return fFirst[aIndex]; }
+	};
+
+private:
+	std::vector<LocationEntry> fLocations; // In file order
+	std::vector<ZombieEntry> fZombies; // Grouped by location
+	std::vector<std::string> fConnections; // Target location IDs, grouped by source location
+	std::vector<LootEntry> fLoot; // Grouped by location
+	std::vector<ClueSpawnEntry> fClueSpawns; // Grouped by location
+	std::vector<LoreEntry> fLore; // In file order
+	std::string fStartLocationID;
+	HashTable<std::string, int> fLocationIndex; // Location ID -> index into fLocations
+	HashTable<std::string, int> fItemIndex; // Loot item ID -> index into fLoot (its first row)
+	std::string fLastError;
+
+	template <class T>
+	Slice<T> slice(const std::vector<T>& aTable, int aLocationIndex, Range LocationEntry::* aRange) const;
+
+	void reset();
+	void buildLocationIndex();
+	void buildItemIndex();
+	bool fail(const std::string& aMessage);
+
+public:
+	// Constructor
+	ContentPack();
+
+	// Loading
+	bool load(const std::string& aSourcePath = DEFAULT_SOURCE_PATH, const std::string& aPackPath = DEFAULT_PACK_PATH);
+	bool loadSource(const std::string& aSourcePath);
+	bool parseSource(const std::string& aText);
+	bool loadPack(const std::string& aPackPath, unsigned int aExpectedSourceHash, bool aCheckHash);
+	bool savePack(const std::string& aPackPath, unsigned int aSourceHash) const;
+	const std::string& getLastError() const;
+
+	// Locations
+	bool isLoaded() const;
+	int getLocationCount() const;
+	int findLocation(std::string_view aLocationID) const; // -1 if unknown
+	const LocationEntry& getLocation(int aIndex) const;
+	const std::string& getStartLocationID() const;
+
+	// Per-location slices (empty for an unknown index)
+	Slice<ZombieEntry> getZombies(int aLocationIndex) const;
+	Slice<std::string> getConnections(int aLocationIndex) const;
+	Slice<LootEntry> getLoot(int aLocationIndex) const;
+	Slice<ClueSpawnEntry> getClueSpawns(int aLocationIndex) const;
+
+	// The item a loot row with this ID hands out; nullptr if no row does
+	const Item* findItem(std::string_view aItemID) const;
+
+	// Lore
+	const std::vector<LoreEntry>& getLore() const;
+
+	// Build a live zombie for a zombie row
+	static Zombie* createZombie(const ZombieEntry& aEntry);
+
+	static unsigned int hashSource(const std::string& aText);
+};
+
+#endif /* CONTENTPACK_H */
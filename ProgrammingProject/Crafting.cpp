@@ -85,8 +85,9 @@ void CraftingSystem::addRecipe(CraftingRecipe* recipe) {
 }
 
 CraftingRecipe* CraftingSystem::getRecipe(const std::string& recipeID) {
+	Symbol id = Symbol::find(recipeID);
 	for (auto it = fRecipes.begin(); it != fRecipes.end(); ++it) {
-		if ((*it)->recipeID == recipeID) {
+		if ((*it)->recipeID == id) {
 			return *it;
 		}
 	}
@@ -128,7 +129,7 @@ bool CraftingSystem::canCraft(const CraftingRecipe* recipe, Player* player) {
 
 		for (auto it = inventory.begin(); it != inventory.end(); ++it) {
 			// Check both by ID and by Name for flexibility
-			if ((*it).getID() == materialReq.first || (*it).getName() == materialReq.first) {
+			if ((*it).getIDSymbol() == materialReq.first || (*it).getNameSymbol() == materialReq.first) {
 				foundCount += (*it).getQuantity();
 			}
 		}
@@ -162,13 +163,9 @@ bool CraftingSystem::craftItem(const CraftingRecipe* recipe, Player* player) {
 		// Iterate through inventory and remove matching materials
 		auto it = inventory.begin();
 		while (it != inventory.end()) {
-			if ((*it).getID() == materialReq.first || (*it).getName() == materialReq.first) {
+			if ((*it).getIDSymbol() == materialReq.first || (*it).getNameSymbol() == materialReq.first) {
 				int canRemove = std::min(neededCount - removed, (*it).getQuantity());
-				
-				// Create a copy to remove
-				Item itemToRemove = *it;
-				itemToRemove.setQuantity(canRemove);
-				
+
 				// Remove this amount
 				player->removeItem(*it);
 				removed += canRemove;
@@ -3,24 +3,25 @@
 
 #include "Item.h"
 #include "SinglyLinkedList.h"
+#include "Symbol.h"
 #include <string>
 #include <vector>
 
 // Recipe for crafting
 struct CraftingRecipe {
-	std::string recipeID;
+	Symbol recipeID;
 	std::string recipeName;
 	std::string description;
 	Item resultItem;
-	std::vector<std::pair<std::string, int>> materials; // {material_id, quantity_needed}
+	std::vector<std::pair<Symbol, int>> materials; // {material ID or name, quantity_needed}
 	int craftTime; // seconds
 
 	CraftingRecipe(const std::string& id, const std::string& name, const std::string& desc,
 		const Item& result, int time = 5)
-		: recipeID(id), recipeName(name), description(desc), resultItem(result), craftTime(time) {}
+		: recipeID(Symbol(id)), recipeName(name), description(desc), resultItem(result), craftTime(time) {}
 
 	void addMaterial(const std::string& materialID, int quantity) {
-		materials.push_back({materialID, quantity});
+		materials.push_back({Symbol(materialID), quantity});
 	}
 };
 
@@ -0,0 +1,15 @@
+#ifndef DIRECTION_H
+#define DIRECTION_H
+
+// ============================================================================
+// DIRECTION ENUM
+// ============================================================================
+enum class Direction {
+	UP,
+	DOWN,
+	LEFT,
+	RIGHT,
+	CENTER
+};
+
+#endif /* DIRECTION_H */
@@ -2,11 +2,16 @@
 #define DOUBLYLINKEDLIST_H
 #include "DoublyLinkedNode.h"
 #include "DoublyLinkedNodeIterator.h"
+#include "NodePool.h"
+#include <iterator>
+#include <utility>
 
-template <class T>
+// Allocator supplies create/destroy for nodes (PoolAllocator or HeapAllocator from NodePool.h)
+template <class T, template <class> class Allocator = PoolAllocator>
 class DoublyLinkedList {
 private:
 	typedef DoublyLinkedNode<T> Node;
+	typedef Allocator<Node> NodeAllocator;
 	Node* head; // Track the first node 
 	Node* last; // Track the last node
 	int count;
@@ -24,8 +29,27 @@ private:
 		return current;
 	}
 
+	void linkBack(Node* newNode) {
+		if (isEmpty()) {
+			head = newNode;
+			last = newNode;
+		}
+		else {
+			last->append(newNode);
+			last = newNode;
+		}
+		++count;
+	}
+
 public:
 	typedef DoublyLinkedNodeIterator<T> Iterator;
+	typedef DoublyLinkedNodeIterator<T, const T> ConstIterator;
+	typedef std::reverse_iterator<Iterator> ReverseIterator;
+	typedef std::reverse_iterator<ConstIterator> ConstReverseIterator;
+	typedef Iterator iterator;
+	typedef ConstIterator const_iterator;
+	typedef ReverseIterator reverse_iterator;
+	typedef ConstReverseIterator const_reverse_iterator;
 
 	DoublyLinkedList() {
 		head = &Node::NIL;
@@ -33,14 +57,39 @@ public:
 		count = 0;
 	}
 
+	// Copy constructor
+	DoublyLinkedList(const DoublyLinkedList& other) : head(&Node::NIL), last(&Node::NIL), count(0) {
+		for (const T& value : other) {
+			pushBack(value);
+		}
+	}
+
+	// Move constructor
+	DoublyLinkedList(DoublyLinkedList&& other) noexcept : head(other.head), last(other.last), count(other.count) {
+		other.head = &Node::NIL;
+		other.last = &Node::NIL;
+		other.count = 0;
+	}
+
+	// Copy and move assignment
+	DoublyLinkedList& operator=(DoublyLinkedList other) {
+		std::swap(head, other.head);
+		std::swap(last, other.last);
+		std::swap(count, other.count);
+		return *this;
+	}
+
 	~DoublyLinkedList() {
-		// Safely delete all nodes
+		clear();
+	}
+
+	// Delete all nodes
+	void clear() {
 		Node* current = head;
-		while (current != &(Node::NIL) && count > 0) {
+		while (current != &Node::NIL) {
 			Node* next = current->next;
-			delete current;
+			NodeAllocator::destroy(current);
 			current = next;
-			--count;
 		}
 		head = &Node::NIL;
 		last = &Node::NIL;
@@ -57,16 +106,19 @@ public:
 
 	// Push to tail/last
 	void pushBack(const T& value) { // Renaming to pushBack for clarity
-		Node* newNode = new Node(value);
-		if (isEmpty()) {
-			head = newNode;
-			last = newNode;
-		}
-		else {
-			last->append(newNode);
-			last = newNode;
-		}
-		++count;
+		linkBack(NodeAllocator::create(value));
+	}
+
+	void pushBack(T&& value) {
+		linkBack(NodeAllocator::create(std::move(value)));
+	}
+
+	// Construct a new tail element in place
+	template <class... Args>
+	T& emplaceBack(Args&&... args) {
+		Node* newNode = NodeAllocator::create(std::in_place, std::forward<Args>(args)...);
+		linkBack(newNode);
+		return newNode->value;
 	}
 
 	// Pop from tail/last
@@ -85,7 +137,7 @@ public:
 			last = last->previous;
 			last->next = &Node::NIL;
 		}
-		delete toDelete;
+		NodeAllocator::destroy(toDelete);
 		--count;
 	}
 
@@ -103,24 +155,60 @@ public:
 			head = head->next;
 			head->previous = &Node::NIL;
 		}
-		delete toDelete;
+		NodeAllocator::destroy(toDelete);
+		--count;
+	}
+
+	// Remove the element at position, returning the iterator after it
+	Iterator erase(Iterator position) {
+		Node* toDelete = position.getCurrent();
+		if (toDelete == &Node::NIL) {
+			return end();
+		}
+		Node* next = toDelete->next;
+
+		if (toDelete == head) {
+			head = next;
+		}
+		if (toDelete == last) {
+			last = toDelete->previous;
+		}
+		toDelete->remove();
+		NodeAllocator::destroy(toDelete);
 		--count;
+		return Iterator(next, &last);
 	}
 
 	Iterator begin() {
-		return Iterator(head);
+		return Iterator(head, &last);
 	}
 
 	Iterator end() {
-		return Iterator(Node::NIL);
+		return Iterator(Node::NIL, &last);
+	}
+
+	ConstIterator begin() const {
+		return ConstIterator(head, &last);
+	}
+
+	ConstIterator end() const {
+		return ConstIterator(Node::NIL, &last);
+	}
+
+	ReverseIterator rbegin() {
+		return ReverseIterator(end());
+	}
+
+	ReverseIterator rend() {
+		return ReverseIterator(begin());
 	}
 
-	Iterator begin() const {
-		return Iterator(const_cast<Node*>(head));
+	ConstReverseIterator rbegin() const {
+		return ConstReverseIterator(end());
 	}
 
-	Iterator end() const {
-		return Iterator(Node::NIL);
+	ConstReverseIterator rend() const {
+		return ConstReverseIterator(begin());
 	}
 };
 
@@ -1,5 +1,6 @@
 #ifndef DOUBLYLINKEDNODE_H
 #define DOUBLYLINKEDNODE_H
+#include <utility>
 
 template <class DataType>
 class DoublyLinkedNode {
@@ -17,11 +18,13 @@ public:
 		previous = &NIL;
 	}
 
-	DoublyLinkedNode(const DataType& aValue) {
-		value = aValue;
-		next = &NIL;
-		previous = &NIL;
-	}
+	DoublyLinkedNode(const DataType& aValue) : value(aValue), next(&NIL), previous(&NIL) {}
+
+	DoublyLinkedNode(DataType&& aValue) : value(std::move(aValue)), next(&NIL), previous(&NIL) {}
+
+	// Construct the value in place from its constructor arguments
+	template <class... Args>
+	DoublyLinkedNode(std::in_place_t, Args&&... args) : value(std::forward<Args>(args)...), next(&NIL), previous(&NIL) {}
 
 	// Add a node before the current one. (New Node is nearer the Head)
 	void prepend(Node* newNode) {
@@ -44,7 +47,7 @@ public:
 		this->next = newNode;
 	}
 
-	// Delete the current node from the list.
+	// Unlink the current node from its neighbours. (The owning list frees it)
 	void remove() {
 		if (this->previous != &NIL) {
 			this->previous->next = this->next;
@@ -52,7 +55,8 @@ public:
 		if (this->next != &NIL) {
 			this->next->previous = this->previous;
 		}
-		delete this;
+		this->next = &NIL;
+		this->previous = &NIL;
 	}
 };
 
@@ -1,22 +1,44 @@
 #ifndef DOUBLYLINKEDNODEITERATOR_H
 #define DOUBLYLINKEDNODEITERATOR_H
 #include "DoublyLinkedNode.h"
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
 
-template <class DataType>
+// Bidirectional iterator over a DoublyLinkedList.
+// ValueType is DataType for a mutable iterator and const DataType for a const iterator.
+// The shared NIL sentinel has no link back to any one list, so the iterator also keeps
+// a pointer to its list's tail pointer; that is what lets --end() reach the last node.
+template <class DataType, class ValueType = DataType>
 class DoublyLinkedNodeIterator {
 private:
 	typedef DoublyLinkedNode<DataType> Node;
 	Node* current;
+	Node* const* tail; // Address of the owning list's last pointer (may be null)
+
+	template <class, class> friend class DoublyLinkedNodeIterator;
 
 public:
-	DoublyLinkedNodeIterator(Node* startNode) {
-		current = startNode;
-	}
+	typedef std::bidirectional_iterator_tag iterator_category;
+	typedef DataType value_type;
+	typedef std::ptrdiff_t difference_type;
+	typedef ValueType* pointer;
+	typedef ValueType& reference;
+
+	DoublyLinkedNodeIterator() : current(&Node::NIL), tail(nullptr) {}
+
+	DoublyLinkedNodeIterator(Node* startNode, Node* const* aTail = nullptr) : current(startNode), tail(aTail) {}
 
 	// New constructor to access the sentinel in the iterator's end() method
-	DoublyLinkedNodeIterator(Node& node) {
-		current = &node;
-	}
+	DoublyLinkedNodeIterator(Node& node, Node* const* aTail = nullptr) : current(&node), tail(aTail) {}
+
+	// Copy constructor and assignment
+	DoublyLinkedNodeIterator(const DoublyLinkedNodeIterator&) = default;
+	DoublyLinkedNodeIterator& operator=(const DoublyLinkedNodeIterator&) = default;
+
+	// Mutable iterators convert to const iterators
+	template <class OtherValue, class = typename std::enable_if<std::is_same<OtherValue, DataType>::value && !std::is_same<ValueType, DataType>::value>::type>
+	DoublyLinkedNodeIterator(const DoublyLinkedNodeIterator<DataType, OtherValue>& other) : current(other.current), tail(other.tail) {}
 
 	// Pre-increment operator
 	DoublyLinkedNodeIterator& operator++() {
@@ -31,9 +53,14 @@ public:
 		return temp;
 	}
 
-	// Pre-decrement operator
+	// Pre-decrement operator (stepping back from the end lands on the last node)
 	DoublyLinkedNodeIterator& operator--() {
-		current = current->previous;
+		if (current == &Node::NIL && tail != nullptr) {
+			current = *tail;
+		}
+		else {
+			current = current->previous;
+		}
 		return *this;
 	}
 
@@ -52,21 +79,25 @@ public:
 		return current != other.current;
 	}
 
-	DataType operator*() const {
+	reference operator*() const {
 		return current->value;
 	}
 
-	Node* getCurrent() {
+	pointer operator->() const {
+		return &current->value;
+	}
+
+	Node* getCurrent() const {
 		return current;
 	}
 
 	DoublyLinkedNodeIterator begin() {
-		return DoublyLinkedNodeIterator(current);
+		return DoublyLinkedNodeIterator(current, tail);
 	}
 
 	DoublyLinkedNodeIterator end() {
-		return DoublyLinkedNodeIterator(Node::NIL); // Using NIL at the end marker
+		return DoublyLinkedNodeIterator(Node::NIL, tail); // Using NIL at the end marker
 	}
 };
 
-#endif /* DOUBLYLINKEDNODEITERATOR */
\ No newline at end of file
+#endif /* DOUBLYLINKEDNODEITERATOR_H */
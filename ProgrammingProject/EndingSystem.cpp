@@ -1,9 +1,8 @@
 ﻿#include "EndingSystem.h"
 #include "AudioEngine.h"
 #include "TitleScreen.h"
+#include "Platform.h"
 #include <iostream>
-#include <thread>
-#include <chrono>
 #include <string>
 #include <limits>
 
@@ -33,9 +32,9 @@ EndingSystem::EndingType EndingSystem::determineEnding(bool playerDefeated, bool
 // MAIN ENDING DISPLAY
 // ============================================================================
 
-void EndingSystem::displayEnding(EndingType type, Player* player, ClueJournal* journal) {
+void EndingSystem::displayEnding(AudioEngine* audio, EndingType type, Player* player, ClueJournal* journal) {
 	// Play ending music
-	playEndingMusic();
+	playEndingMusic(audio);
 
 	// Display the appropriate ending
 	switch (type) {
@@ -55,15 +54,14 @@ void EndingSystem::displayEnding(EndingType type, Player* player, ClueJournal* j
 	std::cin.get();
 
 	// Stop ending music and return to title screen music
-	AudioEngine* audio = AudioEngine::getInstance();
 	if (audio != nullptr) {
 		audio->stopAllMusic();
 		audio->playBackgroundMusic("Audio\\Music\\background_music.wav");
 	}
 
 	// CRITICAL FIX: Clear screen and show title screen
-	system("cls");
-	std::this_thread::sleep_for(std::chrono::milliseconds(500));
+	Platform::clearScreen();
+	Platform::sleepFor(500);
 }
 
 // ============================================================================
@@ -71,7 +69,7 @@ void EndingSystem::displayEnding(EndingType type, Player* player, ClueJournal* j
 // ============================================================================
 
 void EndingSystem::displayBadEnding() {
-	system("cls");
+	Platform::clearScreen();
 	std::cout << "\n\n";
 
 	// Animated title
@@ -106,7 +104,7 @@ void EndingSystem::displayBadEnding() {
 }
 
 void EndingSystem::displayNormalEnding() {
-	system("cls");
+	Platform::clearScreen();
 	std::cout << "\n\n";
 
 	// Animated title
@@ -135,7 +133,7 @@ void EndingSystem::displayNormalEnding() {
 }
 
 void EndingSystem::displayTrueEnding() {
-	system("cls");
+	Platform::clearScreen();
 	std::cout << "\n\n";
 
 	// Animated title
@@ -173,7 +171,7 @@ void EndingSystem::displayTrueEnding() {
 void EndingSystem::printAnimatedText(const std::string& text) {
 	for (char c : text) {
 		std::cout << c << std::flush;
-		std::this_thread::sleep_for(std::chrono::milliseconds(15));
+		Platform::sleepFor(15);
 	}
 }
 
@@ -185,7 +183,7 @@ void EndingSystem::printAnimatedTitle(const std::string& title) {
 	std::cout << "  ";
 	for (char c : title) {
 		std::cout << c << std::flush;
-		std::this_thread::sleep_for(std::chrono::milliseconds(50));
+		Platform::sleepFor(50);
 	}
 	std::cout << "\n";
 
@@ -193,8 +191,7 @@ void EndingSystem::printAnimatedTitle(const std::string& title) {
 	std::cout << "  ===============================================================\n";
 }
 
-void EndingSystem::playEndingMusic() {
-	AudioEngine* audio = AudioEngine::getInstance();
+void EndingSystem::playEndingMusic(AudioEngine* audio) {
 	if (audio != nullptr) {
 		audio->stopAllMusic();
 		audio->playBackgroundMusic("Audio\\Music\\ending.wav");
@@ -5,6 +5,8 @@
 #include "Player.h"
 #include "ClueJournal.h"
 
+class AudioEngine;
+
 class EndingSystem {
 public:
 	enum EndingType {
@@ -16,8 +18,8 @@ public:
 	// Determine which ending should be triggered
 	static EndingType determineEnding(bool playerDefeated, bool bossDefeated, Player* player, ClueJournal* journal);
 
-	// Display the appropriate ending
-	static void displayEnding(EndingType type, Player* player, ClueJournal* journal);
+	// Display the appropriate ending (music plays on the session's audio engine)
+	static void displayEnding(AudioEngine* audio, EndingType type, Player* player, ClueJournal* journal);
 
 private:
 	// Individual ending implementations
@@ -28,7 +30,7 @@ private:
 	// Animation helper functions
 	static void printAnimatedText(const std::string& text);
 	static void printAnimatedTitle(const std::string& title);
-	static void playEndingMusic();
+	static void playEndingMusic(AudioEngine* audio);
 	static void printEndingCredits(int endingNumber, const std::string& endingTitle);
 };
 
@@ -1,10 +1,10 @@
 #include "Entity.h"
 
 // Default constructor
-Entity::Entity() : fID(""), fName("") {}
+Entity::Entity() {}
 
 // Parameterized constructor (name only)
-Entity::Entity(const std::string& n) : fID(""), fName(n) {}
+Entity::Entity(const std::string& n) : fName(n) {}
 
 // Parameterized constructor (ID and name)
 Entity::Entity(const std::string& id, const std::string& n) : fID(id), fName(n) {}
@@ -13,12 +13,20 @@ Entity::Entity(const std::string& id, const std::string& n) : fID(id), fName(n)
 Entity::~Entity() {}
 
 // Get entity ID
-std::string Entity::getID() const {
-	return fID;
+const std::string& Entity::getID() const {
+	return fID.str();
 }
 
 // Get entity name
-std::string Entity::getName() const {
+const std::string& Entity::getName() const {
+	return fName.str();
+}
+
+Symbol Entity::getIDSymbol() const {
+	return fID;
+}
+
+Symbol Entity::getNameSymbol() const {
 	return fName;
 }
 
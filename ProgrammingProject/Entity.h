@@ -1,19 +1,26 @@
 #ifndef ENTITY_H
 #define ENTITY_H
+#include "Symbol.h"
 #include <iostream>
 #include <string>
 
 class Entity {
 protected:
-	std::string fID;
-	std::string fName;
+	Symbol fID;
+	Symbol fName;
 public:
 	Entity();
 	Entity(const std::string& n);
 	Entity(const std::string& id, const std::string& n);
+	Entity(const Entity&) = default;
+	Entity(Entity&&) = default;
+	Entity& operator=(const Entity&) = default;
+	Entity& operator=(Entity&&) = default;
 	virtual ~Entity();
-	virtual std::string getID() const;
-	virtual std::string getName() const;
+	virtual const std::string& getID() const;
+	virtual const std::string& getName() const;
+	Symbol getIDSymbol() const; // For comparing: equal exactly when the IDs are
+	Symbol getNameSymbol() const;
 	virtual void displayInformation();
 };
 
@@ -0,0 +1,33 @@
+#include "ExplorationRules.h"
+
+int ExplorationRules::getLootChance(float aScavengeBonus) {
+	int lootChance = BASE_LOOT_CHANCE;
+	if (aScavengeBonus > 0) {
+		lootChance = (int)(BASE_LOOT_CHANCE * (1.0f + aScavengeBonus));
+		if (lootChance > MAX_LOOT_CHANCE) lootChance = MAX_LOOT_CHANCE;
+	}
+	return lootChance;
+}
+
+ExplorationRules::StepEvent ExplorationRules::rollStepEvent(int aLootChance, bool aHasZombies, Random& aRandom) {
+	int eventRoll = aRandom.nextInt(100);
+
+	if (eventRoll < aLootChance) {
+		return StepEvent::LOOT;
+	}
+	if (eventRoll < 80) {
+		return StepEvent::CLUE;
+	}
+	if (eventRoll < 95 && aHasZombies) {
+		return StepEvent::COMBAT;
+	}
+	return StepEvent::HAZARD;
+}
+
+int ExplorationRules::getWaveCount(int aHazardDamage) {
+	return aHazardDamage > 5 ? 2 : 1;
+}
+
+bool ExplorationRules::isBossLocation(std::string_view aLocationID) {
+	return aLocationID == "loc_sanctuary";
+}
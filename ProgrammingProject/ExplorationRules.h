@@ -0,0 +1,39 @@
+#ifndef EXPLORATIONRULES_H
+#define EXPLORATIONRULES_H
+#include "Random.h"
+#include <string_view>
+
+// Exploration rules shared by the exploration screen and the playthrough simulator.
+// Like CombatRules, nothing here prints or waits, and rolls draw in the screen's order.
+class ExplorationRules {
+public:
+	// What a step turns up. With no zombies around, the combat band falls through to a hazard.
+	enum class StepEvent {
+		LOOT,
+		CLUE,
+		COMBAT,
+		HAZARD
+	};
+
+	static const int HUNGER_PER_STEP = 2;
+	static const int STARVING_HUNGER = 10; // At or below this hunger a step costs STARVING_DAMAGE
+	static const int STARVING_DAMAGE = 1;
+	static const int STEPS_TO_EXPLORE = 12; // Steps before the player may travel on
+	static const int REST_HEAL = 25;
+	static const int BASE_LOOT_CHANCE = 45;
+	static const int MAX_LOOT_CHANCE = 70;
+
+	// Loot chance for a step, raised by scavenging skills
+	static int getLootChance(float aScavengeBonus);
+
+	// Roll the step event (45% + bonus loot, then clue up to 80, combat up to 95, hazard)
+	static StepEvent rollStepEvent(int aLootChance, bool aHasZombies, Random& aRandom);
+
+	// Waves per fight at a location (hazardous locations field two)
+	static int getWaveCount(int aHazardDamage);
+
+	// The sanctuary holds the final boss fight
+	static bool isBossLocation(std::string_view aLocationID);
+};
+
+#endif /* EXPLORATIONRULES_H */
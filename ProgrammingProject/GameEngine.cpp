@@ -1,6 +1,6 @@
-#define NOMINMAX
 #include "GameEngine.h"
 #include "GameplayEngine.h"
+#include "GameSession.h"
 #include "Crafting.h"
 #include "CommonInfected.h"
 #include "Boomer.h"
@@ -8,21 +8,28 @@
 #include "Smoker.h"
 #include "Tank.h"
 #include "EndingSystem.h"
+#include "ExplorationRules.h"
+#include "Platform.h"
+#include "ProfileStore.h"
+#include "SaveFile.h"
+#include "SaveIndex.h"
+#include "SaveJournal.h"
+#include "SaveText.h"
+#include "SaveWriter.h"
 #include <iostream>
 #include <limits>
-#include <fstream>
-#include <thread>
-#include <chrono>
 #include <vector>
 #include <cstdio>
-
-// Initialize static member
-GameEngine* GameEngine::instance = nullptr;
+#include <ctime>
 
 // Constructor
-GameEngine::GameEngine() : currentPlayer(nullptr), currentLocation(nullptr),
-	journal(nullptr), currentChapter(1), gameRunning(true),
-	savedExplorationProgress(0), savedMovementSteps(0) {
+GameEngine::GameEngine(GameSession& session, const ContentPack* sharedContent)
+	: session(session), currentPlayer(nullptr), currentLocation(nullptr),
+	journal(nullptr), content(sharedContent != nullptr ? *sharedContent : ownContent),
+	currentChapter(1), gameRunning(true),
+	savedExplorationProgress(0), savedMovementSteps(0), saveWriter(nullptr),
+	journalSlot(0), journalEntries(0), playtimeBaseSeconds(0), playtimeStartMs(Platform::getMilliseconds()),
+	profileStore(nullptr), compressSaves(false) {
 	journal = new ClueJournal();
 }
 
@@ -38,20 +45,25 @@ GameEngine::~GameEngine() {
 		delete journal;
 		journal = nullptr;
 	}
+
+	if (profileStore != nullptr && !profileID.empty()) {
+		profileStore->release(profileID);
+	}
 }
 
-// Get singleton instance
+// Compatibility shim for code written against the singleton
 GameEngine* GameEngine::getInstance() {
-	if (instance == nullptr) {
-		instance = new GameEngine();
-	}
-	return instance;
+	return &GameSession::getDefault()->getGameEngine();
 }
 
 // Initialize the game engine
 bool GameEngine::initialize() {
 	//std::cout << "[ENGINE] Initializing GameEngine...\n";
 	setupConsoleWindow();
+	if (&content == &ownContent && !ownContent.load()) {
+		std::cout << "[ENGINE] Failed to load game content: " << ownContent.getLastError() << "\n";
+		return false;
+	}
 	initializeAllLocations();
 	initializeAllLoreItems();
 	//std::cout << "[ENGINE] Game world initialized with " << allLocations.size() << " locations.\n";
@@ -61,24 +73,10 @@ bool GameEngine::initialize() {
 
 // Setup console window
 void GameEngine::setupConsoleWindow() {
-#ifdef _WIN32
-	HANDLE handle = GetStdHandle(STD_OUTPUT_HANDLE);
-	HWND consoleWindow = GetConsoleWindow();
-
-	if (consoleWindow == NULL || handle == INVALID_HANDLE_VALUE)
-		return;
-
-	// Set buffer size
-	COORD bufferSize = { (SHORT)CONSOLE_WIDTH, (SHORT)CONSOLE_HEIGHT };
-	SetConsoleScreenBufferSize(handle, bufferSize);
-
-	// Set window size (matching buffer)
-	SMALL_RECT windowSize = { 0, 0, (SHORT)(CONSOLE_WIDTH - 1), (SHORT)(CONSOLE_HEIGHT - 1) };
-	SetConsoleWindowInfo(handle, TRUE, &windowSize);
-
-	std::cout << "[ENGINE] Console initialized: "
-		<< CONSOLE_WIDTH << "x" << CONSOLE_HEIGHT << "\n";
-#endif
+	if (Platform::configureConsole(CONSOLE_WIDTH, CONSOLE_HEIGHT)) {
+		std::cout << "[ENGINE] Console initialized: "
+			<< CONSOLE_WIDTH << "x" << CONSOLE_HEIGHT << "\n";
+	}
 }
 
 // Game state management
@@ -105,14 +103,18 @@ ClueJournal* GameEngine::getJournal() {
 	return journal;
 }
 
+const ContentPack& GameEngine::getContentPack() const {
+	return content;
+}
+
 // Location management
 Location* GameEngine::getLocationByID(const std::string& locationID) {
-	for (Location* loc : allLocations) {
-		if (loc->getID() == locationID) {
-			return loc;
-		}
+	// allLocations is built in content pack order, so the pack's index applies directly
+	int index = content.findLocation(locationID);
+	if (index < 0 || index >= static_cast<int>(allLocations.size())) {
+		return nullptr;
 	}
-	return nullptr;
+	return allLocations[index];
 }
 
 std::vector<Location*>& GameEngine::getAllLocations() {
@@ -122,7 +124,7 @@ std::vector<Location*>& GameEngine::getAllLocations() {
 // Story progression
 void GameEngine::displayChapterIntro() {
 	if (currentLocation != nullptr && !currentLocation->isVisited()) {
-		currentLocation->displayChapterIntro();
+		currentLocation->displayChapterIntro(&session.getAudio());
 		currentLocation->markVisited();
 
 		std::cout << "\n\nPress ENTER to continue...";
@@ -155,7 +157,7 @@ bool GameEngine::travelToLocation(const std::string& locationID) {
 		return false;
 	}
 
-	if (!currentLocation->isConnectedTo(locationID)) {
+	if (!currentLocation->isConnectedTo(Symbol::find(locationID))) {
 		std::cout << "[ERROR] Cannot travel to " << locationID << " - not connected.\n";
 		return false;
 	}
@@ -174,9 +176,9 @@ bool GameEngine::travelToLocation(const std::string& locationID) {
 	displayChapterIntro();
 
 	// CRITICAL FIX: Play location-specific music after traveling
-	AudioEngine* audio = AudioEngine::getInstance();
-	if (audio != nullptr && !audio->isInCombatMusic()) {
-		audio->playLocationMusic(locationID);
+	AudioEngine* audio = &session.getAudio();
+	if (!audio->isInCombatMusic()) {
+		audio->playLocationMusic(targetLocation->getIDSymbol());
 	}
 
 	return true;
@@ -192,11 +194,11 @@ void GameEngine::displayTravelOptions() {
 	std::cout << "Available Locations to Travel:\n";
 	std::cout << "========================================\n";
 
-	SinglyLinkedList<std::string>& connections = currentLocation->getConnections();
+	SinglyLinkedList<Symbol>& connections = currentLocation->getConnections();
 	int option = 1;
 
 	for (auto it = connections.begin(); it != connections.end(); ++it) {
-		Location* loc = getLocationByID(*it);
+		Location* loc = getLocationByID(it->str());
 		if (loc != nullptr) {
 			std::string visitedMark = loc->isVisited() ? "[VISITED]" : "[NEW]";
 			std::cout << option++ << ". " << loc->getName()
@@ -222,293 +224,38 @@ Location* GameEngine::createLocation(const std::string& id, const std::string& n
 	return loc;
 }
 
-// Initialize all locations with story chapters
+// Build the live locations from the content pack (one Location per table row, in pack order)
 void GameEngine::initializeAllLocations() {
-	// Chapter 1: Ruined City
-	Location* ruinedCity = createLocation(
-		"loc_ruined_city",
-		"Ruined City",
-		Location::LocationType::CITY,
-		"Collapsed high-rises, burned-out cars, shattered storefronts. Graffiti warns: 'THE WATER KILLED US'.",
-		"Silent except for distant groans. Thin haze of smoke carries the metallic scent of blood.",
-		Location::Hazard::NONE,
-		0,
-		1,
-		"Ruined City: The Awakening",
-		"The city is silent except for the distant groans of the infected. Streets are littered with burnt vehicles, toppled lampposts, and scattered debris. A thin haze of smoke hangs in the air, carrying the faint metallic scent of blood. Graffiti covers walls in frantic handwriting: 'THE WATER KILLED US'. Bodies of the recently deceased are everywhere - some twisted in fear, some in quiet repose, others barely recognizable as human.\n\nYou are Tony Redgrave, a former water treatment engineer. You know the truth behind the outbreak, and every step you take is haunted by the knowledge that human negligence caused this catastrophe. Your goal is The Sanctuary, a fortified settlement with clean water, food, and security - but every mile is a test of survival, morality, and sanity."
-	);
-	// Add zombies to Ruined City
-	ruinedCity->addZombie(new CommonInfected("zombie_city_1", "Common Infected"));
-	ruinedCity->addZombie(new CommonInfected("zombie_city_2", "Common Infected"));
-	allLocations.push_back(ruinedCity);
-
-	// Chapter 2: Industrial District
-	Location* industrial = createLocation(
-		"loc_industrial",
-		"Industrial District",
-		Location::LocationType::INDUSTRIAL,
-		"Rusted factories belching toxic smoke. Green sludge bubbles from cracked containers.",
-		"Smells of chemicals and rust. Occasional boomer patrols the area.",
-		Location::Hazard::TOXIC_FOG,
-		12,  // Increased from 5
-		2,
-		"Industrial District: Toxic Horror",
-		"The Industrial District smells of chemicals and rust. Green sludge bubbles from cracked containers, and grotesque Boomers - obese infected that explode with acid upon death - patrol the area. You must navigate carefully, as detonations attract nearby infected, creating dangerous chain reactions.\n\nScavenging an abandoned warehouse, you find evidence of corporate negligence: 'Dispose of medical waste in river. Cost-effective.' Among the crates, you collect an axe, gas mask, and scrap metal. A Spitter appears in the shadows, hurling acidic bile. The Industrial District is where environmental hazards and zombie types combine, teaching the interplay of combat, stealth, and resource management."
-	);
-	industrial->addZombie(new Boomer("zombie_ind_1", "Boomer"));
-	industrial->addZombie(new Spitter("zombie_ind_2", "Spitter"));
-	allLocations.push_back(industrial);
-
-	// Chapter 3: Hollow Woods
-	Location* hollowWoods = createLocation(
-		"loc_hollow_woods",
-		"Hollow Woods",
-		Location::LocationType::FOREST,
-		"Dense trees with mist drifting between them. Animal carcasses hang from twisted branches.",
-		"Isolation and fear. Nature perished long before humanity fell.",
-		Location::Hazard::DARKNESS,
-		2,
-		3,
-		"Hollow Woods: Isolation and Fear",
-		"The forest looms as you enter the Hollow Woods. Mist drifts between dense trees, and animal carcasses hang from twisted branches - a grim reminder that nature perished long before humanity fell. Here, Common Infected stalk in waves, but Smoker-type infected lurk - tall, emaciated figures with elongated tongues capable of ensnaring survivors from afar.\n\nA hidden campsite provides a hunting rifle, ammo, and a journal reading: 'The animals died first. Then the people. Now it's just waiting. Sometimes I swear I hear them whispering my name.' The journal hints at the psychological toll of isolation. A lone survivor corpse presents a choice: loot the supplies or bury the body, restoring a sliver of your mental state."
-	);
-	hollowWoods->addZombie(new CommonInfected("zombie_woods_1", "Common Infected"));
-	hollowWoods->addZombie(new Smoker("zombie_woods_2", "Smoker"));
-	allLocations.push_back(hollowWoods);
-
-	// Chapter 4: Old Mill
-	Location* oldMill = createLocation(
-		"loc_old_mill",
-		"Old Mill",
-		Location::LocationType::INDUSTRIAL,
-		"Creaking floors and rotting wood. Smells of mildew and blood.",
-		"Monument to human despair. Tank infected dominates the upper floors.",
-		Location::Hazard::COLLAPSED_FLOOR,
-		18,  // Increased from 10
-		4,
-		"Old Mill: The Butcher Awaits",
-		"The Old Mill stands as a monument to human despair. Floors creak underfoot, and rotting wood smells of mildew and blood. A Tank - massive and unstoppable - dominates the upper floors, wielding a cleaver-like weapon. This is your first boss encounter.\n\nThe Mill contains a hidden lore item: The Butcher's Family Photo and Note, written in trembling ink: 'I couldn't save them.' The note forces you to confront human tragedy firsthand. Rescue attempts or mercy kills are possible but carry consequences. Defeating the Tank grants rare medkits, antibiotics, and a splint - a tangible reward for overcoming both fear and moral distress."
-	);
-	oldMill->addZombie(new Tank("zombie_mill_boss", "The Butcher"));
-	allLocations.push_back(oldMill);
-
-	// Chapter 5: Overgrown Cemetery
-	Location* cemetery = createLocation(
-		"loc_cemetery",
-		"Overgrown Cemetery",
-		Location::LocationType::SANCTUARY,
-		"Toppled tombstones. Fog hangs thick. Sound of clawing from beneath the soil.",
-		"Death is not peace. Fresh graves disturbed.",
-		Location::Hazard::NONE,
-		0,
-		5,
-		"Overgrown Cemetery: Death Is Not Peace",
-		"Fog hangs thick among toppled tombstones. The sound of clawing from beneath the soil heralds the ambush of Common Infected, rising from freshly disturbed graves. Your senses are on high alert.\n\nThe Gravedigger's Diary reads: 'We buried them too soon. They came back.' The diary expands the lore, showing how desperate survivors attempted containment, only to fail. You find a shotgun, shells, gasoline, and cloth - but the true treasure is the Gate Key to the Sanctuary, hidden in an unmarked grave. A symbol of hope amidst despair."
-	);
-	cemetery->addZombie(new CommonInfected("zombie_cem_1", "Risen Corpse"));
-	cemetery->addZombie(new CommonInfected("zombie_cem_2", "Risen Corpse"));
-	allLocations.push_back(cemetery);
-
-	// Chapter 6: Polluted Canal
-	Location* canal = createLocation(
-		"loc_canal",
-		"Polluted Canal",
-		Location::LocationType::INDUSTRIAL,
-		"Industrial runoff colors the stagnant canal neon green. Walking through it risks infection.",
-		"Toxic waters eat away at flesh and stamina.",
-		Location::Hazard::CONTAMINATED_WATER,
-		15,  // Increased from 8
-		6,
-		"Polluted Canal: Toxic Waters",
-		"Industrial runoff colors the stagnant canal neon green. Walking through it risks infection, as toxins eat away at flesh and stamina. Bizarrely mutated Boomers wade through the sludge, and Spitters lurk along the edges, spraying acidic bile with deadly precision.\n\nYou salvage Water Purification Tablets and a gas mask filter. You find the Government Containment Report: 'Containment failed. Virus waterborne. All quarantine efforts collapsed.' The report adds political and systemic dimensions to the narrative - human negligence at a scale too great to ignore."
-	);
-	canal->addZombie(new Boomer("zombie_canal_1", "Toxic Boomer"));
-	canal->addZombie(new Spitter("zombie_canal_2", "Canal Spitter"));
-	allLocations.push_back(canal);
-
-	// Chapter 7: Pump Station
-	Location* pumpStation = createLocation(
-		"loc_pump_station",
-		"Pump Station",
-		Location::LocationType::INDUSTRIAL,
-		"Your former workplace. Corpses of colleagues in hazmat suits litter the floors.",
-		"The truth revealed. This is where it all began.",
-		Location::Hazard::TOXIC_FOG,
-		14,  // Increased from 6
-		7,
-		"Pump Station: The Truth Revealed",
-		"At the Pump Station, you face the truth: this was your workplace. Corpses of colleagues in hazmat suits litter the floors. Your own workstation note reads: 'I should have stopped them.' Here, a moral choice presents itself: activate a failsafe to purify water for future survivors, or escape to preserve personal survival.\n\nThe area contains medkits, antibiotics, and ammo, but every second is contested by Common Infected and the occasional Smoker, forcing strategic prioritization of threats. The weight of your past decisions bears down on you."
-	);
-	pumpStation->addZombie(new CommonInfected("zombie_pump_1", "Infected Worker"));
-	pumpStation->addZombie(new Smoker("zombie_pump_2", "Smoker"));
-	allLocations.push_back(pumpStation);
-
-	// Chapter 8: Suburban Wasteland
-	Location* suburban = createLocation(
-		"loc_suburban",
-		"Suburban Wasteland",
-		Location::LocationType::SUBURBAN,
-		"Families' lives interrupted mid-day: toys scattered, minivans crashed into garages.",
-		"Human tragedy frozen in time.",
-		Location::Hazard::NONE,
-		0,
-		8,
-		"Suburban Wasteland: Human Tragedy",
-		"The Suburban Wasteland shows families' lives interrupted mid-day: toys scattered, minivans crashed into garages. Zombies, primarily Common Infected, are present in large numbers. Some families are partially infected - you face harrowing moral decisions: fight or flee, loot or leave provisions.\n\nIn the Great Fields beyond, open grasslands reveal the scale of human collapse. Hordes of infected, including Boomers and Spitters, roam the fields, forcing strategic combat choices. The Farmer's Suicide Note reads: 'There's nothing left to grow. We tried. I failed.'"
-	);
-	suburban->addZombie(new CommonInfected("zombie_sub_1", "Suburban Infected"));
-	suburban->addZombie(new CommonInfected("zombie_sub_2", "Suburban Infected"));
-	suburban->addZombie(new Boomer("zombie_sub_3", "Bloated Infected"));
-	allLocations.push_back(suburban);
-
-	// Chapter 9: Abandoned Hospital
-	Location* hospital = createLocation(
-		"loc_hospital",
-		"Abandoned Hospital",
-		Location::LocationType::HOSPITAL,
-		"Multi-story nightmare. Flickering lights illuminate biohazard signs and abandoned gurneys.",
-		"Medical horror. Origins of catastrophe revealed.",
-		Location::Hazard::DARKNESS,
-		3,
-		9,
-		"Abandoned Hospital: Origins of Catastrophe",
-		"The hospital is a multi-story nightmare. Flickering lights illuminate biohazard signs and abandoned gurneys. Here, you encounter Patient Zero - a unique boss infected, surrounded by staff who are themselves Common Infected. Defeating Patient Zero yields antibiotics, medkits, and the Doctor's Audio Recording: 'Patient Zero was exposed at the water plant. We failed everyone.'\n\nIn the nearby Quarantine Zone, military failure is evident. Armed infected soldiers, now Common Infected, roam abandoned checkpoints. The Military Orders provide chilling insight: 'Shoot on sight. No exceptions.' The full scope of humanity's collapse is laid bare."
-	);
-	hospital->addZombie(new Tank("zombie_hosp_boss", "Patient Zero"));
-	hospital->addZombie(new CommonInfected("zombie_hosp_1", "Infected Doctor"));
-	hospital->addZombie(new CommonInfected("zombie_hosp_2", "Infected Nurse"));
-	allLocations.push_back(hospital);
-
-	// Chapter 10: The Sanctuary
-	Location* sanctuary = createLocation(
-		"loc_sanctuary",
-		"The Sanctuary",
-		Location::LocationType::SANCTUARY,
-		"A walled settlement with gardens, generators, and survivors. Entry requires the Gate Key.",
-		"Fragile hope. The end of your journey, or a new beginning.",
-		Location::Hazard::NONE,
-		0,
-		10,
-		"The Sanctuary: Fragile Hope",
-		"You approach The Sanctuary, a walled settlement with gardens, generators, and survivors. Entry requires the Gate Key you found in the cemetery. Here, the truth is laid bare: corporate greed and government negligence caused the outbreak.\n\nYou face the ultimate moral choice: stay and help rebuild, leave to wander the wasteland, sabotage the water system, or broadcast the truth to the wider survivor community. Your journey has brought you here, but the question remains: what kind of survivor will you be?"
-	);
-	allLocations.push_back(sanctuary);
-
-	// Create connections (graph structure)
-	// Chapter progression path
-	ruinedCity->addConnection("loc_industrial");
-	industrial->addConnection("loc_ruined_city");
-	industrial->addConnection("loc_hollow_woods");
-	hollowWoods->addConnection("loc_industrial");
-	hollowWoods->addConnection("loc_old_mill");
-	oldMill->addConnection("loc_hollow_woods");
-	oldMill->addConnection("loc_cemetery");
-	cemetery->addConnection("loc_old_mill");
-	cemetery->addConnection("loc_canal");
-	canal->addConnection("loc_cemetery");
-	canal->addConnection("loc_pump_station");
-	pumpStation->addConnection("loc_canal");
-	pumpStation->addConnection("loc_suburban");
-	suburban->addConnection("loc_pump_station");
-	suburban->addConnection("loc_hospital");
-	hospital->addConnection("loc_suburban");
-	hospital->addConnection("loc_sanctuary");
-	sanctuary->addConnection("loc_hospital");
+	allLocations.reserve(content.getLocationCount());
+	for (int i = 0; i < content.getLocationCount(); ++i) {
+		const ContentPack::LocationEntry& entry = content.getLocation(i);
+		Location* loc = createLocation(entry.id, entry.name, entry.type, entry.description,
+			entry.atmosphere, entry.hazard, entry.hazardDamage,
+			entry.chapterNumber, entry.chapterTitle, entry.chapterStory);
+
+		for (const ContentPack::ZombieEntry& zombie : content.getZombies(i)) {
+			loc->addZombie(ContentPack::createZombie(zombie));
+		}
+		for (const std::string& targetID : content.getConnections(i)) {
+			loc->addConnection(Symbol(targetID));
+		}
+		allLocations.push_back(loc);
+	}
 
 	// Set starting location
-	setCurrentLocation(ruinedCity);
+	setCurrentLocation(getLocationByID(content.getStartLocationID()));
 }
 
-// Initialize all 52 lore items
+// Register every lore item from the content pack with the journal
 void GameEngine::initializeAllLoreItems() {
-	// Add all 52 lore items to the journal
-	// Format: Clue(id, name, content, location, effect)
-
-	// Ruined City clues (1-5)
-	journal->addClue(Clue(1, "City Engineer's Journal", "Day 1: They knew the water was contaminated. They did nothing. If anyone reads this, know I tried. We failed.", "Ruined City", "Story insight: origin of outbreak, moral weight"));
-	journal->addClue(Clue(2, "Graffiti: THE WATER KILLED US", "Spray-painted on a crumbling wall, faded but readable. Fear and warning for anyone who enters.", "Ruined City", "Story hint, sets tone"));
-	journal->addClue(Clue(3, "Apartment Scrawled Note", "We hid in the apartment. They came anyway. I hope whoever finds this survives longer than we did.", "Ruined City", "Mental state +5 (empathy)"));
-	journal->addClue(Clue(4, "Grocery Store Ledger", "Lists spoiled and missing food items, dated Day 2 of the outbreak.", "Ruined City", "Loot hint, story detail"));
-	journal->addClue(Clue(5, "Crowbar Engraving", "Etched letters on crowbar: 'For survival.'", "Ruined City", "Minor morale boost"));
-
-	// Industrial District clues (6-10)
-	journal->addClue(Clue(6, "Industrial Memo", "Dispose of medical waste in river. Cost-effective. Safety is secondary to profits.", "Industrial District", "Story insight: corporate negligence"));
-	journal->addClue(Clue(7, "Toxic Drum Label", "Warning: Corrosive. Handle with care.", "Industrial District", "Environmental storytelling"));
-	journal->addClue(Clue(8, "Warehouse Blueprint", "Sketches of warehouse layout, showing supply routes.", "Industrial District", "Crafting hint (location of loot)"));
-	journal->addClue(Clue(9, "Smoker Observation Log", "Notes: Acidic excretions may incapacitate prey. Avoid direct contact.", "Industrial District", "Combat hint: Smoker behavior"));
-	journal->addClue(Clue(10, "Boomer Corpse Notes", "Scribbled on wall near exploded Boomer: 'Fatty won't stop anyone alive.'", "Industrial District", "Story flavor, horror immersion"));
-
-	// Hollow Woods clues (11-15)
-	journal->addClue(Clue(11, "Hiker's Journal", "The animals died first. Then the people. Now it's just waiting. Sometimes I swear I hear it whispering my name.", "Hollow Woods", "Mental state impact, story depth"));
-	journal->addClue(Clue(12, "Hidden Campsite Ledger", "Lists survival items and recipes for basic crafting.", "Hollow Woods", "Crafting hint"));
-	journal->addClue(Clue(13, "Tree Carving", "SARA + JIM = SAFE scratched into bark.", "Hollow Woods", "Emotional story hint"));
-	journal->addClue(Clue(14, "Survivor Corpse Letter", "If you find this, take my food, but don't forget us.", "Hollow Woods", "Moral choice: bury or loot"));
-	journal->addClue(Clue(15, "Hunting Rifle Notes", "Clean and oil regularly, it might save your life.", "Hollow Woods", "Weapon tip"));
-
-	// Old Mill clues (16-19)
-	journal->addClue(Clue(16, "The Butcher's Family Photo", "I couldn't save them. Photo shows family smiling, a cruel reminder.", "Old Mill", "Story insight, emotional weight"));
-	journal->addClue(Clue(17, "Mill Floor Graffiti", "Death waits above. Don't trust the creak.", "Old Mill", "Atmospheric storytelling"));
-	journal->addClue(Clue(18, "Cleaver Scrap Notes", "Mechanics notes, how to sharpen or maintain the cleaver.", "Old Mill", "Weapon upgrade hint"));
-	journal->addClue(Clue(19, "Mercy-Kill Choice Prompt", "The survivor begs. Will you end their suffering?", "Old Mill", "Moral choice, mental state"));
-
-	// Overgrown Cemetery clues (20-22)
-	journal->addClue(Clue(20, "Gravedigger's Diary", "We buried them too soon. They came back. I can't sleep. They claw at the graves.", "Overgrown Cemetery", "Story insight, mental state -10"));
-	journal->addClue(Clue(21, "Tombstone Messages", "Names and dates of victims, some scratched with warnings.", "Overgrown Cemetery", "Environmental storytelling"));
-	journal->addClue(Clue(22, "Cemetery Gate Key", "Hidden in an unmarked grave.", "Overgrown Cemetery", "Unlocks Sanctuary, story progression"));
-
-	// Polluted Canal clues (23-25)
-	journal->addClue(Clue(23, "Gas Mask Filter Notes", "Replace every 5 hours. Sludge will kill you if you ignore it.", "Polluted Canal", "Survival hint"));
-	journal->addClue(Clue(24, "Contaminated Water Journal", "Tasted it once… fever came two hours later. Don't make the same mistake.", "Polluted Canal", "Infection awareness"));
-	journal->addClue(Clue(25, "Government Containment Report", "Containment failed. Virus waterborne. All quarantine efforts collapsed.", "Polluted Canal", "Story insight, expands world lore"));
-
-	// Pump Station clues (26-29)
-	journal->addClue(Clue(26, "Tony's Workstation Note", "I should have stopped them. I signed off on the protocols, ignored the signs. Everything we knew was ignored.", "Pump Station", "Story insight, moral weight"));
-	journal->addClue(Clue(27, "Hazmat Suit Remnants", "Torn suits with initials.", "Pump Station", "Environmental storytelling, possible loot"));
-	journal->addClue(Clue(28, "Emergency Cache List", "Antibiotics x3, Medkits x2, Ammo x20.", "Pump Station", "Loot hint"));
-	journal->addClue(Clue(29, "Survivor Message on Control Panel", "If anyone finds this… finish what we started.", "Pump Station", "Story motivation"));
-
-	// Suburban Wasteland clues (30-35)
-	journal->addClue(Clue(30, "Parent's Diary", "We waited for help. It never came. Our children were scared. We failed them.", "Suburban Wasteland", "Emotional weight, mental state impact"));
-	journal->addClue(Clue(31, "Toy Soldier Collection", "Scattered on the floor.", "Suburban Wasteland", "Environmental storytelling, nostalgia"));
-	journal->addClue(Clue(32, "Locked Basement Note", "Supplies hidden here. Keep quiet.", "Suburban Wasteland", "Loot hint"));
-	journal->addClue(Clue(33, "Farmer's Suicide Note", "There's nothing left to grow. The land is dead. I am too.", "Great Fields", "Emotional story, moral weight"));
-	journal->addClue(Clue(34, "Barn Ledger", "Lists remaining food and ammo caches.", "Great Fields", "Crafting/loot hint"));
-	journal->addClue(Clue(35, "Horde Warning Chalk Marks", "X marks drawn on barn walls: 'DO NOT ENTER – THEY ARE EVERYWHERE.'", "Great Fields", "Combat hint"));
-
-	// Railway Station clues (36-38)
-	journal->addClue(Clue(36, "Evacuation Manifest", "10,000 boarded. 3 trains left. Most never reached safety.", "Railway Station", "Story insight"));
-	journal->addClue(Clue(37, "Luggage Tags", "Names of people who fled.", "Railway Station", "Environmental storytelling"));
-	journal->addClue(Clue(38, "Platform Graffiti", "All hope gone. Don't trust anyone.", "Railway Station", "Tone-setting, immersion"));
-
-	// River Crossing clues (39-41)
-	journal->addClue(Clue(39, "Riverside Cabin Note", "Raft materials stored here. Be careful of patrols.", "River Crossing", "Crafting hint"));
-	journal->addClue(Clue(40, "Rope & Wood Logs", "Bundled and ready for building raft.", "River Crossing", "Crafting materials"));
-	journal->addClue(Clue(41, "Flare Gun Note", "Use only if absolutely necessary. Might attract infected.", "River Crossing", "Survival choice"));
-
-	// Abandoned Hospital clues (42-45)
-	journal->addClue(Clue(42, "Patient Zero Observation Report", "Highly infectious. Avoid contact. Use any means necessary.", "Abandoned Hospital", "Story insight, boss context"));
-	journal->addClue(Clue(43, "Doctor's Audio Recording", "Patient Zero was exposed at the water plant. We failed everyone.", "Abandoned Hospital", "Story insight"));
-	journal->addClue(Clue(44, "Surgery Kit Label", "One chance to remove infection. Handle carefully.", "Abandoned Hospital", "Gameplay item, rare survival tool"));
-	journal->addClue(Clue(45, "Hospital Gurney Notes", "Staff tried to secure patients. Supplies ran out.", "Abandoned Hospital", "Story flavor"));
-
-	// Quarantine Zone clues (46-48)
-	journal->addClue(Clue(46, "Military Orders", "Shoot on sight. No exceptions. Humanity is a lost cause.", "Quarantine Zone", "Story insight, world-building"));
-	journal->addClue(Clue(47, "Abandoned MREs Label", "Dates show supplies expired days before collapse.", "Quarantine Zone", "Survival hint"));
-	journal->addClue(Clue(48, "Assault Rifle Manual", "Loaded and maintained. Might be the difference between life and death.", "Quarantine Zone", "Weapon tip"));
-
-	// Sanctuary Approach clues (49-52)
-	journal->addClue(Clue(49, "Sanctuary Gate Map", "Shows layout and key access points. Handle with caution.", "Sanctuary Approach", "Unlock / story hint"));
-	journal->addClue(Clue(50, "Survivor Graffiti Messages", "We made it this far. Don't let them take it from us.", "Sanctuary Approach", "Tone-setting, hope"));
-	journal->addClue(Clue(51, "Boomer Corpse Wall Etching", "Warning: bigger ones will explode. Stay back.", "Industrial & Great Fields", "Combat hint"));
-	journal->addClue(Clue(52, "Smoker Snare Notes", "Tongue can pull a survivor into danger. Watch your flanks.", "Hollow Woods & Pump Station", "Combat hint"));
+	for (const ContentPack::LoreEntry& lore : content.getLore()) {
+		journal->addClue(Clue(lore.clueID, lore.name, lore.content, lore.location, lore.effect));
+	}
 }
 
-// Cleanup and destroy singleton
+// Compatibility shim for code written against the singleton
 void GameEngine::destroyInstance() {
-	if (instance != nullptr) {
-		delete instance;
-		instance = nullptr;
-	}
+	GameSession::destroyDefault();
 }
 
 // ============================================================================
@@ -516,11 +263,7 @@ void GameEngine::destroyInstance() {
 // ============================================================================
 
 void clearConsole() {
-#ifdef _WIN32
-	system("cls");
-#else
-	system("clear");
-#endif
+	Platform::clearScreen();
 }
 
 void centerText(const std::string& text) {
@@ -590,7 +333,7 @@ Player* GameEngine::createCharacter() {
 	centerText("Welcome, " + newPlayer->getName() + "!\n");
 	std::cout << "\n";
 
-	std::this_thread::sleep_for(std::chrono::milliseconds(1500));
+	Platform::sleepFor(1500);
 
 	return newPlayer;
 }
@@ -687,11 +430,11 @@ void GameEngine::handleMenuChoice(int choice, Player* player, bool& running) {
 
 			if (travelChoice > 0) {
 				// Get the location ID from connections
-				SinglyLinkedList<std::string>& connections = currentLoc->getConnections();
+				SinglyLinkedList<Symbol>& connections = currentLoc->getConnections();
 				int count = 1;
 				for (auto it = connections.begin(); it != connections.end(); ++it) {
 					if (count == travelChoice) {
-						travelToLocation(*it);
+						travelToLocation(it->str());
 						break;
 					}
 					count++;
@@ -780,38 +523,53 @@ void GameEngine::handleMenuChoice(int choice, Player* player, bool& running) {
 // ============================================================================
 
 void GameEngine::displaySaveSlots() {
+	if (!selectProfile()) {
+		return; // selectSaveSlot offers no slots either
+	}
+	if (saveWriter != nullptr) {
+		saveWriter->flush(getSaveIndexPath()); // List what the slots will hold, not what they held
+	}
+
+	// One small read; the slots themselves are only opened to rebuild a missing index
+	std::vector<SaveIndex::Entry> entries;
+	if (!SaveIndex::load(getSaveIndexPath(), entries)) {
+		entries = rebuildSaveIndex();
+	}
+
 	std::cout << "\n";
 	centerText("Available Save Slots:\n");
 	std::cout << "\n";
 
-	for (int i = 1; i <= 10; i++) {
-		std::string filename = "save_slot_" + std::to_string(i) + ".txt";
-		std::ifstream file(filename);
-
+	// The shared slots, then any occupied past them (a profile's empty slots are not listed)
+	size_t next = 0;
+	for (int i = 1; i <= getSaveSlotCount(); i++) {
 		std::string slotInfo = std::to_string(i) + ". ";
-		if (file.is_open()) {
-			std::string playerName, playerID, locationID;
-			int level;
-			
-			// Read save file data
-			std::getline(file, playerName);  // Line 1: Player name
-			std::getline(file, playerID);    // Line 2: Player ID
-			file >> level;                   // Line 3: Level
-			file.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-			file.ignore(std::numeric_limits<std::streamsize>::max(), '\n'); // Skip damage
-			file.ignore(std::numeric_limits<std::streamsize>::max(), '\n'); // Skip health
-			file.ignore(std::numeric_limits<std::streamsize>::max(), '\n'); // Skip max health
-			std::getline(file, locationID);  // Line 7: Location ID
-			
-			// Get location name from ID
-			std::string locationName = "Unknown";
-			Location* loc = getLocationByID(locationID);
-			if (loc != nullptr) {
-				locationName = loc->getName();
+		while (next < entries.size() && entries[next].slot < i) {
+			next++;
+		}
+		bool occupied = next < entries.size() && entries[next].slot == i;
+		if (i > SHARED_SAVE_SLOTS && !occupied) {
+			if (next == entries.size()) {
+				break;
+			}
+			i = entries[next].slot - 1;
+			continue;
+		}
+
+		if (occupied) {
+			const SaveIndex::Entry& entry = entries[next];
+			int minutes = entry.playtimeSeconds / 60;
+			slotInfo += "[OCCUPIED] " + entry.playerName + " Lvl" + std::to_string(entry.level)
+				+ " - Map: " + entry.locationName + " - Ch" + std::to_string(entry.chapter)
+				+ " - " + std::to_string(minutes / 60) + "h" + (minutes % 60 < 10 ? "0" : "") + std::to_string(minutes % 60) + "m";
+			if (entry.savedAt > 0) {
+				char date[32];
+				std::time_t savedAt = static_cast<std::time_t>(entry.savedAt);
+				std::tm* local = std::localtime(&savedAt);
+				if (local != nullptr && std::strftime(date, sizeof(date), "%Y-%m-%d %H:%M", local) > 0) {
+					slotInfo += std::string(" - ") + date;
+				}
 			}
-			
-			slotInfo += "[OCCUPIED] " + playerName + " Lvl" + std::to_string(level) + " - Map: " + locationName;
-			file.close();
 		}
 		else {
 			slotInfo += "[EMPTY]";
@@ -820,10 +578,47 @@ void GameEngine::displaySaveSlots() {
 		centerText(slotInfo + "\n");
 	}
 
+	if (getSaveSlotCount() > SHARED_SAVE_SLOTS) {
+		std::cout << "\n";
+		centerText("Any slot from 1 to " + std::to_string(getSaveSlotCount()) + " can be used.\n");
+	}
 	std::cout << "\n";
 }
 
+std::vector<SaveIndex::Entry> GameEngine::rebuildSaveIndex() const {
+	std::vector<SaveIndex::Entry> entries;
+	for (int i = 1; i <= getSaveSlotCount(); i++) {
+		bool occupied = false;
+
+		// A binary save is read in place: only the header, player and progress records are touched
+		SaveData summary;
+		SaveFile saveFile;
+		std::string error;
+		if (saveFile.open(getSaveSlotPath(i), error)) {
+			occupied = saveFile.readSummary(summary);
+			if (occupied && SaveJournal::hasEntries(getJournalPath(i), saveFile.getChecksum())) {
+				// The journal may have moved the player on since the snapshot
+				int journalLength = 0;
+				occupied = readSaveSlot(i, summary, journalLength);
+			}
+		}
+		else {
+			occupied = SaveText::readLegacy(getLegacySaveSlotPath(i), summary);
+		}
+
+		if (occupied) {
+			entries.push_back(SaveIndex::describe(i, summary, 0));
+		}
+	}
+	SaveIndex::write(getSaveIndexPath(), entries);
+	return entries;
+}
+
 int GameEngine::selectSaveSlot(bool isLoading) {
+	if (profileStore != nullptr && profileID.empty()) {
+		return 0; // No profile to hold the slots
+	}
+
 	std::cout << "\n";
 	if (isLoading) {
 		centerText("Enter slot number to load (0 to cancel, -1 to delete): ");
@@ -836,7 +631,7 @@ int GameEngine::selectSaveSlot(bool isLoading) {
 	std::cin >> slot;
 	std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
 
-	if (slot < -1 || slot > 10) {
+	if (slot < -1 || slot > getSaveSlotCount()) {
 		centerText("[ERROR] Invalid slot number.\n");
 		return 0;
 	}
@@ -848,7 +643,7 @@ int GameEngine::selectSaveSlot(bool isLoading) {
 		std::cin >> deleteSlot;
 		std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
 
-		if (deleteSlot > 0 && deleteSlot <= 10) {
+		if (deleteSlot > 0 && deleteSlot <= getSaveSlotCount()) {
 			if (deleteSaveSlot(deleteSlot)) {
 				centerText("[SUCCESS] Save slot " + std::to_string(deleteSlot) + " deleted.\n");
 			}
@@ -862,301 +657,247 @@ int GameEngine::selectSaveSlot(bool isLoading) {
 	return slot;
 }
 
-bool GameEngine::saveGame(Player* player, int slotNumber) {
-	if (player == nullptr || slotNumber < 1 || slotNumber > 10) {
-		return false;
+std::string GameEngine::getSaveSlotPath(int slotNumber) const {
+	return getSaveDirectory() + "save_slot_" + std::to_string(slotNumber) + ".sav";
+}
+
+std::string GameEngine::getJournalPath(int slotNumber) const {
+	return getSaveDirectory() + "save_slot_" + std::to_string(slotNumber) + ".journal";
+}
+
+std::string GameEngine::getLegacySaveSlotPath(int slotNumber) const {
+	return getSaveDirectory() + "save_slot_" + std::to_string(slotNumber) + ".txt";
+}
+
+std::string GameEngine::getSaveIndexPath() const {
+	return getSaveDirectory() + "save_index.dat";
+}
+
+int GameEngine::getSaveSlotCount() const {
+	return profileStore != nullptr ? ProfileStore::MAX_SLOTS : SHARED_SAVE_SLOTS;
+}
+
+std::string GameEngine::getSaveDirectory() const {
+	return profileStore != nullptr ? profileStore->getDirectory(profileID) : saveDirectory;
+}
+
+bool GameEngine::selectProfile() {
+	if (profileStore == nullptr || !profileID.empty()) {
+		return true;
 	}
 
-	std::string filename = "save_slot_" + std::to_string(slotNumber) + ".txt";
-	std::ofstream file(filename);
+	std::cout << "\n";
+	centerText("Enter your player ID (letters, digits, - or _): ");
+	std::string input;
+	std::getline(std::cin, input);
 
-	if (!file.is_open()) {
+	std::string id = ProfileStore::normalizeId(input);
+	if (id.empty()) {
+		centerText("[ERROR] Invalid player ID.\n");
 		return false;
 	}
+	if (!profileStore->claim(id)) {
+		centerText("[ERROR] That player ID is in use by another game.\n");
+		return false;
+	}
+	if (!profileStore->prepare(id)) {
+		profileStore->release(id);
+		centerText("[ERROR] Could not open the save profile.\n");
+		return false;
+	}
+	profileID = id;
+	return true;
+}
 
-	try {
-		// Save player data
-		file << player->getName() << "\n";
-		file << player->getID() << "\n";
-		file << player->getLevel() << "\n";
-		file << player->getDamage() << "\n";
-		file << player->getHealth() << "\n";
-		file << player->getMaxHealth() << "\n";
-
-		// Save current location (get from GameplayEngine as it's the authoritative source)
-		GameplayEngine* gameplay = GameplayEngine::getInstance();
-		Location* activeLocation = gameplay->getCurrentLocation();
-		if (activeLocation != nullptr) {
-			file << activeLocation->getID() << "\n";
-			file << activeLocation->getName() << "\n";  // NEW: Save location name
-			file << (activeLocation->isVisited() ? 1 : 0) << "\n";
-		}
-		else if (currentLocation != nullptr) {
-			file << currentLocation->getID() << "\n";
-			file << currentLocation->getName() << "\n";  // NEW: Save location name
-			file << (currentLocation->isVisited() ? 1 : 0) << "\n";
-		}
-		else {
-			file << "loc_ruined_city\n";
-			file << "Ruined City\n";  // NEW: Default location name
-			file << "0\n";
-		}
-
-		// Save current chapter
-		file << currentChapter << "\n";
-
-		// Save exploration progress
-		file << gameplay->getExplorationProgress() << "\n";
-		file << gameplay->getMovementSteps() << "\n";
-
-		// Save player equipped weapon
-		file << player->getEquippedWeapon() << "\n";
-
-		// Save player XP and skill points
-		file << player->getExperience() << "\n";
-		file << player->getSkillPoints() << "\n";
-
-		// Save inventory count
-		file << player->getInventorySize() << "\n";
-
-		// Save each item in inventory
-		SinglyLinkedList<Item>& inventory = player->getInventory();
-		for (auto it = inventory.begin(); it != inventory.end(); ++it) {
-			const Item& item = *it;
-			file << item.getID() << "|"
-				<< item.getName() << "|"
-				<< static_cast<int>(item.getCategory()) << "|"
-				<< item.getDescription() << "|"
-				<< item.getQuantity() << "|"
-				<< item.getInventorySpace() << "|"
-				<< item.isConsumable() << "|"
-				<< item.isUsable() << "|"
-				<< item.getHealthRestore() << "|"
-				<< item.getHungerRestore() << "|"
-				<< item.getInfectionCure() << "|"
-				<< item.getDamageBoost() << "\n";
+bool GameEngine::readSaveSlot(int slotNumber, SaveData& data, int& entries) const {
+	SaveFile saveFile;
+	std::string error;
+	if (saveFile.open(getSaveSlotPath(slotNumber), error)) {
+		if (!saveFile.read(data)) {
+			return false;
 		}
-
-		// Save picked up loot status
-		file << gameplay->getPickedUpLootCount() << "\n";
-		for (const auto& lootID : gameplay->getPickedUpLootIDs()) {
-			file << lootID << "\n";
+		bool intact = true;
+		entries = SaveJournal::replay(getJournalPath(slotNumber), saveFile.getChecksum(), data, intact);
+		if (!intact) {
+			entries = -1;
 		}
+		return true;
+	}
+	// Upgrade path: the slot is rewritten in the binary format on its next save
+	entries = -1;
+	return SaveText::readLegacy(getLegacySaveSlotPath(slotNumber), data);
+}
 
-		// Save collected clues
-		int collectedCount = journal->getCollectedClueCount();
-		file << collectedCount << "\n";
-		// std::cout << "[SAVE DEBUG] Saving " << collectedCount << " collected clues\n";
-		for (int clueID : journal->getCollectedClueIDs()) {
-			file << clueID << "\n";
-			// std::cout << "[SAVE DEBUG] Saved clue ID: " << clueID << "\n";
-		}
+bool GameEngine::saveGame(Player* player, int slotNumber) {
+	if (player == nullptr || slotNumber < 1 || slotNumber > getSaveSlotCount()) {
+		return false;
+	}
 
-		// Save unlocked skills
-		std::vector<std::string> skillIDs;
-		std::vector<int> skillLevels;
-		player->getSkillTree().getUnlockedSkillData(skillIDs, skillLevels);
-		file << skillIDs.size() << "\n";
-		for (size_t i = 0; i < skillIDs.size(); i++) {
-			file << skillIDs[i] << "|" << skillLevels[i] << "\n";
-		}
+	SaveData data;
+	data.capture(*player, session.getGameplayEngine(), *journal, currentLocation, currentChapter);
+	data.progress.playtimeSeconds = playtimeBaseSeconds
+		+ static_cast<int>((Platform::getMilliseconds() - playtimeStartMs) / 1000);
+	data.referenceContent(content);
+
+	// Changes since this game last wrote the slot go to its journal; anything else is a snapshot
+	SaveSlotWrite write;
+	write.path = getSaveSlotPath(slotNumber);
+	bool earlierWritesOk = saveWriter == nullptr || !saveWriter->takeFailure(write.path);
+	write.journalPath = getJournalPath(slotNumber);
+	write.indexPath = getSaveIndexPath();
+	write.slot = slotNumber;
+	write.compress = compressSaves;
+	write.delta = earlierWritesOk && slotNumber == journalSlot && journalEntries < SaveJournal::COMPACT_AFTER;
+	if (write.delta) {
+		write.base = std::move(journalState);
+		journalEntries++;
+	}
+	else {
+		write.supersededPath = getLegacySaveSlotPath(slotNumber); // The slot is binary now
+		journalEntries = 0;
+	}
+	write.data = data;
+	journalState = std::move(data);
+	journalSlot = slotNumber;
 
-		file.close();
-		return true;
+	if (saveWriter != nullptr) {
+		saveWriter->submit(std::move(write));
+		return earlierWritesOk; // An earlier failure is reported now; this save is queued regardless
 	}
-	catch (...) {
-		file.close();
+	if (!write.perform()) {
+		journalSlot = 0;
 		return false;
 	}
+	return true;
+}
+
+void GameEngine::autosave(Player* player) {
+	if (journalSlot > 0 && !saveGame(player, journalSlot)) {
+		std::cout << "\n  [ERROR] Autosave to slot " << journalSlot << " failed.\n";
+	}
 }
 
 Player* GameEngine::loadGame(int slotNumber) {
-	if (slotNumber < 1 || slotNumber > 10) {
+	if (slotNumber < 1 || slotNumber > getSaveSlotCount()) {
 		return nullptr;
 	}
 
-	std::string filename = "save_slot_" + std::to_string(slotNumber) + ".txt";
-	std::ifstream file(filename);
+	if (saveWriter != nullptr) {
+		saveWriter->flush(getSaveSlotPath(slotNumber));
+	}
 
-	if (!file.is_open()) {
+	SaveData data;
+	int entries = 0;
+	if (!readSaveSlot(slotNumber, data, entries)) {
 		return nullptr;
 	}
 
-	try {
-		std::string playerName, playerID, locationID, locationName, equippedWeapon;
-		int level, damage, health, maxHealth, chapter, inventorySize, locationVisited;
-		int explorationProgress, movementSteps, xp, skillPoints;
-
-		std::getline(file, playerName);
-		std::getline(file, playerID);
-		file >> level >> damage >> health >> maxHealth;
-		file.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-		std::getline(file, locationID);
-		std::getline(file, locationName);// NEW: Load location name
-		file >> locationVisited;
-		file.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-		file >> chapter;
-		file.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-		file >> explorationProgress >> movementSteps;
-		file.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-		std::getline(file, equippedWeapon);
-		file >> xp >> skillPoints;
-		file.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-		file >> inventorySize;
-		file.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-
-		// Create player
-		Player* player = new Player(playerID, playerName, level, damage, health, maxHealth);
-
-		// Restore player state
-		player->setEquippedWeapon(equippedWeapon);
-		player->setXP(xp);
-		player->setSkillPoints(skillPoints);
-
-		// Load inventory
-		for (int i = 0; i < inventorySize; i++) {
-			std::string line;
-			std::getline(file, line);
-
-			// Parse item data (pipe-delimited)
-			size_t pos = 0;
-			std::vector<std::string> tokens;
-			while ((pos = line.find('|')) != std::string::npos) {
-				tokens.push_back(line.substr(0, pos));
-				line.erase(0, pos + 1);
-			}
-			tokens.push_back(line); // Last token
-
-			if (tokens.size() == 12) {
-				Item item(
-					tokens[0], // ID
-					tokens[1], // Name
-					static_cast<Item::Category>(std::stoi(tokens[2])),
-					tokens[3], // Description
-					std::stoi(tokens[4]), // Quantity
-					std::stoi(tokens[5]), // InventorySpace
-					std::stoi(tokens[6]) != 0, // isConsumable
-					std::stoi(tokens[7]) != 0, // isUsable
-					std::stoi(tokens[8]), // healthRestore
-					std::stoi(tokens[9]), // hungerRestore
-					std::stoi(tokens[10]), // infectionCure
-					std::stoi(tokens[11])  // damageBoost
-				);
-				player->addItem(item);
-			}
-		}
-
-		// Load picked up loot IDs
-		int pickedUpLootCount;
-		file >> pickedUpLootCount;
-		file.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-
-		std::vector<std::string> pickedUpLootIDs;
-		for (int i = 0; i < pickedUpLootCount; i++) {
-			std::string lootID;
-			std::getline(file, lootID);
-			pickedUpLootIDs.push_back(lootID);
-		}
-
-		// Load collected clue IDs
-		int collectedClueCount;
-		file >> collectedClueCount;
-		file.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-
-		std::vector<int> collectedClueIDs;
-		for (int i = 0; i < collectedClueCount; i++) {
-			int clueID;
-			file >> clueID;
-			file.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-			collectedClueIDs.push_back(clueID);
-		}
-
-		// Load unlocked skills
-		int unlockedSkillCount;
-		file >> unlockedSkillCount;
-		file.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-
-		std::vector<std::string> skillIDs;
-		std::vector<int> skillLevels;
-		for (int i = 0; i < unlockedSkillCount; i++) {
-			std::string line;
-			std::getline(file, line);
-			size_t pipePos = line.find('|');
-			if (pipePos != std::string::npos) {
-				std::string skillID = line.substr(0, pipePos);
-			 int level = std::stoi(line.substr(pipePos + 1));
-				skillIDs.push_back(skillID);
-				skillLevels.push_back(level);
-			}
-		}
-
-		file.close();
+	// Saves to this slot now append to its journal (unless it needs a fresh snapshot first)
+	journalSlot = entries >= 0 ? slotNumber : 0;
+	journalEntries = entries;
+	journalState = data; // As saved: later deltas are computed against the same form
+	data.resolveContent(content);
+	playtimeBaseSeconds = data.progress.playtimeSeconds;
+	playtimeStartMs = Platform::getMilliseconds();
+
+	// Create player and restore inventory
+	Player* player = data.player.createPlayer();
+	for (const SaveData::ItemRecord& record : data.inventory) {
+		player->addItem(record.createItem());
+	}
 
-		// Set location
-		Location* loc = getLocationByID(locationID);
-		if (loc != nullptr) {
-			setCurrentLocation(loc);
-			// Restore visited status
-			if (locationVisited) {
-				loc->markVisited();
-			}
+	// Set location
+	Location* loc = getLocationByID(data.progress.locationID);
+	if (loc != nullptr) {
+		setCurrentLocation(loc);
+		// Restore visited status
+		if (data.progress.locationVisited) {
+			loc->markVisited();
 		}
+	}
 
-		// Set chapter
-		currentChapter = chapter;
-
-		// Store exploration progress and loot/clue state to restore after GameplayEngine is initialized
-		savedExplorationProgress = explorationProgress;
-		savedMovementSteps = movementSteps;
+	// Set chapter
+	currentChapter = data.progress.chapter;
 
-		// Store picked up loot IDs to restore AFTER GameplayEngine initialize (in handleLoadGame)
-		savedPickedUpLootIDs = pickedUpLootIDs;
+	// Store exploration progress and loot/clue state to restore after GameplayEngine is initialized
+	savedExplorationProgress = data.progress.explorationProgress;
+	savedMovementSteps = data.progress.movementSteps;
 
-		// Store collected clue IDs to restore AFTER initialize (in handleLoadGame)
-		savedCollectedClueIDs = collectedClueIDs;
+	// Store picked up loot IDs to restore AFTER GameplayEngine initialize (in handleLoadGame)
+	savedPickedUpLootIDs = std::move(data.pickedUpLootIDs);
 
-		// Store skill data to restore AFTER player is set up (in handleLoadGame)
-		savedSkillIDs = skillIDs;
-		savedSkillLevels = skillLevels;
+	// Store collected clue IDs to restore AFTER initialize (in handleLoadGame)
+	savedCollectedClueIDs = std::move(data.clueIDs);
 
-		return player;
-	}
-	catch (...) {
-		file.close();
-		return nullptr;
+	// Store skill data to restore AFTER player is set up (in handleLoadGame)
+	savedSkillIDs.clear();
+	savedSkillLevels.clear();
+	for (const SaveData::SkillRecord& skill : data.skills) {
+		savedSkillIDs.push_back(skill.id);
+		savedSkillLevels.push_back(skill.level);
 	}
+
+	return player;
 }
 
 bool GameEngine::deleteSaveSlot(int slotNumber) {
-	if (slotNumber < 1 || slotNumber > 10) {
+	if (slotNumber < 1 || slotNumber > getSaveSlotCount()) {
 		return false;
 	}
 
-	std::string filename = "save_slot_" + std::to_string(slotNumber) + ".txt";
+	if (saveWriter != nullptr) {
+		saveWriter->flush(getSaveSlotPath(slotNumber)); // A queued save would bring the slot back
+		saveWriter->flush(getSaveIndexPath()); // Or its index entry
+	}
 
-	// Check if file exists
-	std::ifstream checkFile(filename);
-	if (!checkFile.is_open()) {
-		return false; // File doesn't exist
+	if (journalSlot == slotNumber) {
+		journalSlot = 0;
 	}
-	checkFile.close();
 
-	// Delete the file
-	if (std::remove(filename.c_str()) == 0) {
-		return true;
+	// Either file may hold the slot (a text save not yet upgraded)
+	bool removedBinary = std::remove(getSaveSlotPath(slotNumber).c_str()) == 0;
+	bool removedLegacy = std::remove(getLegacySaveSlotPath(slotNumber).c_str()) == 0;
+	std::remove(getJournalPath(slotNumber).c_str());
+	SaveIndex::remove(getSaveIndexPath(), slotNumber);
+	return removedBinary || removedLegacy;
+}
+
+void GameEngine::setSaveWriter(SaveWriter* writer) {
+	saveWriter = writer;
+}
+
+void GameEngine::setProfileStore(ProfileStore* store) {
+	if (profileStore != nullptr && !profileID.empty()) {
+		profileStore->release(profileID);
 	}
+	profileID.clear();
+	profileStore = store;
+}
+
+ProfileStore* GameEngine::getProfileStore() const {
+	return profileStore;
+}
+
+void GameEngine::setCompressSaves(bool compress) {
+	compressSaves = compress;
+}
 
-	return false;
+void GameEngine::setSaveDirectory(const std::string& directory) {
+	saveDirectory = directory;
 }
 
 // ============================================================================
 // MAIN MENU HANDLERS
 // ============================================================================
 
-void GameEngine::handleNewGame() {
+// A fresh world and journal for a new game, at the start location
+void GameEngine::resetWorld() {
 	// RESET GameEngine state for new game
 	currentChapter = 1;
 	currentLocation = nullptr;
+	journalSlot = 0; // Autosave starts once the new game is saved to a slot
+	playtimeBaseSeconds = 0;
+	playtimeStartMs = Platform::getMilliseconds();
 	
 	// Clear and reinitialize journal
 	if (journal != nullptr) {
@@ -1174,8 +915,12 @@ void GameEngine::handleNewGame() {
 	// Reinitialize everything fresh
 	initializeAllLocations();
 	initializeAllLoreItems();
-	
-	system("cls");
+}
+
+void GameEngine::handleNewGame() {
+	resetWorld();
+
+	Platform::clearScreen();
 	std::cout << "\n\n" << std::string(80, '=') << "\n";
 	std::cout << "  NEW GAME\n";
 	std::cout << std::string(80, '=') << "\n\n";
@@ -1192,18 +937,9 @@ void GameEngine::handleNewGame() {
 	
 	if (name.empty()) name = "Tony Redgrave";
 
-	Player* player = new Player("player_001", name, 1, 8, 125, 125);
-
-	// Give starting skill points for unlocking first skill
-	player->setSkillPoints(2);
-
-	// Starting items
-	player->addItem(Item("start_bandage", "Bandage", Item::Category::MEDICAL,
-		"Restores 15 HP", 2, 3, true, true, 15, 0, 0, 0));
-	player->addItem(Item("start_food", "Canned Food", Item::Category::FOOD,
-		"Restores 30 hunger", 2, 4, true, true, 0, 30, 0, 0));
+	Player* player = createStartingPlayer(name);
 
-	system("cls");
+	Platform::clearScreen();
 	std::cout << "\n\n" << std::string(80, '=') << "\n";
 	std::cout << "  WELCOME, " << name << "\n";
 	std::cout << std::string(80, '=') << "\n\n";
@@ -1215,7 +951,7 @@ void GameEngine::handleNewGame() {
 	std::cin.get();
 
 	displayChapterIntro();
-	GameplayEngine* gameplay = GameplayEngine::getInstance();
+	GameplayEngine* gameplay = &session.getGameplayEngine();
 	gameplay->initialize(player, getCurrentLocation(), getJournal());
 
 	// Apply initial skill bonuses
@@ -1226,6 +962,35 @@ void GameEngine::handleNewGame() {
 	// Game session has ended, main loop will display title screen again
 }
 
+// A fresh character with the starting skill points and kit
+Player* GameEngine::createStartingPlayer(const std::string& name) {
+	Player* player = new Player("player_001", name, 1, 8, 125, 125);
+
+	// Give starting skill points for unlocking first skill
+	player->setSkillPoints(2);
+
+	// Starting items
+	player->addItem(Item("start_bandage", "Bandage", Item::Category::MEDICAL,
+		"Restores 15 HP", 2, 3, true, true, 15, 0, 0, 0));
+	player->addItem(Item("start_food", "Canned Food", Item::Category::FOOD,
+		"Restores 30 hunger", 2, 4, true, true, 0, 30, 0, 0));
+
+	return player;
+}
+
+Player* GameEngine::startScriptedGame(const std::string& name) {
+	resetWorld();
+	Player* player = createStartingPlayer(name);
+
+	// The opening chapter counts as seen, as after its intro
+	if (currentLocation != nullptr) {
+		currentLocation->markVisited();
+	}
+	session.getGameplayEngine().initialize(player, getCurrentLocation(), getJournal());
+	player->applySkillBonuses();
+	return player;
+}
+
 void GameEngine::handleLoadGame() {
 	// CRITICAL: Reset and reinitialize journal BEFORE loading
 	// This ensures all clue definitions exist before marking them as collected
@@ -1238,7 +1003,7 @@ void GameEngine::handleLoadGame() {
 	// Reinitialize all lore items (clue definitions)
 	initializeAllLoreItems();
 
-	system("cls");
+	Platform::clearScreen();
 	std::cout << "\n\n" << std::string(80, '=') << "\n";
 	std::cout << "  LOAD GAME\n";
 	std::cout << std::string(80, '=') << "\n\n";
@@ -1249,7 +1014,7 @@ void GameEngine::handleLoadGame() {
 	if (slot > 0) {
 		Player* player = loadGame(slot);
 		if (player != nullptr) {
-			system("cls");
+			Platform::clearScreen();
 			std::cout << "\n\n" << std::string(80, '=') << "\n";
 			std::cout << "  GAME LOADED\n";
 			std::cout << std::string(80, '=') << "\n\n";
@@ -1258,7 +1023,7 @@ void GameEngine::handleLoadGame() {
 			std::cin.get();
 
 			// Initialize GameplayEngine FIRST before displaying chapter
-			GameplayEngine* gameplay = GameplayEngine::getInstance();
+			GameplayEngine* gameplay = &session.getGameplayEngine();
 
 			// CRITICAL: Restore picked up loot IDs BEFORE initialize is called!
 			// initialize() will call populateLocationLoot() which checks this list
@@ -1291,7 +1056,7 @@ void GameEngine::handleLoadGame() {
 			gameplay->setExplorationProgress(savedExplorationProgress);
 			gameplay->setMovementSteps(savedMovementSteps);
 
-			system("cls");
+			Platform::clearScreen();
 			if (currentLocation != nullptr) {
 				// Update currentChapter from location
 				currentChapter = currentLocation->getChapterNumber();
@@ -1305,10 +1070,7 @@ void GameEngine::handleLoadGame() {
 				std::cin.get();
 
 				// CRITICAL FIX: Play location-specific music after loading
-				AudioEngine* audio = AudioEngine::getInstance();
-				if (audio != nullptr) {
-					audio->playLocationMusic(currentLocation->getID());
-				}
+				session.getAudio().playLocationMusic(currentLocation->getIDSymbol());
 			}
 
 			// Run the exploration loop
@@ -1316,9 +1078,9 @@ void GameEngine::handleLoadGame() {
 			delete player;
 		}
 		else {
-			system("cls");
+			Platform::clearScreen();
 			std::cout << "\n  [ERROR] Failed to load.\n";
-			std::this_thread::sleep_for(std::chrono::milliseconds(2000));
+			Platform::sleepFor(2000);
 		}
 	}
 }
@@ -1333,7 +1095,7 @@ void GameEngine::runGame() {
 // ============================================================================
 
 void GameEngine::runExplorationLoop(Player* player) {
-	GameplayEngine* gameplay = GameplayEngine::getInstance();
+	GameplayEngine* gameplay = &session.getGameplayEngine();
 	bool exploring = true;
 
 	while (exploring && player->getHealth() > 0) {
@@ -1341,7 +1103,10 @@ void GameEngine::runExplorationLoop(Player* player) {
 
 		std::cout << "Command: ";
 		std::string command;
-		std::getline(std::cin, command);
+		if (!std::getline(std::cin, command)) {
+			// Input closed (e.g. a scripted headless run finished): end the session
+			break;
+		}
 
 		// Convert to lowercase
 		for (char& c : command) c = tolower(c);
@@ -1358,7 +1123,7 @@ void GameEngine::runExplorationLoop(Player* player) {
 				gameplay->moveInDirection(direction);
 			}
 			else {
-				system("cls");
+				Platform::clearScreen();
 				std::cout << "\n  Invalid direction.\n  Press ENTER...";
 				std::cin.get();
 			}
@@ -1376,7 +1141,7 @@ void GameEngine::runExplorationLoop(Player* player) {
 			displaySkillTreeMenu(player);
 		}
 		else if (command == "craft") {
-			system("cls");
+			Platform::clearScreen();
 			std::cout << "\n" << std::string(80, '=') << "\n";
 			std::cout << "  CRAFTING MENU\n";
 			std::cout << std::string(80, '=') << "\n\n";
@@ -1422,14 +1187,14 @@ void GameEngine::runExplorationLoop(Player* player) {
 				
 				if (craftingSystem.canCraft(selectedRecipe, player)) {
 					if (craftingSystem.craftItem(selectedRecipe, player)) {
-						system("cls");
+						Platform::clearScreen();
 						std::cout << "\n  [SUCCESS] Crafted: " << selectedRecipe->recipeName << "\n";
 						std::cout << "  [+] Added to inventory!\n";
 						std::cout << "  Press ENTER...";
 						std::cin.get();
 					}
 				} else {
-					system("cls");
+					Platform::clearScreen();
 					std::cout << "\n  [ERROR] Cannot craft - missing materials or inventory full!\n";
 					std::cout << "  Press ENTER...";
 					std::cin.get();
@@ -1446,11 +1211,13 @@ void GameEngine::runExplorationLoop(Player* player) {
 
 				if (choice > 0) {
 					// Get connection at index
-					SinglyLinkedList<std::string>& connections = gameplay->getCurrentLocation()->getConnections();
+					SinglyLinkedList<Symbol>& connections = gameplay->getCurrentLocation()->getConnections();
 					int count = 1;
 					for (auto it = connections.begin(); it != connections.end(); ++it) {
 						if (count == choice) {
-							gameplay->travelToLocation(*it);
+							if (gameplay->travelToLocation(it->str())) {
+								autosave(player);
+							}
 							break;
 						}
 						count++;
@@ -1458,28 +1225,23 @@ void GameEngine::runExplorationLoop(Player* player) {
 				}
 			}
 			else {
-				system("cls");
+				Platform::clearScreen();
 				std::cout << "\n  You haven't explored enough yet.\n";
 				std::cout << "  Explore more (15 steps needed).\n  Press ENTER...";
 				std::cin.get();
 			}
 		}
 		else if (command == "rest") {
-			system("cls");
+			Platform::clearScreen();
 			std::cout << "\n  You rest...\n";
-			int heal = 25;
-			int newHP = player->getHealth() + heal;
-			if (newHP > player->getMaxHealth()) {
-				newHP = player->getMaxHealth();
-			}
-			player->setHealth(newHP);
-			std::cout << "  Restored " << heal << " HP!\n";
+			gameplay->rest();
+			std::cout << "  Restored " << ExplorationRules::REST_HEAL << " HP!\n";
 			std::cout << "  HP: " << player->getHealth() << "/" << player->getMaxHealth() << "\n";
 			std::cout << "\n  Press ENTER...";
 			std::cin.get();
 		}
 		else if (command == "save") {
-			system("cls");
+			Platform::clearScreen();
 			std::cout << "\n  SAVE GAME\n\n";
 			displaySaveSlots();
 			
@@ -1496,7 +1258,7 @@ void GameEngine::runExplorationLoop(Player* player) {
 			std::cin.get();
 		}
 		else if (command == "menu") {
-			system("cls");
+			Platform::clearScreen();
 			std::cout << "\n  GAME MENU\n\n";
 			std::cout << "  [1] Continue Exploring\n";
 			std::cout << "  [2] Save Game\n";
@@ -1512,7 +1274,7 @@ void GameEngine::runExplorationLoop(Player* player) {
 			}
 			else if (choice == 2) {
 				// Save game
-				system("cls");
+				Platform::clearScreen();
 				std::cout << "\n  SAVE GAME\n\n";
 				displaySaveSlots();
 
@@ -1531,10 +1293,10 @@ void GameEngine::runExplorationLoop(Player* player) {
 			else if (choice == 3) {
 				// Quit to main menu
 				std::cout << "\n  Returning to main menu...\n";
-				std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+				Platform::sleepFor(1000);
 				
-				// CRITICAL: Reset singleton instance for clean state
-				GameplayEngine::destroyInstance();
+				// CRITICAL: Reset gameplay state for a clean next game
+				session.resetGameplay();
 				
 				exploring = false;
 			}
@@ -1543,7 +1305,7 @@ void GameEngine::runExplorationLoop(Player* player) {
 			// CHEAT MENU - Developer Tools (Hidden Command)
 			bool inCheatMenu = true;
 			while (inCheatMenu) {
-				system("cls");
+				Platform::clearScreen();
 				std::cout << "\n" << std::string(80, '=') << "\n";
 				std::cout << "  [DEV TOOLS] CHEAT MENU\n";
 				std::cout << std::string(80, '=') << "\n\n";
@@ -1645,7 +1407,7 @@ void GameEngine::runExplorationLoop(Player* player) {
 							setCurrentLocation(newLoc);
 							gameplay->setCurrentLocation(newLoc);
 							newLoc->markVisited();
-							newLoc->displayChapterIntro();
+							newLoc->displayChapterIntro(&session.getAudio());
 							std::cout << "\n  [TP] Teleported to " << newLoc->getName() << "!\n";
 							std::cout << "  Press ENTER...";
 							std::cin.get();
@@ -1664,13 +1426,13 @@ void GameEngine::runExplorationLoop(Player* player) {
 					
 					if (endingType == "bad" || endingType == "game over") {
 						std::cout << "\n  [ENDING] Triggering bad ending...\n";
-						EndingSystem::displayEnding(EndingSystem::BAD_ENDING, player, journal);
+						EndingSystem::displayEnding(&session.getAudio(), EndingSystem::BAD_ENDING, player, journal);
 						inCheatMenu = false;
 						exploring = false;
 					}
 					else if (endingType == "good" || endingType == "normal") {
 						std::cout << "\n  [ENDING] Triggering normal ending...\n";
-						EndingSystem::displayEnding(EndingSystem::NORMAL_ENDING, player, journal);
+						EndingSystem::displayEnding(&session.getAudio(), EndingSystem::NORMAL_ENDING, player, journal);
 						inCheatMenu = false;
 						exploring = false;
 					}
@@ -1686,7 +1448,7 @@ void GameEngine::runExplorationLoop(Player* player) {
 							}
 							std::cout << "  [DEBUG] All clues collected for true ending!\n";
 						}
-						EndingSystem::displayEnding(EndingSystem::TRUE_ENDING, player, journal);
+						EndingSystem::displayEnding(&session.getAudio(), EndingSystem::TRUE_ENDING, player, journal);
 						inCheatMenu = false;
 						exploring = false;
 					}
@@ -1704,30 +1466,42 @@ void GameEngine::runExplorationLoop(Player* player) {
 					std::cin.get();
 				}
 				else if (cheatCmd.find("addxp ") == 0) {
+					// Parse only inside the try: hosted games must not wait for input in a handler
+					bool validAmount = true;
+					int amount = 0;
 					try {
-						int amount = std::stoi(cheatCmd.substr(6));
+						amount = std::stoi(cheatCmd.substr(6));
+					} catch (...) {
+						validAmount = false;
+					}
+					if (validAmount) {
 						player->gainExperience(amount);
 						std::cout << "\n  [XP] Added " << amount << " experience!\n";
-						std::cout << "  Press ENTER...";
-						std::cin.get();
-					} catch (...) {
+					}
+					else {
 						std::cout << "\n  [ERROR] Invalid amount!\n";
-						std::cout << "  Press ENTER...";
-						std::cin.get();
 					}
+					std::cout << "  Press ENTER...";
+					std::cin.get();
 				}
 				else if (cheatCmd.find("addsp ") == 0) {
+					// Parse only inside the try: hosted games must not wait for input in a handler
+					bool validAmount = true;
+					int amount = 0;
 					try {
-						int amount = std::stoi(cheatCmd.substr(6));
+						amount = std::stoi(cheatCmd.substr(6));
+					} catch (...) {
+						validAmount = false;
+					}
+					if (validAmount) {
 						player->addSkillPoints(amount);
 						std::cout << "\n  [SP] Added " << amount << " skill points!\n";
-						std::cout << "  Press ENTER...";
-						std::cin.get();
-					} catch (...) {
+					}
+					else {
 						std::cout << "\n  [ERROR] Invalid amount!\n";
-						std::cout << "  Press ENTER...";
-						std::cin.get();
 					}
+					std::cout << "  Press ENTER...";
+					std::cin.get();
 				}
 				else if (cheatCmd == "back") {
 					inCheatMenu = false;
@@ -1740,7 +1514,7 @@ void GameEngine::runExplorationLoop(Player* player) {
 			}
 		}
 		else {
-			system("cls");
+			Platform::clearScreen();
 			std::cout << "\n  Unknown command.\n";
 			std::cout << "  Available: go [left/right/up/down] | status | inventory | clues | rest | save";
 			if (gameplay->canTravelToNewLocation()) {
@@ -1752,7 +1526,7 @@ void GameEngine::runExplorationLoop(Player* player) {
 		}
 
 		if (player->getHealth() <= 0) {
-			system("cls");
+			Platform::clearScreen();
 			std::cout << "\n\n" << std::string(80, '=') << "\n";
 			std::cout << "  GAME OVER\n";
 			std::cout << std::string(80, '=') << "\n\n";
@@ -1768,7 +1542,7 @@ void GameEngine::displaySkillTreeMenu(Player* player) {
 	bool inSkillMenu = true;
 
 	while (inSkillMenu) {
-		system("cls");
+		Platform::clearScreen();
 		std::cout << "\n";
 		std::cout << "================================================================\n";
 		std::cout << "     SKILL TREE      \n";
@@ -1803,7 +1577,7 @@ void GameEngine::displaySkillTreeMenu(Player* player) {
 		// Display all skills
 		SinglyLinkedList<SkillNode*>& rootSkills = skillTree.getRootSkills();
 		int skillIndex = 1;
-		std::vector<std::string> skillIDs;
+		std::vector<SkillTree::SkillKey> skillKeys;
 
 		// Display root skills
 		for (auto it = rootSkills.begin(); it != rootSkills.end(); ++it) {
@@ -1820,8 +1594,8 @@ void GameEngine::displaySkillTreeMenu(Player* player) {
 			std::cout << "      " << skill->getSkillDescription() << "\n";
 			std::cout << "    Cost: " << skill->getCost() << " SP | Level: " << skill->getLevel() << "/" << skill->getMaxLevel() << "\n";
 
-			// Store the skill ID for lookup (not name)
-			skillIDs.push_back(skill->getSkillID());
+			// Store the prehashed skill ID for lookup (not name)
+			skillKeys.push_back(skill->getSkillSymbol());
 			skillIndex++;
 
 			// Display children if root is unlocked
@@ -1840,8 +1614,8 @@ void GameEngine::displaySkillTreeMenu(Player* player) {
 					std::cout << "      " << childSkill->getSkillDescription() << "\n";
 					std::cout << "    Cost: " << childSkill->getCost() << " SP | Level: " << childSkill->getLevel() << "/" << childSkill->getMaxLevel() << "\n";
 
-					// Store the skill ID for lookup (not name)
-					skillIDs.push_back(childSkill->getSkillID());
+					// Store the prehashed skill ID for lookup (not name)
+					skillKeys.push_back(childSkill->getSkillSymbol());
 					skillIndex++;
 				}
 			}
@@ -1857,9 +1631,9 @@ void GameEngine::displaySkillTreeMenu(Player* player) {
 
 		if (choice == 0) {
 			inSkillMenu = false;
-		} else if (choice > 0 && choice <= (int)skillIDs.size()) {
-			std::string selectedSkillID = skillIDs[choice - 1];
-			SkillNode* selectedSkill = skillTree.getSkill(selectedSkillID);
+		} else if (choice > 0 && choice <= (int)skillKeys.size()) {
+			const SkillTree::SkillKey& selectedSkillKey = skillKeys[choice - 1];
+			SkillNode* selectedSkill = skillTree.getSkill(selectedSkillKey);
 
 			if (selectedSkill != nullptr) {
 				// Check if skill is already unlocked
@@ -1872,7 +1646,7 @@ void GameEngine::displaySkillTreeMenu(Player* player) {
 					} else {
 						availablePoints = player->getSkillPoints(); // Refresh points
 						if (availablePoints >= selectedSkill->getCost()) {
-							if (skillTree.levelUpSkill(selectedSkillID)) {
+							if (skillTree.levelUpSkill(selectedSkillKey)) {
 								// Sync player skill points with SkillTree
 								int newPoints = availablePoints - selectedSkill->getCost();
 								player->setSkillPoints(newPoints);
@@ -1908,7 +1682,7 @@ void GameEngine::displaySkillTreeMenu(Player* player) {
 							std::cout << "  Press ENTER...";
 							std::cin.get();
 						} else {
-							if (skillTree.unlockSkill(selectedSkillID)) {
+							if (skillTree.unlockSkill(selectedSkillKey)) {
 								// Sync player skill points with SkillTree
 								int newPoints = availablePoints - selectedSkill->getCost();
 								player->setSkillPoints(newPoints);
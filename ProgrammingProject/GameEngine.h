@@ -2,25 +2,30 @@
 #define GAMEENGINE_H
 #include <string>
 #include <vector>
-#include <windows.h>
 #include "Location.h"
 #include "Player.h"
 #include "ClueJournal.h"
 #include "AudioEngine.h"
+#include "ContentPack.h"
+#include "SaveData.h"
+#include "SaveIndex.h"
+
+class GameSession;
+class SaveWriter;
+class ProfileStore;
 
 class GameEngine {
 private:
-	// Singleton instance
-	static GameEngine* instance;
-
-	// Private constructor (singleton pattern)
-	GameEngine();
+	// The session this engine belongs to (gameplay engine, storyteller, audio)
+	GameSession& session;
 
 	// Game state
 	Player* currentPlayer;
 	Location* currentLocation;
 	ClueJournal* journal;
 	std::vector<Location*> allLocations;
+	ContentPack ownContent; // Loaded in initialize() unless the session shares a content pack
+	const ContentPack& content; // World content tables
 
 	// Story progression
 	int currentChapter;
@@ -34,7 +39,52 @@ private:
 	std::vector<std::string> savedSkillIDs;
 	std::vector<int> savedSkillLevels;
 
+	// Background slot writer, if the host runs one; saves are written synchronously otherwise
+	SaveWriter* saveWriter;
+
+	// The slot this game last saved to or loaded from, and what it holds: later saves to it only
+	// append their changes to its journal, until it is due for compaction
+	int journalSlot; // 0: none, the next save is a full snapshot
+	int journalEntries;
+	SaveData journalState;
+
+	// Time played: what the loaded save had banked, plus time since this session started
+	int playtimeBaseSeconds;
+	long long playtimeStartMs;
+
+	// With a profile store (a host with many players), slots belong to the player ID given at the
+	// first save or load; otherwise to the working directory
+	ProfileStore* profileStore;
+	std::string profileID;
+	std::string saveDirectory; // Slots without a profile store: "" is the working directory
+
+	bool compressSaves; // Write slot snapshots compressed (loading takes either)
+
+	// Save slots: binary save_slot_N.sav and its save_slot_N.journal, falling back to a pre-binary
+	// save_slot_N.txt, in the profile's directory if there is one
+	std::string getSaveDirectory() const;
+	std::string getSaveSlotPath(int slotNumber) const;
+	std::string getJournalPath(int slotNumber) const;
+	std::string getLegacySaveSlotPath(int slotNumber) const;
+	std::string getSaveIndexPath() const;
+	int getSaveSlotCount() const; // SHARED_SAVE_SLOTS, or ProfileStore::MAX_SLOTS in a profile
+
+	// Ask for the player ID the slots belong to, unless already known or there is no profile
+	// store; false if no usable profile was given
+	bool selectProfile();
+
+	// The slot's snapshot brought up to date by its journal, or a legacy text save. entries is the
+	// journal's length, or -1 if it cannot be appended to (torn by a crash, or a legacy slot).
+	bool readSaveSlot(int slotNumber, SaveData& data, int& entries) const;
+
+	// The slot listing read back from the slots, for when save_index.dat is missing or damaged
+	std::vector<SaveIndex::Entry> rebuildSaveIndex() const;
+
+	// Save to the active slot without prompting, after the player travels
+	void autosave(Player* player);
+
 	// Helper methods for initialization
+	void resetWorld();
 	void initializeAllLocations();
 	void initializeAllLoreItems();
 	Location* createLocation(const std::string& id, const std::string& name,
@@ -47,11 +97,17 @@ public:
 	static const int CONSOLE_WIDTH = 120;
 	static const int CONSOLE_HEIGHT = 300;
 
+	// Save slots in the working directory's shared set (a profile has ProfileStore::MAX_SLOTS)
+	static const int SHARED_SAVE_SLOTS = 10;
+
+	// Constructor (a null sharedContent means initialize() loads our own)
+	GameEngine(GameSession& session, const ContentPack* sharedContent = nullptr);
+
 	// Delete copy constructor and assignment operator
 	GameEngine(const GameEngine&) = delete;
 	GameEngine& operator=(const GameEngine&) = delete;
 
-	// Get singleton instance
+	// Compatibility shim: the default session's engine
 	static GameEngine* getInstance();
 
 	// Initialize the game engine
@@ -66,6 +122,7 @@ public:
 	void setCurrentLocation(Location* location);
 	Location* getCurrentLocation();
 	ClueJournal* getJournal();
+	const ContentPack& getContentPack() const;
 
 	// Location management
 	Location* getLocationByID(const std::string& locationID);
@@ -98,15 +155,22 @@ public:
 	int selectSaveSlot(bool isLoading);
 	void displaySaveSlots();
 	bool deleteSaveSlot(int slotNumber);
+	void setSaveWriter(SaveWriter* writer); // Not owned; must outlive the engine's saves
+	void setProfileStore(ProfileStore* store); // Not owned; must outlive the engine or be unset. Forgets the player ID
+	ProfileStore* getProfileStore() const;
+	void setCompressSaves(bool compress);
+	void setSaveDirectory(const std::string& directory); // Empty, or ending in '/'
 
 	// Main menu handlers
 	void handleNewGame();
 	void handleLoadGame();
+	static Player* createStartingPlayer(const std::string& name); // Caller owns the player
+	Player* startScriptedGame(const std::string& name); // handleNewGame without the screens; caller owns the player
 
 	// Skill tree UI
 	void displaySkillTreeMenu(Player* player);
 
-	// Cleanup and destroy singleton
+	// Compatibility shim: destroys the default session
 	static void destroyInstance();
 
 	// Destructor
@@ -0,0 +1,360 @@
+#include "GameServer.h"
+#include "GameEngine.h"
+#include "Platform.h"
+#include <arpa/inet.h>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace {
+
+// Telnet "go ahead": the game is waiting for the client's next line
+const char GO_AHEAD[] = { '\xff', '\xf9' };
+
+const int MAX_EVENTS = 256;
+const std::size_t READ_CHUNK = 16 * 1024;
+
+// Resident set size of this process in megabytes, 0 if unknown
+double getResidentMegabytes() {
+	std::ifstream statm("/proc/self/statm");
+	long long pages = 0;
+	long long resident = 0;
+	if (!(statm >> pages >> resident)) {
+		return 0.0;
+	}
+	return resident * (double)sysconf(_SC_PAGESIZE) / (1024.0 * 1024.0);
+}
+
+}
+
+// Constructor
+GameServer::GameServer(const ContentPack& aContent, const Options& aOptions)
+	: fContent(aContent), fOptions(aOptions), fListenFd(-1), fEpollFd(-1), fConnectionCount(0), fAccepting(true), fStats(),
+	fProfileStore(aOptions.profileDirectory) {
+}
+
+bool GameServer::start(std::string& aError) {
+	sockaddr_in address;
+	std::memset(&address, 0, sizeof(address));
+	address.sin_family = AF_INET;
+	address.sin_port = htons(static_cast<unsigned short>(fOptions.port));
+	if (inet_pton(AF_INET, fOptions.bindAddress.c_str(), &address.sin_addr) != 1) {
+		aError = "invalid bind address " + fOptions.bindAddress;
+		return false;
+	}
+
+	fListenFd = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+	if (fListenFd < 0) {
+		aError = std::string("socket: ") + std::strerror(errno);
+		return false;
+	}
+	int enable = 1;
+	setsockopt(fListenFd, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable));
+
+	if (bind(fListenFd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) < 0 || listen(fListenFd, SOMAXCONN) < 0) {
+		aError = std::string("bind/listen: ") + std::strerror(errno);
+		return false;
+	}
+
+	fEpollFd = epoll_create1(EPOLL_CLOEXEC);
+	if (fEpollFd < 0) {
+		aError = std::string("epoll_create1: ") + std::strerror(errno);
+		return false;
+	}
+
+	epoll_event event;
+	event.events = EPOLLIN;
+	event.data.ptr = nullptr; // The listening socket
+	epoll_ctl(fEpollFd, EPOLL_CTL_ADD, fListenFd, &event);
+	return true;
+}
+
+void GameServer::run(const volatile std::sig_atomic_t& aStop, int aStatsSeconds) {
+	epoll_event events[MAX_EVENTS];
+	long long nextStats = Platform::getMilliseconds() + aStatsSeconds * 1000LL;
+
+	while (!aStop) {
+		int timeout = -1;
+		if (aStatsSeconds > 0) {
+			long long remaining = nextStats - Platform::getMilliseconds();
+			timeout = remaining > 0 ? static_cast<int>(remaining) : 0;
+		}
+
+		int count = epoll_wait(fEpollFd, events, MAX_EVENTS, timeout);
+		if (count < 0 && errno != EINTR) {
+			std::cout << "[SERVER] epoll_wait: " << std::strerror(errno) << "\n";
+			break;
+		}
+
+		for (int i = 0; i < count; ++i) {
+			Connection* connection = static_cast<Connection*>(events[i].data.ptr);
+			if (connection == nullptr) {
+				acceptConnections();
+				continue;
+			}
+
+			// Input first: a hang-up reads as end of stream, and it may close the connection
+			if (events[i].events & (EPOLLIN | EPOLLHUP | EPOLLERR)) {
+				int fd = connection->fd;
+				handleInput(connection);
+				if (fConnections[fd] != connection) {
+					continue;
+				}
+			}
+			if (events[i].events & EPOLLOUT) {
+				handleOutput(connection);
+			}
+		}
+
+		if (aStatsSeconds > 0 && Platform::getMilliseconds() >= nextStats) {
+			nextStats += aStatsSeconds * 1000LL;
+			std::cout << "[SERVER] " << fConnectionCount << " connected, " << fStats.accepted << " accepted, "
+				<< fStats.closed << " closed, " << fStats.gamesFinished << " games finished, "
+				<< (int)getResidentMegabytes() << " MB resident" << std::endl;
+		}
+	}
+}
+
+void GameServer::acceptConnections() {
+	while (true) {
+		int fd = accept4(fListenFd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+		if (fd < 0) {
+			if (errno == EINTR) continue;
+			if (errno == EMFILE || errno == ENFILE || errno == ENOBUFS || errno == ENOMEM) {
+				// The pending connection stays readable, so stop listening or the loop spins on it
+				setAccepting(false);
+			}
+			return; // Drained (or out of descriptors: the backlog waits for a close)
+		}
+
+		if (fConnectionCount >= fOptions.maxConnections) {
+			::close(fd);
+			fStats.rejected++;
+			continue;
+		}
+
+		int enable = 1;
+		setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(enable));
+
+		HostedGame* game = new HostedGame(fContent);
+		game->setRecording(!fOptions.recordDirectory.empty());
+		game->getSession().getGameEngine().setSaveWriter(&fSaveWriter);
+		game->getSession().getGameEngine().setCompressSaves(fOptions.compressSaves);
+		if (!fOptions.profileDirectory.empty()) {
+			game->getSession().getGameEngine().setProfileStore(&fProfileStore);
+		}
+		if (!game->initialize()) {
+			delete game;
+			::close(fd);
+			fStats.rejected++;
+			continue;
+		}
+
+		Connection* connection = new Connection();
+		connection->id = fStats.accepted + 1;
+		connection->fd = fd;
+		connection->game = game;
+		connection->outboxSent = 0;
+		connection->events = EPOLLIN;
+
+		if (fd >= (int)fConnections.size()) {
+			fConnections.resize(fd + 1, nullptr);
+		}
+		fConnections[fd] = connection;
+		fConnectionCount++;
+		fStats.accepted++;
+
+		epoll_event event;
+		event.events = connection->events;
+		event.data.ptr = connection;
+		epoll_ctl(fEpollFd, EPOLL_CTL_ADD, fd, &event);
+
+		// Run up to the first prompt (the player's name)
+		runGame(connection);
+		if (!flush(connection)) {
+			closeConnection(connection);
+		}
+	}
+}
+
+void GameServer::setAccepting(bool aAccepting) {
+	if (aAccepting == fAccepting) {
+		return;
+	}
+	epoll_event event;
+	event.events = aAccepting ? static_cast<std::uint32_t>(EPOLLIN) : 0u;
+	event.data.ptr = nullptr; // The listening socket
+	epoll_ctl(fEpollFd, EPOLL_CTL_MOD, fListenFd, &event);
+	fAccepting = aAccepting;
+}
+
+void GameServer::handleInput(Connection* aConnection) {
+	char buffer[READ_CHUNK];
+	bool received = false;
+	bool ended = false; // The client shut down its side: play what it sent, then say goodbye
+	bool hungUp = false;
+
+	while (true) {
+		ssize_t count = recv(aConnection->fd, buffer, sizeof(buffer), 0);
+		if (count > 0) {
+			aConnection->game->receive(buffer, static_cast<std::size_t>(count));
+			fStats.bytesIn += count;
+			received = true;
+			if (aConnection->game->getPendingInput() > fOptions.maxPendingInput) {
+				hungUp = true; // Flooding: more input than a player could type ahead
+				break;
+			}
+		}
+		else if (count == 0) {
+			ended = true;
+			break;
+		}
+		else if (errno == EINTR) {
+			continue;
+		}
+		else {
+			hungUp = errno != EAGAIN && errno != EWOULDBLOCK;
+			break;
+		}
+	}
+
+	if (hungUp) {
+		closeConnection(aConnection);
+		return;
+	}
+	if (received) {
+		runGame(aConnection);
+	}
+	if (ended) {
+		// Unwind the game; the connection closes once its remaining output is sent
+		aConnection->game->close();
+		aConnection->game->takeOutput(aConnection->outbox);
+	}
+	if (!flush(aConnection)) {
+		closeConnection(aConnection);
+	}
+}
+
+void GameServer::handleOutput(Connection* aConnection) {
+	if (!flush(aConnection)) {
+		closeConnection(aConnection);
+	}
+}
+
+void GameServer::runGame(Connection* aConnection) {
+	HostedGame* game = aConnection->game;
+	game->resume();
+	game->takeOutput(aConnection->outbox);
+	if (!game->isFinished()) {
+		aConnection->outbox.append(GO_AHEAD, sizeof(GO_AHEAD));
+	}
+}
+
+// Send what the socket takes now and listen for the rest; false once the connection is done
+bool GameServer::flush(Connection* aConnection) {
+	std::string& outbox = aConnection->outbox;
+	while (aConnection->outboxSent < outbox.size()) {
+		ssize_t count = send(aConnection->fd, outbox.data() + aConnection->outboxSent,
+			outbox.size() - aConnection->outboxSent, MSG_NOSIGNAL);
+		if (count > 0) {
+			aConnection->outboxSent += static_cast<std::size_t>(count);
+			fStats.bytesOut += count;
+		}
+		else if (count < 0 && errno == EINTR) {
+			continue;
+		}
+		else if (count < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+			break;
+		}
+		else {
+			return false;
+		}
+	}
+
+	if (aConnection->outboxSent == outbox.size()) {
+		std::string().swap(outbox);
+		aConnection->outboxSent = 0;
+		if (aConnection->game->isFinished()) {
+			return false; // Game over and every line delivered
+		}
+	}
+
+	updateEvents(aConnection);
+	return true;
+}
+
+// Read while the client keeps up with its output, write while output is queued
+void GameServer::updateEvents(Connection* aConnection) {
+	std::size_t pending = aConnection->outbox.size() - aConnection->outboxSent;
+	std::uint32_t wanted = 0;
+	if (pending < fOptions.maxPendingOutput && !aConnection->game->isFinished()) {
+		wanted |= EPOLLIN;
+	}
+	if (pending > 0) {
+		wanted |= EPOLLOUT;
+	}
+
+	if (wanted != aConnection->events) {
+		epoll_event event;
+		event.events = wanted;
+		event.data.ptr = aConnection;
+		epoll_ctl(fEpollFd, EPOLL_CTL_MOD, aConnection->fd, &event);
+		aConnection->events = wanted;
+	}
+}
+
+void GameServer::closeConnection(Connection* aConnection) {
+	epoll_ctl(fEpollFd, EPOLL_CTL_DEL, aConnection->fd, nullptr);
+	::close(aConnection->fd);
+
+	if (aConnection->game->isFinished() && !aConnection->game->isClosed()) {
+		fStats.gamesFinished++;
+	}
+
+	const ReplayLog* replay = aConnection->game->getReplay();
+	if (replay != nullptr) {
+		aConnection->game->close(); // Unwind first: the log's state hash is taken as the game ends
+		std::string path = fOptions.recordDirectory + "/session_" + std::to_string(aConnection->id) + ".replay";
+		if (!replay->save(path)) {
+			std::cout << "[SERVER] Could not write " << path << "\n";
+		}
+	}
+	delete aConnection->game; // Unwinds a game still waiting for input
+
+	fConnections[aConnection->fd] = nullptr;
+	delete aConnection;
+	fConnectionCount--;
+	fStats.closed++;
+	if (fListenFd >= 0 && fEpollFd >= 0) {
+		setAccepting(true); // A descriptor is free again
+	}
+}
+
+int GameServer::getConnectionCount() const {
+	return fConnectionCount;
+}
+
+const GameServer::Stats& GameServer::getStats() const {
+	return fStats;
+}
+
+// Destructor
+GameServer::~GameServer() {
+	for (Connection* connection : fConnections) {
+		if (connection != nullptr) {
+			closeConnection(connection);
+		}
+	}
+	if (fEpollFd >= 0) {
+		::close(fEpollFd);
+	}
+	if (fListenFd >= 0) {
+		::close(fListenFd);
+	}
+}
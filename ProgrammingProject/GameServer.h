@@ -0,0 +1,99 @@
+#ifndef GAMESERVER_H
+#define GAMESERVER_H
+#include "HostedGame.h"
+#include "ProfileStore.h"
+#include "SaveWriter.h"
+#include <csignal>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class ContentPack;
+
+// Multi-session game server: one epoll loop (Linux), one HostedGame per TCP connection.
+// Clients speak plain telnet-style lines: each connection plays a new game through the usual
+// prompts and command grammar ("go up", "status", "inventory", "craft", "travel"). When a game
+// stops for input the server sends telnet GA (IAC GA), so scripted clients know it is their turn.
+// Saves go to a background writer, so one game's disk write never stalls the others, and each
+// player's slots to their own profile, keyed by the player ID asked for at the first save or load.
+// Player IDs are taken on trust (see ProfileStore): bind to a public address only for players
+// who may use each other's saves.
+class GameServer {
+public:
+	struct Options {
+		std::string bindAddress;
+		int port;
+		int maxConnections; // Further connections are accepted and closed straight away
+		std::size_t maxPendingOutput; // Stop reading a client that is this far behind on output
+		std::size_t maxPendingInput; // Drop a client that sends this much without it being read
+		std::string recordDirectory; // If set, every game's replay log is written here when it ends
+		std::string profileDirectory; // Root of the profile store; empty: every game shares the working directory's slots
+		bool compressSaves; // Write save slots compressed
+
+		Options() : bindAddress("127.0.0.1"), port(4000), maxConnections(20000),
+			maxPendingOutput(1024 * 1024), maxPendingInput(64 * 1024), profileDirectory("profiles"),
+			compressSaves(false) {}
+	};
+
+	struct Stats {
+		std::int64_t accepted;
+		std::int64_t rejected;
+		std::int64_t closed;
+		std::int64_t gamesFinished; // Reached an ending, rather than the client hanging up
+		std::int64_t bytesIn;
+		std::int64_t bytesOut;
+	};
+
+private:
+	struct Connection {
+		std::int64_t id; // Order of acceptance, from 1
+		int fd;
+		HostedGame* game;
+		std::string outbox;
+		std::size_t outboxSent;
+		std::uint32_t events; // Registered with epoll
+	};
+
+	const ContentPack& fContent;
+	Options fOptions;
+	int fListenFd;
+	int fEpollFd;
+	std::vector<Connection*> fConnections; // By file descriptor
+	int fConnectionCount;
+	bool fAccepting; // Off while out of descriptors, until a connection closes
+	Stats fStats;
+	ProfileStore fProfileStore;
+	SaveWriter fSaveWriter; // Shared by every game; drained after the connections close
+
+	void acceptConnections();
+	void setAccepting(bool aAccepting);
+	void handleInput(Connection* aConnection);
+	void handleOutput(Connection* aConnection);
+	void runGame(Connection* aConnection); // Resume the game and queue what it printed
+	bool flush(Connection* aConnection); // False if the connection failed
+	void updateEvents(Connection* aConnection);
+	void closeConnection(Connection* aConnection);
+
+public:
+	// Constructor (the content pack is shared read-only by every game)
+	GameServer(const ContentPack& aContent, const Options& aOptions = Options());
+
+	GameServer(const GameServer&) = delete;
+	GameServer& operator=(const GameServer&) = delete;
+
+	// Bind and listen; false with aError set on failure
+	bool start(std::string& aError);
+
+	// Serve until aStop becomes non-zero (set it from a signal handler).
+	// Every aStatsSeconds (0 never) a status line goes to std::cout.
+	void run(const volatile std::sig_atomic_t& aStop, int aStatsSeconds = 0);
+
+	int getConnectionCount() const;
+	const Stats& getStats() const;
+
+	// Destructor (closes every connection, unwinding its game)
+	~GameServer();
+};
+
+#endif /* GAMESERVER_H */
@@ -0,0 +1,168 @@
+#include "GameSession.h"
+#include "AIStoryteller.h"
+#include "AudioEngine.h"
+#include "GameEngine.h"
+#include "GameplayEngine.h"
+#include "ClueJournal.h"
+#include "Location.h"
+#include "Player.h"
+#include <string>
+#include <vector>
+
+namespace {
+
+// FNV-1a over each value's text and a separator, so "ab","c" and "a","bc" differ
+class StateHash {
+private:
+	std::uint64_t fHash;
+
+public:
+	// Constructor
+	StateHash() : fHash(14695981039346656037ULL) {
+	}
+
+	void add(const std::string& aText) {
+		for (char c : aText) {
+			fHash = (fHash ^ static_cast<unsigned char>(c)) * 1099511628211ULL;
+		}
+		fHash = (fHash ^ 0x1f) * 1099511628211ULL;
+	}
+
+	void add(long long aValue) {
+		add(std::to_string(aValue));
+	}
+
+	std::uint64_t get() const {
+		return fHash;
+	}
+};
+
+}
+
+// Initialize static member
+GameSession* GameSession::defaultSession = nullptr;
+
+// Constructor
+GameSession::GameSession(AudioEngine* aAudio, const ContentPack* aContent)
+	: fAudio(aAudio), fOwnsAudio(aAudio == nullptr), fStoryteller(nullptr), fGameplay(nullptr), fEngine(nullptr) {
+	if (fOwnsAudio) {
+		fAudio = new AudioEngine();
+	}
+	// The gameplay engine hands its random streams to the storyteller, so build that first
+	fStoryteller = new AIStoryteller();
+	fGameplay = new GameplayEngine(*this);
+	fEngine = new GameEngine(*this, aContent);
+}
+
+GameSession* GameSession::getDefault() {
+	if (defaultSession == nullptr) {
+		defaultSession = new GameSession(AudioEngine::getInstance());
+	}
+	return defaultSession;
+}
+
+void GameSession::destroyDefault() {
+	if (defaultSession != nullptr) {
+		delete defaultSession;
+		defaultSession = nullptr;
+	}
+}
+
+bool GameSession::initialize() {
+	return fEngine->initialize();
+}
+
+void GameSession::resetGameplay() {
+	delete fGameplay;
+	fGameplay = new GameplayEngine(*this);
+}
+
+void GameSession::playNewGame(std::uint64_t aSeed) {
+	resetGameplay();
+	fStoryteller->reset();
+	fGameplay->setSeed(aSeed);
+	fEngine->handleNewGame();
+}
+
+Player* GameSession::startScriptedGame(std::uint64_t aSeed, Autopilot& aAutopilot) {
+	resetGameplay();
+	fStoryteller->reset();
+	fStoryteller->setOutput(nullptr);
+	fGameplay->setSeed(aSeed);
+	fGameplay->setOutput(nullptr);
+	fGameplay->setAutopilot(&aAutopilot);
+	return fEngine->startScriptedGame("Survivor");
+}
+
+std::uint64_t GameSession::getStateHash() {
+	StateHash hash;
+
+	Player* player = fGameplay->getPlayer();
+	if (player != nullptr) {
+		hash.add(player->getName());
+		hash.add(player->getLevel());
+		hash.add(player->getHealth());
+		hash.add(player->getMaxHealth());
+		hash.add(player->getDamage());
+		hash.add(player->getHunger());
+		hash.add(player->getExperience());
+		hash.add(player->getSkillPoints());
+		hash.add(player->getEquippedWeapon());
+		for (Item& item : player->getInventory()) {
+			hash.add(item.getID());
+			hash.add(item.getQuantity());
+			hash.add(item.getDurability());
+			hash.add(item.getAmmo());
+		}
+
+		std::vector<std::string> skillIDs;
+		std::vector<int> skillLevels;
+		player->getSkillTree().getUnlockedSkillData(skillIDs, skillLevels);
+		for (std::size_t i = 0; i < skillIDs.size(); ++i) {
+			hash.add(skillIDs[i]);
+			hash.add(skillLevels[i]);
+		}
+	}
+
+	Location* location = fGameplay->getCurrentLocation();
+	hash.add(location != nullptr ? location->getID() : std::string());
+	hash.add(fGameplay->getMovementSteps());
+	hash.add(fGameplay->getExplorationProgress());
+	for (const std::string& lootID : fGameplay->getPickedUpLootIDs()) {
+		hash.add(lootID);
+	}
+
+	ClueJournal* journal = fEngine->getJournal();
+	if (journal != nullptr) {
+		for (int clueID : journal->getCollectedClueIDs()) {
+			hash.add(clueID);
+		}
+	}
+	return hash.get();
+}
+
+GameEngine& GameSession::getGameEngine() {
+	return *fEngine;
+}
+
+GameplayEngine& GameSession::getGameplayEngine() {
+	return *fGameplay;
+}
+
+AIStoryteller& GameSession::getStoryteller() {
+	return *fStoryteller;
+}
+
+AudioEngine& GameSession::getAudio() {
+	return *fAudio;
+}
+
+// Destructor (reverse of construction)
+GameSession::~GameSession() {
+	delete fEngine;
+	delete fGameplay;
+	delete fStoryteller;
+	if (fOwnsAudio) {
+		delete fAudio;
+	}
+}
@@ -0,0 +1,68 @@
+#ifndef GAMESESSION_H
+#define GAMESESSION_H
+
+#include <cstdint>
+
+class AIStoryteller;
+class AudioEngine;
+class Autopilot;
+class ContentPack;
+class GameEngine;
+class GameplayEngine;
+class Player;
+
+// One game in progress: the engines and everything they hold (player, world, journal, storyteller,
+// random streams). The console game plays the default session, which the old getInstance()
+// singletons now return. A host can run many sessions side by side; they share only the
+// read-only content pack, if one is passed in.
+class GameSession {
+private:
+	static GameSession* defaultSession;
+
+	AudioEngine* fAudio;
+	bool fOwnsAudio;
+	AIStoryteller* fStoryteller;
+	GameplayEngine* fGameplay;
+	GameEngine* fEngine;
+
+public:
+	// Constructor. Without aAudio the session gets an audio engine of its own; without aContent,
+	// initialize() loads the content pack from disk.
+	explicit GameSession(AudioEngine* aAudio = nullptr, const ContentPack* aContent = nullptr);
+
+	GameSession(const GameSession&) = delete;
+	GameSession& operator=(const GameSession&) = delete;
+
+	// The console game's session, on the process-wide audio device
+	static GameSession* getDefault();
+	static void destroyDefault();
+
+	// Load content (unless shared) and build the world
+	bool initialize();
+
+	// Start over with fresh exploration and combat state (quitting to the title screen)
+	void resetGameplay();
+
+	// A new game from the title screen, on fresh gameplay and storyteller state with the random
+	// streams seeded from aSeed; returns when the game ends
+	void playNewGame(std::uint64_t aSeed);
+
+	// A new game for a scripted player, set up like playNewGame but without the title screens:
+	// aAutopilot answers the prompts and all screen output is discarded. The caller drives the
+	// gameplay engine from here and owns the returned player.
+	Player* startScriptedGame(std::uint64_t aSeed, Autopilot& aAutopilot);
+
+	// Hash of where the game stands: the player, location, exploration progress, picked-up loot
+	// and collected clues. Replays of the same input on the same seed agree on it.
+	std::uint64_t getStateHash();
+
+	GameEngine& getGameEngine();
+	GameplayEngine& getGameplayEngine();
+	AIStoryteller& getStoryteller();
+	AudioEngine& getAudio();
+
+	// Destructor
+	~GameSession();
+};
+
+#endif /* GAMESESSION_H */
@@ -1,6 +1,7 @@
 #include "GameplayEngine.h"
 #include "AudioEngine.h"
 #include "GameEngine.h"
+#include "GameSession.h"
 #include "AIStoryteller.h"
 #include "CommonInfected.h"
 #include "Boomer.h"
@@ -8,39 +9,31 @@
 #include "Smoker.h"
 #include "Tank.h"
 #include "EndingSystem.h"
+#include "CombatRules.h"
+#include "ExplorationRules.h"
+#include "Platform.h"
 #include <iostream>
 #include <iomanip>
+#include <limits>
 #include <cstdlib>
 #include <algorithm>
-#include <thread>
-#include <chrono>
-#include <ctime>
 #include <vector>
 
-#ifdef _WIN32
-#define CLEAR_SCREEN "cls"
-#else
-#define CLEAR_SCREEN "clear"
-#endif
-
-// ============================================================================
-// SINGLETON INSTANCE
-// ============================================================================
-
-GameplayEngine* GameplayEngine::instance = nullptr;
-
 // ============================================================================
 // CONSTRUCTORS & DESTRUCTORS
 // ============================================================================
 
-GameplayEngine::GameplayEngine()
-	: currentPlayer(nullptr), currentLocation(nullptr), journal(nullptr),
-	currentWaveNumber(0), maxWavesPerLocation(1),
-	movementSteps(0), stepsToNewLocation(0), inCombat(false), hasExploredNewArea(false) {
-	srand(static_cast<unsigned int>(time(nullptr)));
+GameplayEngine::GameplayEngine(GameSession& session)
+	: session(session), currentPlayer(nullptr), currentLocation(nullptr), journal(nullptr),
+	currentWaveNumber(0), maxWavesPerLocation(1), bossFight(false),
+	movementSteps(0), stepsToNewLocation(0), inCombat(false), hasExploredNewArea(false),
+	output(&std::cout), silentOutput(nullptr), autopilot(nullptr) {
+	session.getStoryteller().setRandomStreams(&rng);
 }
 
 GameplayEngine::~GameplayEngine() {
+	session.getStoryteller().setRandomStreams(nullptr);
+
 	// Clean up any remaining zombies in queue
 	while (!currentWave.isEmpty()) {
 		delete currentWave.dequeue();
@@ -48,21 +41,15 @@ GameplayEngine::~GameplayEngine() {
 }
 
 // ============================================================================
-// SINGLETON PATTERN
+// SINGLETON COMPATIBILITY
 // ============================================================================
 
 GameplayEngine* GameplayEngine::getInstance() {
-	if (instance == nullptr) {
-		instance = new GameplayEngine();
-	}
-	return instance;
+	return &GameSession::getDefault()->getGameplayEngine();
 }
 
 void GameplayEngine::destroyInstance() {
-	if (instance != nullptr) {
-		delete instance;
-		instance = nullptr;
-	}
+	GameSession::getDefault()->resetGameplay();
 }
 
 // ============================================================================
@@ -79,9 +66,7 @@ void GameplayEngine::initialize(Player* player, Location* location, ClueJournal*
 	hasExploredNewArea = false;
 
 	// Clear combat action history (important when loading a saved game)
-	while (!combatActionHistory.isEmpty()) {
-		combatActionHistory.pop();
-	}
+	combatLog.clear();
 
 	// Always set location to ensure proper initialization
 	if (location != nullptr) {
@@ -105,12 +90,37 @@ void GameplayEngine::setCurrentLocation(Location* location) {
 		populateLocationClues();
 
 		// Set max waves based on location's hazard
-		if (location->getHazardDamage() > 5) {
-			maxWavesPerLocation = 2;
-		}
-		else {
-			maxWavesPerLocation = 1;
-		}
+		maxWavesPerLocation = ExplorationRules::getWaveCount(location->getHazardDamage());
+	}
+}
+
+void GameplayEngine::setOutput(std::ostream* stream) {
+	output = stream != nullptr ? stream : &silentOutput;
+}
+
+void GameplayEngine::setAutopilot(Autopilot* pilot) {
+	autopilot = pilot;
+}
+
+// ============================================================================
+// CONSOLE PACING (skipped on autopilot)
+// ============================================================================
+
+void GameplayEngine::waitForEnter() {
+	if (autopilot == nullptr) {
+		std::cin.get();
+	}
+}
+
+void GameplayEngine::clearScreen() {
+	if (autopilot == nullptr) {
+		Platform::clearScreen();
+	}
+}
+
+void GameplayEngine::sleepFor(int milliseconds) {
+	if (autopilot == nullptr) {
+		Platform::sleepFor(milliseconds);
 	}
 }
 
@@ -119,21 +129,21 @@ void GameplayEngine::setCurrentLocation(Location* location) {
 // ============================================================================
 
 void GameplayEngine::displayCurrentLocation() {
-	system(CLEAR_SCREEN);
-	std::cout << "\n";
-	std::cout << std::string(80, '=') << "\n";
-	std::cout << "  LOCATION: " << currentLocation->getName() << "\n";
-	std::cout << std::string(80, '=') << "\n";
-	std::cout << "\n";
-	std::cout << "  " << currentLocation->getDescription() << "\n\n";
+	clearScreen();
+	out() << "\n";
+	out() << std::string(80, '=') << "\n";
+	out() << "  LOCATION: " << currentLocation->getName() << "\n";
+	out() << std::string(80, '=') << "\n";
+	out() << "\n";
+	out() << "  " << currentLocation->getDescription() << "\n\n";
 
 	if (currentLocation->hasHazard()) {
-		std::cout << "  [!] HAZARD: " << currentLocation->hazardToString()
+		out() << "  [!] HAZARD: " << currentLocation->hazardToString()
 			<< " (" << currentLocation->getHazardDamage() << " HP/turn)\n\n";
 	}
 
 	// Enhanced Player HUD with ASCII bars
-	std::cout << "  " << std::string(76, '-') << "\n";
+	out() << "  " << std::string(76, '-') << "\n";
 	
 	// Health bar
 	int hp = currentPlayer->getHealth();
@@ -142,12 +152,12 @@ void GameplayEngine::displayCurrentLocation() {
 	int barWidth = 20;
 	int hpFilled = (int)(hpPercent * barWidth);
 	
-	std::cout << "  HP: [";
+	out() << "  HP: [";
 	for (int i = 0; i < barWidth; i++) {
-		if (i < hpFilled) std::cout << "=";
-		else std::cout << " ";
+		if (i < hpFilled) out() << "=";
+		else out() << " ";
 	}
-	std::cout << "] " << hp << "/" << maxHP;
+	out() << "] " << hp << "/" << maxHP;
 	
 	// Hunger bar
 	int hunger = currentPlayer->getHunger();
@@ -155,12 +165,12 @@ void GameplayEngine::displayCurrentLocation() {
 	float hungerPercent = (float)hunger / maxHunger;
 	int hungerFilled = (int)(hungerPercent * barWidth);
 	
-	std::cout << "  Hunger: [";
+	out() << "  Hunger: [";
 	for (int i = 0; i < barWidth; i++) {
-		if (i < hungerFilled) std::cout << "=";
-		else std::cout << " ";
+		if (i < hungerFilled) out() << "=";
+		else out() << " ";
 	}
-	std::cout << "] " << hunger << "/" << maxHunger << "\n";
+	out() << "] " << hunger << "/" << maxHunger << "\n";
 	
 	// XP bar and Level
 	int xp = currentPlayer->getExperience();
@@ -168,76 +178,76 @@ void GameplayEngine::displayCurrentLocation() {
 	float xpPercent = (float)xp / xpToNext;
 	int xpFilled = (int)(xpPercent * barWidth);
 	
-	std::cout << "  XP: [";
+	out() << "  XP: [";
 	for (int i = 0; i < barWidth; i++) {
-		if (i < xpFilled) std::cout << "=";
-		else std::cout << " ";
+		if (i < xpFilled) out() << "=";
+		else out() << " ";
 	}
-	std::cout << "] " << xp << "/" << xpToNext;
-	std::cout << "  Level: " << currentPlayer->getLevel() << "  SP: " << currentPlayer->getSkillPoints() << "\n";
+	out() << "] " << xp << "/" << xpToNext;
+	out() << "  Level: " << currentPlayer->getLevel() << "  SP: " << currentPlayer->getSkillPoints() << "\n";
 	
 	// Weapon and Inventory
-	std::cout << "  Weapon: " << currentPlayer->getEquippedWeapon() << " (+" << currentPlayer->getDamage() << " dmg)";
-	std::cout << "    Inventory: " << currentPlayer->getInventorySize() << "/" << currentPlayer->getMaxInventorySpace() << "\n";
+	out() << "  Weapon: " << currentPlayer->getEquippedWeapon() << " (+" << currentPlayer->getDamage() << " dmg)";
+	out() << "    Inventory: " << currentPlayer->getInventorySize() << "/" << currentPlayer->getMaxInventorySpace() << "\n";
 	
 	// Exploration progress
 	float progress = (float)stepsToNewLocation / 12.0f * 100.0f;
 	if (progress > 100.0f) progress = 100.0f;
 	int explorationFilled = (int)(progress / 100.0f * barWidth);
 	
-	std::cout << "  Exploration: [";
+	out() << "  Exploration: [";
 	for (int i = 0; i < barWidth; i++) {
-		if (i < explorationFilled) std::cout << "=";
-		else std::cout << " ";
+		if (i < explorationFilled) out() << "=";
+		else out() << " ";
 	}
-	std::cout << "] " << (int)progress << "% (" << stepsToNewLocation << "/12)\n";
+	out() << "] " << (int)progress << "% (" << stepsToNewLocation << "/12)\n";
 	
-	std::cout << "  " << std::string(76, '-') << "\n\n";
+	out() << "  " << std::string(76, '-') << "\n\n";
 
 	displayLocationLayout();
 
 	// Enhanced command help
-	std::cout << "\n  " << std::string(76, '-') << "\n";
-	std::cout << "  COMMANDS:\n";
-	std::cout << "  Movement: go [left/right/up/down]";
+	out() << "\n  " << std::string(76, '-') << "\n";
+	out() << "  COMMANDS:\n";
+	out() << "  Movement: go [left/right/up/down]";
 	if (canTravelToNewLocation()) {
-		std::cout << " | travel (ready!)";
+		out() << " | travel (ready!)";
 	}
-	std::cout << "\n";
-	std::cout << "  Player:   status | inventory | skills | clues\n";
-	std::cout << "  Actions:  craft | rest | save | menu\n";
-	std::cout << "  " << std::string(76, '-') << "\n";
+	out() << "\n";
+	out() << "  Player:   status | inventory | skills | clues\n";
+	out() << "  Actions:  craft | rest | save | menu\n";
+	out() << "  " << std::string(76, '-') << "\n";
 }
 
 void GameplayEngine::displayLocationLayout() {
-	std::cout << "  AREA MAP:\n";
-	std::cout << "        [UP]\n";
-	std::cout << "         |\n";
-	std::cout << "  [LEFT]-+-[RIGHT]\n";
-	std::cout << "         |\n";
-	std::cout << "       [DOWN]\n\n";
-
-	std::cout << "  LOOT:\n";
+	out() << "  AREA MAP:\n";
+	out() << "        [UP]\n";
+	out() << "         |\n";
+	out() << "  [LEFT]-+-[RIGHT]\n";
+	out() << "         |\n";
+	out() << "       [DOWN]\n\n";
+
+	out() << "  LOOT:\n";
 	bool hasLoot = false;
 	for (const auto& loot : currentLocationLoot) {
 		if (!loot.isPickedUp) {
-			std::cout << "    - " << loot.item.getName() << " ["
-				<< directionToString(loot.location) << "]\n";
+			out() << "    - " << loot.entry->item.getName() << " ["
+				<< directionToString(loot.entry->direction) << "]\n";
 			hasLoot = true;
 		}
 	}
-	if (!hasLoot) std::cout << "    No visible loot.\n";
+	if (!hasLoot) out() << "    No visible loot.\n";
 
-	std::cout << "\n  CLUES:\n";
+	out() << "\n  CLUES:\n";
 	bool hasClues = false;
 	for (const auto& clue : currentLocationClues) {
 		if (!clue.collected) {
-			std::cout << "    - " << clue.clueName << " ["
-				<< directionToString(clue.location) << "]\n";
+			out() << "    - " << clue.entry->clueName << " ["
+				<< directionToString(clue.entry->direction) << "]\n";
 			hasClues = true;
 		}
 	}
-	if (!hasClues) std::cout << "    No clues here.\n";
+	if (!hasClues) out() << "    No clues here.\n";
 }
 
 // ============================================================================
@@ -247,212 +257,32 @@ void GameplayEngine::displayLocationLayout() {
 void GameplayEngine::populateLocationLoot() {
 	currentLocationLoot.clear();
 	if (currentLocation == nullptr) return;
-	
-	std::string locID = currentLocation->getID();
 
-	if (locID == "loc_ruined_city") {
-		Item bandage("loot_001", "Bandage", Item::Category::MEDICAL,
-			"Restores 15 HP", 2, 3, true, true, 15, 0, 0, 0);
-		currentLocationLoot.push_back(Loot("loot_001", bandage, Direction::LEFT));
-		
-		Item food("loot_002", "Canned Food", Item::Category::FOOD,
-			"Restores 30 hunger", 3, 4, true, true, 0, 30, 0, 0);
-		currentLocationLoot.push_back(Loot("loot_002", food, Direction::RIGHT));
-		
-		// NEW: More materials
-		Item cloth("mat_cloth_city", "Cloth", Item::Category::MATERIAL,
-			"Torn fabric for crafting", 3, 2, false, false, 0, 0, 0, 0);
-		currentLocationLoot.push_back(Loot("mat_cloth_city", cloth, Direction::UP));
-		
-		Item wire("mat_wire_city", "Wire", Item::Category::MATERIAL,
-			"Useful for repairs", 2, 1, false, false, 0, 0, 0, 0);
-		currentLocationLoot.push_back(Loot("mat_wire_city", wire, Direction::DOWN));
-	}
-	else if (locID == "loc_industrial") {
-		Item axe("loot_004", "Axe", Item::Category::WEAPON,
-			"Heavy axe. 25 melee damage", 1, 8, false, true, 0, 0, 0, 25);
-		currentLocationLoot.push_back(Loot("loot_004", axe, Direction::LEFT));
-		
-		// Add crafting materials
-		Item cloth("mat_cloth", "Cloth", Item::Category::MATERIAL,
-			"Used for crafting", 2, 2, false, false, 0, 0, 0, 0);
-		currentLocationLoot.push_back(Loot("mat_cloth", cloth, Direction::DOWN));
-		
-		// NEW: More materials
-		Item metalParts("mat_metal_parts", "Metal Parts", Item::Category::MATERIAL,
-			"Scrap metal pieces", 4, 3, false, false, 0, 0, 0, 0);
-		currentLocationLoot.push_back(Loot("mat_metal_parts", metalParts, Direction::UP));
-		
-		Item wire("mat_wire_industrial", "Wire", Item::Category::MATERIAL,
-			"Industrial wire", 3, 1, false, false, 0, 0, 0, 0);
-		currentLocationLoot.push_back(Loot("mat_wire_industrial", wire, Direction::RIGHT));
-	}
-	else if (locID == "loc_hollow_woods") {
-		Item rifle("loot_rifle", "Hunting Rifle", Item::Category::WEAPON,
-			"Powerful rifle. 40 damage", 1, 10, false, true, 0, 0, 0, 40);
-		currentLocationLoot.push_back(Loot("loot_rifle", rifle, Direction::UP));
-		
-		// Add crafting materials
-		Item herbs("mat_herbs", "Herbs", Item::Category::MATERIAL,
-			"Used for potions", 5, 1, false, false, 0, 0, 0, 0);
-		currentLocationLoot.push_back(Loot("mat_herbs", herbs, Direction::LEFT));
-		
-		// NEW: More materials
-		Item food("mat_food_woods", "Food Rations", Item::Category::FOOD,
-			"Preserved food", 2, 3, true, true, 0, 20, 0, 0);
-		currentLocationLoot.push_back(Loot("mat_food_woods", food, Direction::RIGHT));
-		
-		Item bandages("mat_bandages_woods", "Bandages", Item::Category::MATERIAL,
-			"Medical supplies", 3, 2, false, false, 0, 0, 0, 0);
-		currentLocationLoot.push_back(Loot("mat_bandages_woods", bandages, Direction::DOWN));
-	}
-	else if (locID == "loc_cemetery") {
-		Item bandage("loot_cem", "Bandage", Item::Category::MEDICAL,
-			"Medical supplies", 3, 3, true, true, 15, 0, 0, 0);
-		currentLocationLoot.push_back(Loot("loot_cem", bandage, Direction::UP));
-		
-		Item cloth("mat_cloth2", "Cloth", Item::Category::MATERIAL,
-			"Crafting material", 4, 2, false, false, 0, 0, 0, 0);
-		currentLocationLoot.push_back(Loot("mat_cloth2", cloth, Direction::RIGHT));
-		
-		// NEW: More materials
-		Item bandages("mat_bandages_cem", "Bandages", Item::Category::MATERIAL,
-			"First aid supplies", 4, 2, false, false, 0, 0, 0, 0);
-		currentLocationLoot.push_back(Loot("mat_bandages_cem", bandages, Direction::LEFT));
-	}
-	else if (locID == "loc_old_mill") {
-		// NEW: Add loot to Old Mill
-		Item metalParts("mat_metal_mill", "Metal Parts", Item::Category::MATERIAL,
-			"Rusty metal pieces", 3, 3, false, false, 0, 0, 0, 0);
-		currentLocationLoot.push_back(Loot("mat_metal_mill", metalParts, Direction::LEFT));
-		
-		Item food("mat_food_mill", "Food Rations", Item::Category::FOOD,
-			"Old canned food", 2, 3, true, true, 0, 25, 0, 0);
-		currentLocationLoot.push_back(Loot("mat_food_mill", food, Direction::RIGHT));
-	}
-	else if (locID == "loc_canal") {
-		Item water("mat_water", "Water", Item::Category::MATERIAL,
-			"Can be used for potions", 3, 2, false, false, 0, 0, 0, 0);
-		currentLocationLoot.push_back(Loot("mat_water", water, Direction::DOWN));
-		
-		// NEW: More materials
-		Item chemicals("mat_chemicals_canal", "Chemical Supplies", Item::Category::MATERIAL,
-			"Industrial chemicals", 2, 2, false, false, 0, 0, 0, 0);
-		currentLocationLoot.push_back(Loot("mat_chemicals_canal", chemicals, Direction::UP));
-	}
-	else if (locID == "loc_pump_station") {
-		Item antibiotics("mat_antibiotics", "Antibiotics", Item::Category::MATERIAL,
-			"Medical crafting material", 2, 2, false, false, 0, 0, 0, 0);
-		currentLocationLoot.push_back(Loot("mat_antibiotics", antibiotics, Direction::LEFT));
-		
-		Item scrap("mat_scrap", "Scrap Metal", Item::Category::MATERIAL,
-			"For weapon crafting", 5, 1, false, false, 0, 0, 0, 0);
-		currentLocationLoot.push_back(Loot("mat_scrap", scrap, Direction::RIGHT));
-		
-		// NEW: More materials
-		Item wire("mat_wire_pump", "Wire", Item::Category::MATERIAL,
-			"Electrical wire", 4, 1, false, false, 0, 0, 0, 0);
-		currentLocationLoot.push_back(Loot("mat_wire_pump", wire, Direction::UP));
-		
-		Item chemicals("mat_chemicals_pump", "Chemical Supplies", Item::Category::MATERIAL,
-			"Lab chemicals", 2, 2, false, false, 0, 0, 0, 0);
-		currentLocationLoot.push_back(Loot("mat_chemicals_pump", chemicals, Direction::DOWN));
-	}
-	
-	// CRITICAL FIX: Mark loot as picked up if it's in the pickedUpLootIDs list
-	for (auto& loot : currentLocationLoot) {
-		for (const auto& pickedUpID : pickedUpLootIDs) {
-			if (loot.lootID == pickedUpID) {
-				loot.isPickedUp = true;
-				break;
-			}
-		}
+	// The location's loot rows are one contiguous slice of the content pack
+	const ContentPack& content = session.getGameEngine().getContentPack();
+	ContentPack::Slice<ContentPack::LootEntry> loot = content.getLoot(content.findLocation(currentLocation->getID()));
+
+	currentLocationLoot.reserve(loot.size());
+	for (const ContentPack::LootEntry& entry : loot) {
+		currentLocationLoot.push_back(Loot(entry));
+		// Mark loot as picked up if it's in the pickedUpLootIDs list
+		currentLocationLoot.back().isPickedUp = isLootPickedUp(entry.item.getIDSymbol());
 	}
 }
 
 void GameplayEngine::populateLocationClues() {
 	currentLocationClues.clear();
 	if (currentLocation == nullptr) return;
-	
-	std::string locID = currentLocation->getID();
-
-	// Ruined City clues (1-5)
-	if (locID == "loc_ruined_city") {
-		currentLocationClues.push_back(ClueLocation(1, "City Engineer's Journal", Direction::RIGHT));
-		currentLocationClues.push_back(ClueLocation(2, "Graffiti: THE WATER KILLED US", Direction::DOWN));
-		currentLocationClues.push_back(ClueLocation(3, "Apartment Scrawled Note", Direction::LEFT));
-		currentLocationClues.push_back(ClueLocation(4, "Grocery Store Ledger", Direction::UP));
-		currentLocationClues.push_back(ClueLocation(5, "Crowbar Engraving", Direction::RIGHT));
-	}
-	// Industrial District clues (6-10)
-	else if (locID == "loc_industrial") {
-		currentLocationClues.push_back(ClueLocation(6, "Industrial Memo", Direction::LEFT));
-		currentLocationClues.push_back(ClueLocation(7, "Toxic Drum Label", Direction::DOWN));
-		currentLocationClues.push_back(ClueLocation(8, "Warehouse Blueprint", Direction::UP));
-		currentLocationClues.push_back(ClueLocation(9, "Smoker Observation Log", Direction::RIGHT));
-		currentLocationClues.push_back(ClueLocation(10, "Boomer Corpse Notes", Direction::LEFT));
-	}
-	// Hollow Woods clues (11-15 + 52)
-	else if (locID == "loc_hollow_woods") {
-		currentLocationClues.push_back(ClueLocation(11, "Hiker's Journal", Direction::UP));
-		currentLocationClues.push_back(ClueLocation(12, "Hidden Campsite Ledger", Direction::LEFT));
-		currentLocationClues.push_back(ClueLocation(13, "Tree Carving", Direction::RIGHT));
-		currentLocationClues.push_back(ClueLocation(14, "Survivor Corpse Letter", Direction::DOWN));
-		currentLocationClues.push_back(ClueLocation(15, "Hunting Rifle Notes", Direction::UP));
-		currentLocationClues.push_back(ClueLocation(52, "Smoker Snare Notes", Direction::DOWN));
-	}
-	// Old Mill clues (16-19)
-	else if (locID == "loc_old_mill") {
-		currentLocationClues.push_back(ClueLocation(16, "The Butcher's Family Photo", Direction::UP));
-		currentLocationClues.push_back(ClueLocation(17, "Mill Floor Graffiti", Direction::DOWN));
-		currentLocationClues.push_back(ClueLocation(18, "Cleaver Scrap Notes", Direction::LEFT));
-		currentLocationClues.push_back(ClueLocation(19, "Mercy-Kill Choice Prompt", Direction::RIGHT));
-	}
-	// Overgrown Cemetery clues (20-22)
-	else if (locID == "loc_cemetery") {
-		currentLocationClues.push_back(ClueLocation(20, "Gravedigger's Diary", Direction::LEFT));
-		currentLocationClues.push_back(ClueLocation(21, "Tombstone Messages", Direction::DOWN));
-		currentLocationClues.push_back(ClueLocation(22, "Cemetery Gate Key", Direction::UP));
-	}
-	// Polluted Canal clues (23-25)
-	else if (locID == "loc_canal") {
-		currentLocationClues.push_back(ClueLocation(23, "Gas Mask Filter Notes", Direction::RIGHT));
-		currentLocationClues.push_back(ClueLocation(24, "Contaminated Water Journal", Direction::UP));
-		currentLocationClues.push_back(ClueLocation(25, "Government Containment Report", Direction::LEFT));
-	}
-	// Pump Station clues (26-29)
-	else if (locID == "loc_pump_station") {
-		currentLocationClues.push_back(ClueLocation(26, "Tony's Workstation Note", Direction::UP));
-		currentLocationClues.push_back(ClueLocation(27, "Hazmat Suit Remnants", Direction::DOWN));
-		currentLocationClues.push_back(ClueLocation(28, "Emergency Cache List", Direction::LEFT));
-		currentLocationClues.push_back(ClueLocation(29, "Survivor Message on Control Panel", Direction::RIGHT));
-		currentLocationClues.push_back(ClueLocation(52, "Smoker Snare Notes", Direction::DOWN));
-	}
-	// Suburban Wasteland clues (30-32)
-	else if (locID == "loc_suburban") {
-		currentLocationClues.push_back(ClueLocation(30, "Parent's Diary", Direction::LEFT));
-		currentLocationClues.push_back(ClueLocation(31, "Toy Soldier Collection", Direction::UP));
-		currentLocationClues.push_back(ClueLocation(32, "Locked Basement Note", Direction::DOWN));
-	}
-	// Abandoned Hospital clues (42-46)
-	else if (locID == "loc_hospital") {
-		currentLocationClues.push_back(ClueLocation(42, "Patient Zero Observation Report", Direction::UP));
-		currentLocationClues.push_back(ClueLocation(43, "Doctor's Audio Recording", Direction::LEFT));
-		currentLocationClues.push_back(ClueLocation(44, "Surgery Kit Label", Direction::RIGHT));
-		currentLocationClues.push_back(ClueLocation(45, "Hospital Gurney Notes", Direction::DOWN));
-		currentLocationClues.push_back(ClueLocation(46, "Military Orders", Direction::UP));
-	}
-	
-	// CRITICAL FIX: Mark clues as collected if they're in the journal's collected list
-	if (journal != nullptr) {
-		std::vector<int> collectedIDs = journal->getCollectedClueIDs();
-		for (auto& clue : currentLocationClues) {
-			for (int collectedID : collectedIDs) {
-				if (clue.clueID == collectedID) {
-					clue.collected = true;
-					break;
-				}
-			}
+
+	const ContentPack& content = session.getGameEngine().getContentPack();
+	ContentPack::Slice<ContentPack::ClueSpawnEntry> clues = content.getClueSpawns(content.findLocation(currentLocation->getID()));
+
+	currentLocationClues.reserve(clues.size());
+	for (const ContentPack::ClueSpawnEntry& entry : clues) {
+		currentLocationClues.push_back(ClueLocation(entry));
+		// Mark clues as collected if they're in the journal's collected list
+		if (journal != nullptr) {
+			currentLocationClues.back().collected = journal->isClueCollected(entry.clueID);
 		}
 	}
 }
@@ -462,38 +292,40 @@ void GameplayEngine::populateLocationClues() {
 // ============================================================================
 
 void GameplayEngine::moveInDirection(Direction direction) {
-	system(CLEAR_SCREEN);
+	clearScreen();
 	
 	// Decrease hunger per movement
 	int currentHunger = currentPlayer->getHunger();
-	currentPlayer->setHunger(currentHunger - 2);
+	currentPlayer->setHunger(currentHunger - ExplorationRules::HUNGER_PER_STEP);
 	
 	// Hunger status effects
 	std::string hungerStatus = "";
-	if (currentHunger <= 10) {
+	if (currentHunger <= ExplorationRules::STARVING_HUNGER) {
 		hungerStatus = " [STARVING]";
 		// Health drain when starving
-		currentPlayer->takeDamage(1);
-		std::cout << "\n  [WARNING] You're starving! (-1 HP)\n";
+		currentPlayer->takeDamage(ExplorationRules::STARVING_DAMAGE);
+		out() << "\n  [WARNING] You're starving! (-1 HP)\n";
 	}
 	else if (currentHunger <= 30) {
 		hungerStatus = " [HUNGRY]";
 	}
 	
-	std::cout << "\n  You explore " << directionToString(direction) << "..." << hungerStatus << "\n\n";
+	out() << "\n  You explore " << directionToString(direction) << "..." << hungerStatus << "\n\n";
 	
 	// Increment exploration
 	movementSteps++;
 	stepsToNewLocation++;
 	
 	// AI STORYTELLER: Update with current player state
-	AIStoryteller* aiStoryteller = AIStoryteller::getInstance();
+	AIStoryteller* aiStoryteller = &session.getStoryteller();
 	aiStoryteller->update(currentPlayer, movementSteps);
 	
 	// AI STORYTELLER INFLUENCE #3: Random events based on player state
 	if (aiStoryteller->shouldTriggerEvent()) {
 		std::string event = aiStoryteller->generateRandomEvent();
 		aiStoryteller->handleEvent(event);
+		out() << "\n  Press ENTER to continue...";
+		waitForEnter();
 		
 		// Apply event effects
 		if (event == "SUPPLY_DROP" || event == "MEDICAL_CACHE") {
@@ -502,7 +334,7 @@ void GameplayEngine::moveInDirection(Direction direction) {
 			int newHP = currentPlayer->getHealth() + healAmount;
 			if (newHP > currentPlayer->getMaxHealth()) newHP = currentPlayer->getMaxHealth();
 			currentPlayer->setHealth(newHP);
-			std::cout << "  [HEALED] Restored " << healAmount << " HP!\n";
+			out() << "  [HEALED] Restored " << healAmount << " HP!\n";
 		}
 		else if (event == "HORDE_INCOMING") {
 			startCombat();
@@ -519,80 +351,76 @@ void GameplayEngine::moveInDirection(Direction direction) {
 			std::vector<int> uncollectedClueIDs;
 			for (const auto& clue : currentLocationClues) {
 				if (!clue.collected) {
-					uncollectedClueIDs.push_back(clue.clueID);
+					uncollectedClueIDs.push_back(clue.entry->clueID);
 				}
 			}
 			
 			if (!uncollectedClueIDs.empty()) {
-				int randomClueID = uncollectedClueIDs[rand() % uncollectedClueIDs.size()];
+				int randomClueID = uncollectedClueIDs[rng.events().nextInt(static_cast<int>(uncollectedClueIDs.size()))];
 				Clue* discoveredClue = journal->getClue(randomClueID);
 				
 				if (discoveredClue != nullptr) {
-					system("cls");
-					std::cout << "\n" << std::string(80, '=') << "\n";
-					std::cout << "  [DISCOVERED LORE] " << discoveredClue->getClueName() << "\n";
-					std::cout << std::string(80, '=') << "\n\n";
-					std::cout << "  \"" << discoveredClue->getContent() << "\"\n\n";
-					std::cout << "  Location: " << discoveredClue->getLocationFound() << "\n";
-					std::cout << "  Effect: " << discoveredClue->getEffect() << "\n";
-					std::cout << "\n" << std::string(80, '=') << "\n";
-					std::cout << "  Press ENTER...";
-					std::cin.get();
+					clearScreen();
+					out() << "\n" << std::string(80, '=') << "\n";
+					out() << "  [DISCOVERED LORE] " << discoveredClue->getClueName() << "\n";
+					out() << std::string(80, '=') << "\n\n";
+					out() << "  \"" << discoveredClue->getContent() << "\"\n\n";
+					out() << "  Location: " << discoveredClue->getLocationFound() << "\n";
+					out() << "  Effect: " << discoveredClue->getEffect() << "\n";
+					out() << "\n" << std::string(80, '=') << "\n";
+					out() << "  Press ENTER...";
+					waitForEnter();
 				}
 			}
 		}
 	}
 	
-	// Determine ONE event type (better pacing - no simultaneous events)
-	int eventRoll = rand() % 100;
-	bool eventOccurred = false;
-	
-	// Apply scavenging skill bonus to loot chance
+	// Apply scavenging skill bonus to loot chance (base 45%, capped at 70%)
 	float scavengeBonus = currentPlayer->getSkillTree().getTotalScavengeBonus();
-	int lootChance = 45; // Base 45%
-	if (scavengeBonus > 0) {
-		lootChance = (int)(45 * (1.0f + scavengeBonus));
-		if (lootChance > 70) lootChance = 70; // Cap at 70%
-	}
+	int lootChance = ExplorationRules::getLootChance(scavengeBonus);
 	
+	// Determine ONE event type (better pacing - no simultaneous events)
 	// Priority: Loot (45% + bonus) > Clue (35%) > Combat (15%) > Hazard (5%)
-	if (eventRoll < lootChance && !eventOccurred) {
+	ExplorationRules::StepEvent stepEvent = ExplorationRules::rollStepEvent(lootChance, currentLocation->getZombieCount() > 0, rng.events());
+	bool eventOccurred = false;
+	
+	if (stepEvent == ExplorationRules::StepEvent::LOOT && !eventOccurred) {
 		// Loot event (increased from 30% to 45%, with scavenge bonus)
 		checkForLoot(direction);
 		eventOccurred = true;
 		
 		// AI STORYTELLER INFLUENCE #2: Bonus healing when player is struggling
-		AIStoryteller* ai = AIStoryteller::getInstance();
+		AIStoryteller* ai = &session.getStoryteller();
 		if (ai->shouldGrantBonusLoot()) {
 			int bonusHeal = 20;
 			int newHP = currentPlayer->getHealth() + bonusHeal;
 			if (newHP > currentPlayer->getMaxHealth()) newHP = currentPlayer->getMaxHealth();
 			currentPlayer->setHealth(newHP);
-			std::cout << "  [AI BONUS] Found emergency supplies! Restored " << bonusHeal << " HP!\n";
+			out() << "  [AI BONUS] Found emergency supplies! Restored " << bonusHeal << " HP!\n";
 		}
 		
 		// Scavenger bonus: chance for extra loot!
-		if (scavengeBonus > 0 && rand() % 100 < (int)(scavengeBonus * 100)) {
-			std::cout << "  [SCAVENGER] You spot extra loot nearby!\n";
+		if (scavengeBonus > 0 && rng.loot().rollPercent((int)(scavengeBonus * 100))) {
+			out() << "  [SCAVENGER] You spot extra loot nearby!\n";
 			// Find another loot in a different direction
 			Direction extraDir = static_cast<Direction>((static_cast<int>(direction) + 1) % 4);
 			checkForLoot(extraDir);
 		}
 	}
-	else if (eventRoll < 80 && !eventOccurred) {
+	else if (stepEvent == ExplorationRules::StepEvent::CLUE && !eventOccurred) {
 		// Clue event (increased from 25% to 35%, cumulative 45+35=80)
 		checkForClue(direction);
 		eventOccurred = true;
 	}
-	else if (eventRoll < 95 && currentLocation->getZombieCount() > 0 && !eventOccurred) {
+	else if (stepEvent == ExplorationRules::StepEvent::COMBAT && !eventOccurred) {
 		// Combat event (reduced from 30% to 15%)
-		std::cout << "  [!] Zombies detected!\n\n";
-		AudioEngine::getInstance()->playCombatAttackSound();
-		std::this_thread::sleep_for(std::chrono::milliseconds(1500));
+		out() << "  [!] Zombies detected!\n\n";
+		session.getAudio().playCombatAttackSound();
+		sleepFor(1500);
 		startCombat();
 		eventOccurred = true;
 	}
-	else if (eventRoll < 100 && !eventOccurred) {
+	else if (stepEvent == ExplorationRules::StepEvent::HAZARD && !eventOccurred) {
 		// Hazard event (5%)
 		checkForHazard();
 		eventOccurred = true;
@@ -600,60 +428,67 @@ void GameplayEngine::moveInDirection(Direction direction) {
 	
 	// Nothing found (5% chance or if no events available)
 	if (!eventOccurred) {
-		std::cout << "  The area is quiet. Nothing of interest here.\n\n";
+		out() << "  The area is quiet. Nothing of interest here.\n\n";
 	}
 	
 	// Show exploration progress
 	float progress = (float)stepsToNewLocation / 12.0f * 100.0f;
 	if (progress > 100.0f) progress = 100.0f;
 	
-	std::cout << "\n  Area Explored: " << (int)progress << "%";
+	out() << "\n  Area Explored: " << (int)progress << "%";
 	int barWidth = 20;
 	int filled = (int)(progress / 100.0f * barWidth);
-	std::cout << " [";
+	out() << " [";
 	for (int i = 0; i < barWidth; i++) {
-		if (i < filled) std::cout << "=";
-		else std::cout << " ";
+		if (i < filled) out() << "=";
+		else out() << " ";
 	}
-	std::cout << "]\n";
+	out() << "]\n";
 	
 	// Check if ready for new location (changed from 15 to 12)
-	if (stepsToNewLocation >= 12 && !hasExploredNewArea) {
-		std::cout << "\n  [!] Area fully explored!";
-		std::cout << "\n  [!] You can now travel to a new location (type 'travel').\n";
+	if (stepsToNewLocation >= ExplorationRules::STEPS_TO_EXPLORE && !hasExploredNewArea) {
+		out() << "\n  [!] Area fully explored!";
+		out() << "\n  [!] You can now travel to a new location (type 'travel').\n";
 		hasExploredNewArea = true;
 	}
 	
 	// Hunger warning
 	if (currentPlayer->getHunger() <= 30 && currentPlayer->getHunger() > 10) {
-		std::cout << "\n  [!] You're getting hungry. Find food soon!\n";
+		out() << "\n  [!] You're getting hungry. Find food soon!\n";
 	}
 	
-	std::cout << "\n  Press ENTER...";
-	std::cin.get();
+	out() << "\n  Press ENTER...";
+	waitForEnter();
 }
 
 void GameplayEngine::checkForLoot(Direction direction) {
 	for (auto& loot : currentLocationLoot) {
-		if (loot.location == direction && !loot.isPickedUp) {
-			std::cout << "  [LOOT] Found: " << loot.item.getName() << "!\n";
-			std::cout << "  Pick up? (y/n): ";
+		if (loot.entry->direction == direction && !loot.isPickedUp) {
+			out() << "  [LOOT] Found: " << loot.entry->item.getName() << "!\n";
+			out() << "  Pick up? (y/n): ";
 
-			char choice;
-			std::cin >> choice;
-			std::cin.ignore();
+			bool take = false;
+			if (autopilot != nullptr) {
+				take = autopilot->takeLoot(loot.entry->item);
+			}
+			else {
+				char choice;
+				std::cin >> choice;
+				std::cin.ignore();
+				take = choice == 'y' || choice == 'Y';
+			}
 
-			if (choice == 'y' || choice == 'Y') {
-				if (currentPlayer->getInventorySize() + loot.item.getInventorySpace()
+			if (take) {
+				if (currentPlayer->getInventorySize() + loot.entry->item.getInventorySpace()
 					<= currentPlayer->getMaxInventorySpace()) {
-					currentPlayer->addItem(loot.item);
+					currentPlayer->addItem(loot.entry->item);
 					loot.isPickedUp = true;
-					addPickedUpLootID(loot.lootID); // Record this loot was picked up
-					AudioEngine::getInstance()->playLootPickupSound();
-					std::cout << "  [SUCCESS] Added!\n\n";
+					addPickedUpLootID(loot.entry->item.getIDSymbol()); // Record this loot was picked up
+					session.getAudio().playLootPickupSound();
+					out() << "  [SUCCESS] Added!\n\n";
 				}
 				else {
-					std::cout << "  [ERROR] Inventory full!\n\n";
+					out() << "  [ERROR] Inventory full!\n\n";
 				}
 			}
 			break;
@@ -663,11 +498,11 @@ void GameplayEngine::checkForLoot(Direction direction) {
 
 void GameplayEngine::checkForClue(Direction direction) {
 	for (auto& clue : currentLocationClues) {
-		if (clue.location == direction && !clue.collected) {
-			std::cout << "  [CLUE] " << clue.clueName << "!\n\n";
-			Clue* actualClue = journal->getClue(clue.clueID);
+		if (clue.entry->direction == direction && !clue.collected) {
+			out() << "  [CLUE] " << clue.entry->clueName << "!\n\n";
+			Clue* actualClue = journal->getClue(clue.entry->clueID);
 			if (actualClue != nullptr) {
-				journal->collectClue(clue.clueID);
+				journal->collectClue(clue.entry->clueID);
 				clue.collected = true;
 			}
 			break;
@@ -678,10 +513,10 @@ void GameplayEngine::checkForClue(Direction direction) {
 void GameplayEngine::checkForHazard() {
 	if (currentLocation->getHazardDamage() > 0) {
 		int damage = currentLocation->getHazardDamage();
-		std::cout << "  [HAZARD] " << currentLocation->hazardToString() << "!\n";
-		std::cout << "  You take " << damage << " damage!\n\n";
+		out() << "  [HAZARD] " << currentLocation->hazardToString() << "!\n";
+		out() << "  You take " << damage << " damage!\n\n";
 		currentPlayer->takeDamage(damage);
-		AudioEngine::getInstance()->playEnvironmentalHazardSound();
+		session.getAudio().playEnvironmentalHazardSound();
 	}
 }
 
@@ -694,24 +529,24 @@ void GameplayEngine::checkForLocationTransition() {
 // ============================================================================
 
 void GameplayEngine::displayLootOptions() {
-	system(CLEAR_SCREEN);
-	std::cout << "\n  AVAILABLE LOOT:\n\n";
+	clearScreen();
+	out() << "\n  AVAILABLE LOOT:\n\n";
 
 	int count = 0;
 	for (const auto& loot : currentLocationLoot) {
 		if (!loot.isPickedUp) {
 			count++;
-			std::cout << "    - " << loot.item.getName()
-				<< " (" << directionToString(loot.location) << ")\n";
+			out() << "    - " << loot.entry->item.getName()
+				<< " (" << directionToString(loot.entry->direction) << ")\n";
 		}
 	}
 
 	if (count == 0) {
-		std::cout << "    No loot here.\n";
+		out() << "    No loot here.\n";
 	}
 
-	std::cout << "\n  Press ENTER...";
-	std::cin.get();
+	out() << "\n  Press ENTER...";
+	waitForEnter();
 }
 
 // ============================================================================
@@ -727,9 +562,66 @@ void GameplayEngine::interactWithClue(int clueIndex) {
 		auto& clue = currentLocationClues[clueIndex];
 		if (!clue.collected) {
 			clue.collected = true;
-			journal->collectClue(clue.clueID);
+			journal->collectClue(clue.entry->clueID);
+		}
+	}
+}
+
+// ============================================================================
+// SURVIVAL ACTIONS
+// ============================================================================
+
+void GameplayEngine::rest() {
+	int newHP = currentPlayer->getHealth() + ExplorationRules::REST_HEAL;
+	if (newHP > currentPlayer->getMaxHealth()) {
+		newHP = currentPlayer->getMaxHealth();
+	}
+	currentPlayer->setHealth(newHP);
+}
+
+bool GameplayEngine::useItem(const Item& item) {
+	bool itemUsed = false;
+
+	// Healing items
+	if (item.getHealthRestore() > 0) {
+		int newHP = currentPlayer->getHealth() + item.getHealthRestore();
+		if (newHP > currentPlayer->getMaxHealth()) {
+			newHP = currentPlayer->getMaxHealth();
+		}
+		currentPlayer->setHealth(newHP);
+		out() << "\n  [USED] " << item.getName() << "! Restored "
+			<< item.getHealthRestore() << " HP.\n";
+		itemUsed = true;
+
+		// Track in combat history if in combat
+		if (inCombat) {
+			combatLog.record(CombatEvent::Action::USED_HEALING_ITEM, currentPlayer->getName(), item.getName(), item.getHealthRestore());
 		}
 	}
+
+	// Food items (restore hunger)
+	if (item.getCategory() == Item::Category::FOOD) {
+		int hungerRestore = 30; // Default food restores 30 hunger
+		int newHunger = currentPlayer->getHunger() + hungerRestore;
+		if (newHunger > currentPlayer->getMaxHunger()) {
+			newHunger = currentPlayer->getMaxHunger();
+		}
+		currentPlayer->setHunger(newHunger);
+		out() << "\n  [USED] " << item.getName() << "! Restored "
+			<< hungerRestore << " Hunger.\n";
+		itemUsed = true;
+
+		// Track in combat history if in combat
+		if (inCombat) {
+			combatLog.record(CombatEvent::Action::USED_FOOD_ITEM, currentPlayer->getName(), item.getName(), hungerRestore);
+		}
+	}
+
+	if (itemUsed) {
+		// Remove item (decrease quantity)
+		currentPlayer->removeItem(item);
+	}
+	return itemUsed;
 }
 
 // ============================================================================
@@ -737,119 +629,128 @@ void GameplayEngine::interactWithClue(int clueIndex) {
 // ============================================================================
 
 void GameplayEngine::startCombat() {
+	bool isSanctuaryBoss = (currentLocation != nullptr && ExplorationRules::isBossLocation(currentLocation->getID()));
+	startEncounter(maxWavesPerLocation, isSanctuaryBoss);
+}
+
+void GameplayEngine::startEncounter(int waveCount, bool isBossFight) {
 	inCombat = true;
 	currentWaveNumber = 0;
+	maxWavesPerLocation = waveCount;
+	bossFight = isBossFight;
 
 	// Start combat music (pauses location music)
-	bool isSanctuaryBoss = (currentLocation != nullptr && currentLocation->getID() == "loc_sanctuary");
-
-	if (currentLocation && !isSanctuaryBoss) {  // Only play combat music if NOT sanctuary boss
+	if (currentLocation && !bossFight) {  // Only play combat music if NOT sanctuary boss
 		// Start combat
-		AudioEngine* audio = AudioEngine::getInstance();
-		if (audio != nullptr) {
-			audio->playCombatMusic();
-		}
+		session.getAudio().playCombatMusic();
 	}
 
-	system(CLEAR_SCREEN);
-	std::cout << "\n" << std::string(80, '=') << "\n";
-	std::cout << "  COMBAT INITIATED!\n";
-	std::cout << std::string(80, '=') << "\n\n";
+	clearScreen();
+	out() << "\n" << std::string(80, '=') << "\n";
+	out() << "  COMBAT INITIATED!\n";
+	out() << std::string(80, '=') << "\n\n";
 
 	spawnZombieWave();
 	CombatResult result = conductCombat();
 
 	if (result.playerWon) {
-		std::cout << "  [REWARD] Victory! You gained experience.\n";
+		out() << "  [REWARD] Victory! You gained experience.\n";
+	}
+	if (autopilot != nullptr) {
+		autopilot->combatEnded(result);
 	}
 
 	// Stop combat music and resume location music
-	AudioEngine::getInstance()->stopCombatMusic();
+	session.getAudio().stopCombatMusic();
 }
 
 void GameplayEngine::spawnZombieWave() {
 	currentWaveNumber++;
-	std::cout << "  [WAVE " << currentWaveNumber << "]\n\n";
+	out() << "  [WAVE " << currentWaveNumber << "]\n\n";
 
 	while (!currentWave.isEmpty()) {
 		delete currentWave.dequeue();
 	}
 
 	// SANCTUARY BOSS FIGHT: Only spawn one Tank
-	bool isSanctuaryBoss = (currentLocation != nullptr && currentLocation->getID() == "loc_sanctuary");
-	
-	if (isSanctuaryBoss) {
+	if (bossFight) {
 		// Spawn only the Tank boss for sanctuary
 		Zombie* tankBoss = new Tank("boss_tank", "The Protector");
 		currentWave.enqueue(tankBoss);
-		std::cout << "  1 boss appears!\n\n";
+		out() << "  1 boss appears!\n\n";
 	}
 	else {
 		// Normal wave spawning for other locations
-		int zombieCount = 3 + (rand() % 4); // 3-6 zombies per wave
+		int zombieCount = CombatRules::rollWaveSize(rng.combat()); // 3-6 zombies per wave
 		
 		// AI STORYTELLER INFLUENCE #1: Adjust zombie count based on player state
-		AIStoryteller* ai = AIStoryteller::getInstance();
+		AIStoryteller* ai = &session.getStoryteller();
 		zombieCount = ai->adjustZombieCount(zombieCount);
+		currentWave.reserve(zombieCount);
 
 		for (int i = 0; i < zombieCount; ++i) {
 			Zombie* zombie = nullptr;
-			int type = rand() % 100;
 
 			// Increased special zombie spawning
-			if (type < 40) {  // 40% Boomer
+			switch (CombatRules::rollZombieKind(rng.combat())) {
+			case ContentPack::ZombieKind::BOOMER:
 				zombie = new Boomer("boomer_" + std::to_string(i), "Boomer");
-			}
-			else if (type < 65) {  // 25% Spitter
+				break;
+			case ContentPack::ZombieKind::SPITTER:
 				zombie = new Spitter("spitter_" + std::to_string(i), "Spitter");
-			}
-			else if (type < 85) {  // 20% Smoker
+				break;
+			case ContentPack::ZombieKind::SMOKER:
 				zombie = new Smoker("smoker_" + std::to_string(i), "Smoker");
-			}
-			else {  // 15% Tank
+				break;
+			default:
 				zombie = new Tank("tank_" + std::to_string(i), "Tank");
+				break;
 			}
 
 			currentWave.enqueue(zombie);
 		}
 
-		std::cout << "" << zombieCount << " zombies appear!\n\n";
+		out() << "" << zombieCount << " zombies appear!\n\n";
 	}
 
-	std::this_thread::sleep_for(std::chrono::milliseconds(800));
+	sleepFor(800);
 }
 
 CombatResult GameplayEngine::conductCombat() {
 	CombatResult result;
-	bool isBossFight = currentLocation && currentLocation->getID() == "loc_sanctuary";
+	bool isBossFight = bossFight;
 	
 	Zombie* currentZombie = nullptr;
 
 	while (!currentWave.isEmpty() || currentZombie != nullptr) {
-		system(CLEAR_SCREEN);
-		std::cout << "\n  COMBAT\n\n";
+		combatLog.nextRound();
+		clearScreen();
+		out() << "\n  COMBAT\n\n";
 
 		if (currentZombie == nullptr || currentZombie->getHealth() <= 0) {
 			if (currentZombie != nullptr) {
-				std::cout << "  [KILL] " << currentZombie->getType() << " defeated!\n";
+				out() << "  [KILL] " << currentZombie->getType() << " defeated!\n";
 
-				combatActionHistory.push("Killed " + currentZombie->getType());
+				combatLog.record(CombatEvent::Action::KILLED, currentPlayer->getName(), currentZombie->getType());
 				
 				// Trigger zombie death effects (e.g., Boomer explosion)
-				currentZombie->onDeath(currentPlayer);
+				out() << currentZombie->onDeath(currentPlayer);
+				if (autopilot != nullptr) {
+					autopilot->zombieKilled(*currentZombie);
+				}
 				
 				// Award XP
 				int xpGain = 10;
 				if (isBossFight) {
 					xpGain = 100; // Boss grants more XP
-					std::cout << "  [+XP BOSS] Gained " << xpGain << " experience!\n";
+					out() << "  [+XP BOSS] Gained " << xpGain << " experience!\n";
 				}
 				else {
 					currentPlayer->gainExperience(xpGain);
-					std::cout << "  [+XP] Gained " << xpGain << " experience!\n\n";
+					out() << "  [+XP] Gained " << xpGain << " experience!\n\n";
 				}
 				
-				AudioEngine::getInstance()->playZombieDeathSound();
+				session.getAudio().playZombieDeathSound();
 				result.zombiesKilled++;
 				delete currentZombie;
 				currentZombie = nullptr;
@@ -857,8 +758,8 @@ CombatResult GameplayEngine::conductCombat() {
 
 			if (currentWave.isEmpty()) {
 				if (currentWaveNumber < maxWavesPerLocation) {
-					std::cout << "Next wave...\n\n";
-					std::this_thread::sleep_for(std::chrono::milliseconds(1500));
+					out() << "Next wave...\n\n";
+					sleepFor(1500);
 					spawnZombieWave();
 					continue;
 				}
@@ -870,144 +771,101 @@ CombatResult GameplayEngine::conductCombat() {
 			currentZombie = currentWave.dequeue();
 		}
 
-		// Display zombie with health bar
-		if (currentZombie) {
-			int zombieHP = currentZombie->getHealth();
-			int zombieMaxHP = currentZombie->getMaxHealth();
-			float zombieHPPercent = (float)zombieHP / zombieMaxHP;
-			int barWidth = 20;
-			int filled = (int)(zombieHPPercent * barWidth);
-			
-			// Boss fight special display
-			if (isBossFight) {
-				std::cout << "  ===============================================================\n";
-				std::cout << "  BOSS: " << currentZombie->getType() << " - THE PROTECTOR\n";
-				std::cout << "  ===============================================================\n";
-			}
-			else {
-				std::cout << "  Enemy: " << currentZombie->getType() << "\n";
-			}
-			
-			std::cout << "  [";
-			for (int i = 0; i < barWidth; i++) {
-				if (i < filled) std::cout << "=";
-				else std::cout << " ";
-			}
-			std::cout << "] " << (int)(zombieHPPercent * 100) << "%\n";
-			std::cout << "  HP: " << zombieHP << "/" << zombieMaxHP << "\n";
-			std::cout << "  Remaining: " << currentWave.size() << "\n\n";
+		// Nothing to draw when the screen output goes nowhere (a scripted player)
+		if (output != &silentOutput) {
+			displayCombatStatus(currentZombie, isBossFight);
 		}
 
-		// Display player stats
-		std::cout << "  YOU: " << currentPlayer->getHealth() << "/" << currentPlayer->getMaxHealth() << " HP\n";
-		std::cout << "  Weapon: " << currentPlayer->getEquippedWeapon() << "\n";
-
-		// Display combat history (latest actions first)
-		if (!combatActionHistory.isEmpty()) {
-			std::cout << "\n  RECENT ACTIONS:\n";
-
-			// Create array to store latest actions
-			std::string actions[MAX_COMBAT_HISTORY];
-			int actionCount = 0;
-
-			// Pop all actions into temp stack to reverse order
-			Stack<std::string> tempStack;
-			while (!combatActionHistory.isEmpty()) {
-				tempStack.push(combatActionHistory.pop());
-			}
-
-			// Restore to original and collect latest MAX_COMBAT_HISTORY actions
-			while (!tempStack.isEmpty()) {
-				std::string action = tempStack.pop();
-				combatActionHistory.push(action);  // Restore to original stack
-
-				// Store in array (shift older actions down)
-				if (actionCount < MAX_COMBAT_HISTORY) {
-				actions[actionCount++] = action;
-				} else {
-					// Shift all actions down and add new one at end
-					for (int i = 0; i < MAX_COMBAT_HISTORY - 1; i++) {
-						actions[i] = actions[i + 1];
-					}
-					actions[MAX_COMBAT_HISTORY - 1] = action;
-				}
-			}
-
-			// Display latest actions first (reverse array order)
-			for (int i = actionCount - 1; i >= 0; i--) {
-				std::cout << "  [" << (actionCount - i) << "] " << actions[i] << "\n";
+		int action = 0;
+		if (autopilot != nullptr) {
+			switch (autopilot->chooseCombatAction(*currentPlayer, *currentZombie, isBossFight)) {
+			case CombatRules::Action::ATTACK:
+				action = 1;
+				break;
+			case CombatRules::Action::DODGE:
+				action = 2;
+				break;
+			default: // Flee, or special attack in a boss fight
+				action = 4;
+				break;
 			}
 		}
-		std::cout << "\n";
-
-		// Boss fight special menu
-		if (isBossFight) {
-			std::cout << "  [1] Attack  [2] Dodge  [3] Item  [4] Special Attack (uses items)\n";
-		}
 		else {
-			std::cout << "  [1] Attack  [2] Dodge  [3] Item  [4] Flee\n";
+			std::cin >> action;
+
+			if (std::cin.eof()) {
+				// Input closed (e.g. a recorded or scripted run finished): walk away from the fight
+				// rather than re-reading nothing forever; the exploration loop then ends the session
+				while (!currentWave.isEmpty()) delete currentWave.dequeue();
+				if (currentZombie) delete currentZombie;
+				inCombat = false;
+				return result;
+			}
+			if (std::cin.fail()) {
+				// Not a number: drop the line and count it as no action, instead of failing every read after it
+				std::cin.clear();
+				std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+				action = 0;
+			}
+			else {
+				std::cin.ignore();
+			}
 		}
-		
-		std::cout << "  Choice: ";
-
-		int action;
-		std::cin >> action;
-		std::cin.ignore();
+		result.rounds++;
 
 		switch (action) {
 		case 1: { // Attack
-			AudioEngine::getInstance()->playCombatAttackSound();
-			int baseDamage = currentPlayer->getDamage() + (rand() % 5) - 2;
+			session.getAudio().playCombatAttackSound();
+			CombatRules::RoundResult round = CombatRules::resolveAction(CombatRules::Action::ATTACK,
+				CombatRules::getPlayerStats(*currentPlayer), CombatRules::getZombieStats(*currentZombie), rng.combat());
 			
-			// Apply hunger penalty
-			int hunger = currentPlayer->getHunger();
-			float hungerMultiplier = 1.0f;
-			if (hunger <= 30) {
-				hungerMultiplier = 0.5f; // 50% damage when hungry
-				std::cout << "\n  [HUNGRY] Your attacks are weakened!\n";
+			// Hunger penalty (50% damage when hungry)
+			if (round.weakened) {
+				out() << "\n  [HUNGRY] Your attacks are weakened!\n";
 			}
 			
-			int damage = (int)(baseDamage * hungerMultiplier);
+			int damage = round.damageDealt;
 
-			if ((rand() % 100) < 80) {
-				std::cout << "\n  [HIT] Deal " << damage << " damage!\n";
-				AudioEngine::getInstance()->playCombatHitSound();
+			if (round.hit) {
+				out() << "\n  [HIT] Deal " << damage << " damage!\n";
+				session.getAudio().playCombatHitSound();
 				currentZombie->takeDamage(damage);
 				result.playerDamageDealt += damage;
 
-				combatActionHistory.push("Dealt " + std::to_string(damage) + " dmg to " + currentZombie->getType());
+				combatLog.record(CombatEvent::Action::DEALT_DAMAGE, currentPlayer->getName(), currentZombie->getType(), damage);
 
 				if (currentZombie->getHealth() > 0) {
-					// Zombie counter-attack with special ability chance
-					int zombieAttackDmg = currentZombie->getDamage();
+					// Zombie counter-attack with special ability chance, as the hit left it (a Tank may have enraged)
+					CombatRules::resolveCounterAttack(round, CombatRules::getZombieStats(*currentZombie), rng.combat());
+					int zombieAttackDmg = round.damageTaken;
 					
 					// Check if zombie uses special ability
-					if (currentZombie->canUseSpecialAbility() && rand() % 100 < currentZombie->getSpecialAbilityChance()) {
+					if (round.special) {
 						std::string abilityMsg = currentZombie->useSpecialAbility(currentPlayer);
-						std::cout << "  [SPECIAL] " << abilityMsg << "\n";
+						out() << "  [SPECIAL] " << abilityMsg << "\n";
 						
 						// Apply special damage (usually higher)
-						int specialDmg = (int)(zombieAttackDmg * 1.5f);
-						std::cout << "  Zombie special attack for " << specialDmg << " damage!\n";
+						int specialDmg = zombieAttackDmg;
+						out() << "  Zombie special attack for " << specialDmg << " damage!\n";
 						currentPlayer->takeDamage(specialDmg);
 						result.playerDamageTaken += specialDmg;
 
-						combatActionHistory.push("Took " + std::to_string(specialDmg) + " dmg from " + currentZombie->getType());
+						combatLog.record(CombatEvent::Action::TOOK_DAMAGE, currentZombie->getType(), currentPlayer->getName(), specialDmg);
 					} else {
-						std::cout << "  Zombie attacks for " << zombieAttackDmg << " damage!\n";
+						out() << "  Zombie attacks for " << zombieAttackDmg << " damage!\n";
 						currentPlayer->takeDamage(zombieAttackDmg);
 						result.playerDamageTaken += zombieAttackDmg;
-						combatActionHistory.push("Took " + std::to_string(zombieAttackDmg) + " dmg from " + currentZombie->getType());
+						combatLog.record(CombatEvent::Action::TOOK_DAMAGE, currentZombie->getType(), currentPlayer->getName(), zombieAttackDmg);
 					}
 				}
 			}
 			else {
-				std::cout << "\n  [MISS] Attack missed!\n";
-				AudioEngine::getInstance()->playCombatMissSound();
+				out() << "\n  [MISS] Attack missed!\n";
+				session.getAudio().playCombatMissSound();
 				
 				// Zombie still attacks on miss
-				int zombieAttackDmg = currentZombie->getDamage();
-				std::cout << "  Zombie punishes your miss for " << zombieAttackDmg << " damage!\n";
+				int zombieAttackDmg = round.damageTaken;
+				out() << "  Zombie punishes your miss for " << zombieAttackDmg << " damage!\n";
 				currentPlayer->takeDamage(zombieAttackDmg);
 				result.playerDamageTaken += zombieAttackDmg;
 			}
@@ -1015,16 +873,18 @@ CombatResult GameplayEngine::conductCombat() {
 		}
 
 		case 2: { // Dodge
-			if (rand() % 100 < 40) {
-				std::cout << "\n  [DODGE] Avoided!\n";
-				combatActionHistory.push("Dodged " + currentZombie->getType() + "'s attack");
+			CombatRules::RoundResult round = CombatRules::resolveAction(CombatRules::Action::DODGE,
+				CombatRules::getPlayerStats(*currentPlayer), CombatRules::getZombieStats(*currentZombie), rng.combat());
+			if (round.dodged) {
+				out() << "\n  [DODGE] Avoided!\n";
+				combatLog.record(CombatEvent::Action::DODGED, currentZombie->getType(), currentPlayer->getName());
 			}
 			else {
-				int dmg = currentZombie->getDamage() / 2;
-				std::cout << "\n  [PARTIAL] Take " << dmg << " damage!\n";
+				int dmg = round.damageTaken;
+				out() << "\n  [PARTIAL] Take " << dmg << " damage!\n";
 				currentPlayer->takeDamage(dmg);
 				result.playerDamageTaken += dmg;
-				combatActionHistory.push("Took " + std::to_string(dmg) + " dmg (partial dodge)");
+				combatLog.record(CombatEvent::Action::PARTIAL_DODGE, currentZombie->getType(), currentPlayer->getName(), dmg);
 			}
 			break;
 		}
@@ -1037,21 +897,20 @@ CombatResult GameplayEngine::conductCombat() {
 		case 4: { // Flee or Special Attack (boss fight)
 			if (isBossFight) {
 				// Boss fight: Special attack instead of flee
-				std::cout << "\n  [SPECIAL ATTACK] You use all your might!\n";
+				out() << "\n  [SPECIAL ATTACK] You use all your might!\n";
 				
-				// Get AI storyteller bonus
-				AIStoryteller* ai = AIStoryteller::getInstance();
-				int specialDamage = currentPlayer->getDamage() * 2;
+				CombatRules::RoundResult round = CombatRules::resolveAction(CombatRules::Action::SPECIAL_ATTACK,
+					CombatRules::getPlayerStats(*currentPlayer), CombatRules::getZombieStats(*currentZombie), rng.combat());
+				int specialDamage = round.damageDealt;
 				
-				// AI Storyteller grants random crit during boss fight
-				if (ai && rand() % 100 < 40) { // 40% chance for crit
-					specialDamage = (int)(specialDamage * 2.5f); // 2.5x damage on crit
-					std::cout << "  [AI BOOST] Critical strike! " << specialDamage << " damage!\n";
-					combatActionHistory.push("CRITICAL STRIKE: " + std::to_string(specialDamage) + " dmg!");
+				// AI Storyteller grants random crit during boss fight (40% chance, 2.5x damage)
+				if (round.critical) {
+					out() << "  [AI BOOST] Critical strike! " << specialDamage << " damage!\n";
+					combatLog.record(CombatEvent::Action::CRITICAL_STRIKE, currentPlayer->getName(), currentZombie->getType(), specialDamage);
 				}
 				else {
-					std::cout << "You deal " << specialDamage << " damage!\n";
-					combatActionHistory.push("Special attack: " + std::to_string(specialDamage) + " dmg");
+					out() << "You deal " << specialDamage << " damage!\n";
+					combatLog.record(CombatEvent::Action::SPECIAL_ATTACK, currentPlayer->getName(), currentZombie->getType(), specialDamage);
 				}
 				
 				currentZombie->takeDamage(specialDamage);
@@ -1059,26 +918,28 @@ CombatResult GameplayEngine::conductCombat() {
 			}
 			else {
 				// Regular fight: Try to flee
-				if (rand() % 100 < 50) {
-					std::cout << "\n  [ESCAPED]\n";
-					combatActionHistory.push("Fled from combat");
+				CombatRules::RoundResult round = CombatRules::resolveAction(CombatRules::Action::FLEE,
+					CombatRules::getPlayerStats(*currentPlayer), CombatRules::getZombieStats(*currentZombie), rng.combat());
+				if (round.escaped) {
+					out() << "\n  [ESCAPED]\n";
+					combatLog.record(CombatEvent::Action::FLED, currentPlayer->getName(), currentZombie->getType());
 					result.playerWon = false;
 					while (!currentWave.isEmpty()) delete currentWave.dequeue();
 					if (currentZombie) delete currentZombie;
-					std::cout << "\n  Press ENTER...";
-					std::cin.get();
+					out() << "\n  Press ENTER...";
+					waitForEnter();
 					inCombat = false;
 					return result;
 				}
 				else {
-					std::cout << "\n  [FAILED] Couldn't escape!\n";
-					combatActionHistory.push("Failed to flee");
+					out() << "\n  [FAILED] Couldn't escape!\n";
+					combatLog.record(CombatEvent::Action::FLEE_FAILED, currentPlayer->getName(), currentZombie->getType());
 					// Zombie punishes failed escape
-					int zombieAttackDmg = currentZombie->getDamage();
-					std::cout << "  Zombie attacks while you flee for " << zombieAttackDmg << " damage!\n";
+					int zombieAttackDmg = round.damageTaken;
+					out() << "  Zombie attacks while you flee for " << zombieAttackDmg << " damage!\n";
 					currentPlayer->takeDamage(zombieAttackDmg);
 					result.playerDamageTaken += zombieAttackDmg;
-					combatActionHistory.push("Took " + std::to_string(zombieAttackDmg) + " dmg (flee failed)");
+					combatLog.record(CombatEvent::Action::FLEE_DAMAGE, currentZombie->getType(), currentPlayer->getName(), zombieAttackDmg);
 				}
 			}
 			break;
@@ -1086,47 +947,101 @@ CombatResult GameplayEngine::conductCombat() {
 		}
 
 		// AI STORYTELLER: Boss fight assistance (heal when very low)
-		if (isBossFight && currentPlayer->getHealth() <= currentPlayer->getMaxHealth() / 4) {
-			AIStoryteller* ai = AIStoryteller::getInstance();
-			if (ai && rand() % 100 < 60) { // 60% chance to heal when critical
-				int healAmount = currentPlayer->getMaxHealth() / 2;
+		if (isBossFight) {
+			int healAmount = CombatRules::rollBossHeal(currentPlayer->getHealth(), currentPlayer->getMaxHealth(), rng.combat()); // 60% chance when critical
+			if (healAmount > 0) {
 				int newHP = currentPlayer->getHealth() + healAmount;
 				if (newHP > currentPlayer->getMaxHealth()) {
 					newHP = currentPlayer->getMaxHealth();
 				}
 				currentPlayer->setHealth(newHP);
-				std::cout << "\n  [AI INTERVENTION] The storyteller restores " << healAmount << " HP!\n";
-				combatActionHistory.push("AI HEALED: +" + std::to_string(healAmount) + " HP");
+				out() << "\n  [AI INTERVENTION] The storyteller restores " << healAmount << " HP!\n";
+				combatLog.record(CombatEvent::Action::AI_HEAL, "AI", currentPlayer->getName(), healAmount);
 			}
 		}
 
 		if (currentPlayer->getHealth() <= 0) {
-			std::cout << "\n  [GAME OVER]\n";
+			out() << "\n  [GAME OVER]\n";
 			result.playerWon = false;
 			inCombat = false;
-			std::cout << "\n  Press ENTER...";
-			std::cin.get();
+			out() << "\n  Press ENTER...";
+			waitForEnter();
 			return result;
 		}
 
-		std::cout << "\n  Press ENTER...";
-		std::cin.get();
+		out() << "\n  Press ENTER...";
+		waitForEnter();
 	}
 
 	result.playerWon = true;
 	inCombat = false;
 
-	system(CLEAR_SCREEN);
-	std::cout << "\n  [VICTORY]\n\n";
-	std::cout << "  Kills: " << result.zombiesKilled << "\n";
-	std::cout << "  Damage Dealt: " << result.playerDamageDealt << "\n";
-	std::cout << "  Damage Taken: " << result.playerDamageTaken << "\n";
-	std::cout << "  Press ENTER...";
-	std::cin.get();
+	clearScreen();
+	out() << "\n  [VICTORY]\n\n";
+	out() << "  Kills: " << result.zombiesKilled << "\n";
+	out() << "  Damage Dealt: " << result.playerDamageDealt << "\n";
+	out() << "  Damage Taken: " << result.playerDamageTaken << "\n";
+	out() << "  Press ENTER...";
+	waitForEnter();
 
 	return result;
 }
 
+void GameplayEngine::displayCombatStatus(Zombie* currentZombie, bool isBossFight) {
+	// Display zombie with health bar
+	if (currentZombie) {
+		int zombieHP = currentZombie->getHealth();
+		int zombieMaxHP = currentZombie->getMaxHealth();
+		float zombieHPPercent = (float)zombieHP / zombieMaxHP;
+		int barWidth = 20;
+		int filled = (int)(zombieHPPercent * barWidth);
+		
+		// Boss fight special display
+		if (isBossFight) {
+			out() << "  ===============================================================\n";
+			out() << "  BOSS: " << currentZombie->getType() << " - THE PROTECTOR\n";
+			out() << "  ===============================================================\n";
+		}
+		else {
+			out() << "  Enemy: " << currentZombie->getType() << "\n";
+		}
+		
+		out() << "  [";
+		for (int i = 0; i < barWidth; i++) {
+			if (i < filled) out() << "=";
+			else out() << " ";
+		}
+		out() << "] " << (int)(zombieHPPercent * 100) << "%\n";
+		out() << "  HP: " << zombieHP << "/" << zombieMaxHP << "\n";
+		out() << "  Remaining: " << currentWave.size() << "\n\n";
+	}
+
+	// Display player stats
+	out() << "  YOU: " << currentPlayer->getHealth() << "/" << currentPlayer->getMaxHealth() << " HP\n";
+	out() << "  Weapon: " << currentPlayer->getEquippedWeapon() << "\n";
+
+	// Display combat history (latest actions first, formatted only here)
+	if (!combatLog.isEmpty()) {
+		out() << "\n  RECENT ACTIONS:\n";
+
+		int actionCount = combatLog.size() < MAX_COMBAT_HISTORY ? combatLog.size() : MAX_COMBAT_HISTORY;
+		for (int i = 0; i < actionCount; i++) {
+			out() << "  [" << (i + 1) << "] " << CombatLog::format(combatLog.peek(i)) << "\n";
+		}
+	}
+	out() << "\n";
+
+	// Boss fight special menu
+	if (isBossFight) {
+		out() << "  [1] Attack  [2] Dodge  [3] Item  [4] Special Attack (uses items)\n";
+	}
+	else {
+		out() << "  [1] Attack  [2] Dodge  [3] Item  [4] Flee\n";
+	}
+	
+	out() << "  Choice: ";
+}
+
 void GameplayEngine::handleCombatRound() {
 	// Handled in conductCombat
 }
@@ -1148,10 +1063,6 @@ int GameplayEngine::playerDodge() {
 	return 0; // Placeholder
 }
 
-bool GameplayEngine::playerUseItem(const std::string& itemName) {
-	return false; // Placeholder
-}
-
 Zombie* GameplayEngine::getNextZombie() {
 	if (!currentWave.isEmpty()) {
 		return currentWave.dequeue();
@@ -1182,13 +1093,13 @@ std::string GameplayEngine::directionToString(Direction direction) {
 }
 
 void GameplayEngine::displayPlayerStatus() {
-	system(CLEAR_SCREEN);
-	std::cout << "\n" << std::string(60, '=') << "\n";
-	std::cout << "  PLAYER STATUS\n";
-	std::cout << std::string(60, '=') << "\n\n";
+	clearScreen();
+	out() << "\n" << std::string(60, '=') << "\n";
+	out() << "  PLAYER STATUS\n";
+	out() << std::string(60, '=') << "\n\n";
 	
-	std::cout << "  Name: " << currentPlayer->getName() << "\n";
-	std::cout << "  Level: " << currentPlayer->getLevel() << "\n\n";
+	out() << "  Name: " << currentPlayer->getName() << "\n";
+	out() << "  Level: " << currentPlayer->getLevel() << "\n\n";
 	
 	// Health bar
 	int hp = currentPlayer->getHealth();
@@ -1197,13 +1108,13 @@ void GameplayEngine::displayPlayerStatus() {
 	int barWidth = 30;
 	int filled = (int)(hpPercent * barWidth);
 	
-	std::cout << "  Health: " << hp << "/" << maxHP << "\n";
-	std::cout << "  [";
+	out() << "  Health: " << hp << "/" << maxHP << "\n";
+	out() << "  [";
 	for (int i = 0; i < barWidth; i++) {
-		if (i < filled) std::cout << "=";
-		else std::cout << " ";
+		if (i < filled) out() << "=";
+		else out() << " ";
 	}
-	std::cout << "]\n\n";
+	out() << "]\n\n";
 	
 	// Hunger bar
 	int hunger = currentPlayer->getHunger();
@@ -1211,13 +1122,13 @@ void GameplayEngine::displayPlayerStatus() {
 	float hungerPercent = (float)hunger / maxHunger;
 	int hungerFilled = (int)(hungerPercent * barWidth);
 	
-	std::cout << "  Hunger: " << hunger << "/" << maxHunger << "\n";
-	std::cout << "  [";
+	out() << "  Hunger: " << hunger << "/" << maxHunger << "\n";
+	out() << "  [";
 	for (int i = 0; i < barWidth; i++) {
-		if (i < hungerFilled) std::cout << "=";
-		else std::cout << " ";
+		if (i < hungerFilled) out() << "=";
+		else out() << " ";
 	}
-	std::cout << "]\n\n";
+	out() << "]\n\n";
 	
 	// XP bar
 	int xp = currentPlayer->getExperience();
@@ -1225,52 +1136,52 @@ void GameplayEngine::displayPlayerStatus() {
 	float xpPercent = (float)xp / xpToNext;
 	int xpFilled = (int)(xpPercent * barWidth);
 	
-	std::cout << "  XP: " << xp << "/" << xpToNext << "\n";
-	std::cout << "  [";
+	out() << "  XP: " << xp << "/" << xpToNext << "\n";
+	out() << "  [";
 	for (int i = 0; i < barWidth; i++) {
-		if (i < xpFilled) std::cout << "=";
-		else std::cout << " ";
+		if (i < xpFilled) out() << "=";
+		else out() << " ";
 	}
-	std::cout << "]\n";
-	std::cout << "  Skill Points: " << currentPlayer->getSkillPoints() << "\n\n";
+	out() << "]\n";
+	out() << "  Skill Points: " << currentPlayer->getSkillPoints() << "\n\n";
 	
 	// Combat stats
-	std::cout << "  Equipped: " << currentPlayer->getEquippedWeapon() << "\n";
-	std::cout << "  Damage: " << currentPlayer->getDamage() << "\n";
-	std::cout << "  Inventory: " << currentPlayer->getInventorySize() << "/"
+	out() << "  Equipped: " << currentPlayer->getEquippedWeapon() << "\n";
+	out() << "  Damage: " << currentPlayer->getDamage() << "\n";
+	out() << "  Inventory: " << currentPlayer->getInventorySize() << "/"
 		<< currentPlayer->getMaxInventorySpace() << "\n\n";
 	
-	std::cout << std::string(60, '=') << "\n";
-	std::cout << "  Press ENTER...";
-	std::cin.get();
+	out() << std::string(60, '=') << "\n";
+	out() << "  Press ENTER...";
+	waitForEnter();
 }
 
 void GameplayEngine::displayInventory() {
-	system(CLEAR_SCREEN);
-	std::cout << "\n  INVENTORY\n\n";
+	clearScreen();
+	out() << "\n  INVENTORY\n\n";
 
 	SinglyLinkedList<Item>& inv = currentPlayer->getInventory();
 	if (inv.isEmpty()) {
-		std::cout << "  Empty.\n";
-		std::cout << "\n  Press ENTER...";
-		std::cin.get();
+		out() << "  Empty.\n";
+		out() << "\n  Press ENTER...";
+		waitForEnter();
 		return;
 	}
 
 	// Display items
 	int count = 1;
 	for (auto it = inv.begin(); it != inv.end(); ++it) {
-		std::cout << "  [" << count++ << "] " << (*it).getName()
+		out() << "  [" << count++ << "] " << (*it).getName()
 			<< " (x" << (*it).getQuantity() << ")";
 		
 		// Show item type and stats
 		if ((*it).getCategory() == Item::Category::WEAPON) {
-			std::cout << " - Weapon (+";
-			std::cout << (*it).getDamageBoost() << " DMG)";
+			out() << " - Weapon (+";
+			out() << (*it).getDamageBoost() << " DMG)";
 			
 			// Show ammo for ranged weapons
 			if ((*it).getMaxAmmo() > 0) {
-				std::cout << " [" << (*it).getAmmo() << "/" << (*it).getMaxAmmo() << " ammo]";
+				out() << " [" << (*it).getAmmo() << "/" << (*it).getMaxAmmo() << " ammo]";
 			}
 			
 			// Show durability
@@ -1278,30 +1189,30 @@ void GameplayEngine::displayInventory() {
 			int maxDurability = (*it).getMaxDurability();
 			if (maxDurability > 0) {
 				float durPercent = (*it).getDurabilityPercent();
-				std::cout << " Durability: " << durability << "/" << maxDurability;
+				out() << " Durability: " << durability << "/" << maxDurability;
 				if (durPercent <= 0.25f) {
-					std::cout << " [BREAKING!]";
+					out() << " [BREAKING!]";
 				}
 			}
 		}
 		else if ((*it).getCategory() == Item::Category::MEDICAL) {
-			std::cout << " - Heals " << (*it).getHealthRestore() << " HP";
+			out() << " - Heals " << (*it).getHealthRestore() << " HP";
 		}
 		else if ((*it).getCategory() == Item::Category::FOOD) {
-			std::cout << " - Food (+30 Hunger)";
+			out() << " - Food (+30 Hunger)";
 		}
-		std::cout << "\n";
+		out() << "\n";
 	}
 
-	std::cout << "\n  [U] Use Item  [E] Equip Weapon  [D] Drop Item  [0] Back\n";
-	std::cout << "  Choice: ";
+	out() << "\n  [U] Use Item  [E] Equip Weapon  [D] Drop Item  [0] Back\n";
+	out() << "  Choice: ";
 	
 	char choice;
 	std::cin >> choice;
 	std::cin.ignore();
 
 	if (choice == 'u' || choice == 'U') {
-		std::cout << "\n  Enter item number to use: ";
+		out() << "\n  Enter item number to use: ";
 		int itemNum;
 		std::cin >> itemNum;
 		std::cin.ignore();
@@ -1313,56 +1224,15 @@ void GameplayEngine::displayInventory() {
 				if (idx == itemNum) {
 					const Item& item = *it;
 					
-					// Use item if consumable
-					if (item.isConsumable() && item.isUsable()) {
-						bool itemUsed = false;
-						
-						// Healing items
-						if (item.getHealthRestore() > 0) {
-							int newHP = currentPlayer->getHealth() + item.getHealthRestore();
-							if (newHP > currentPlayer->getMaxHealth()) {
-								newHP = currentPlayer->getMaxHealth();
-							}
-							currentPlayer->setHealth(newHP);
-							std::cout << "\n  [USED] " << item.getName() << "! Restored "
-								<< item.getHealthRestore() << " HP.\n";
-							itemUsed = true;
-
-							// Track in combat history if in combat
-							if (inCombat) {
-								combatActionHistory.push("Used " + item.getName() + " (+" + std::to_string(item.getHealthRestore()) + " HP)");
-							}
-						}
-
-						// Food items (restore hunger)
-						if (item.getCategory() == Item::Category::FOOD) {
-							int hungerRestore = 30; // Default food restores 30 hunger
-							int newHunger = currentPlayer->getHunger() + hungerRestore;
-							if (newHunger > currentPlayer->getMaxHunger()) {
-								newHunger = currentPlayer->getMaxHunger();
-							}
-							currentPlayer->setHunger(newHunger);
-							std::cout << "\n  [USED] " << item.getName() << "! Restored "
-								<< hungerRestore << " Hunger.\n";
-							itemUsed = true;
-
-							// Track in combat history if in combat
-							if (inCombat) {
-								combatActionHistory.push("Used " + item.getName() + " (+" + std::to_string(hungerRestore) + " Hunger)");
-							}
-						}
-						
-						if (itemUsed) {
-							// Remove item (decrease quantity)
-							currentPlayer->removeItem(item);
-							std::cout << "  Press ENTER...";
-							std::cin.get();
-						}
+					// Use item if consumable (it is used up, so nothing may touch item after)
+					if (!item.isConsumable() || !item.isUsable()) {
+						out() << "\n  [ERROR] Cannot use this item.\n";
+						out() << "  Press ENTER...";
+						waitForEnter();
 					}
-					else {
-						std::cout << "\n  [ERROR] Cannot use this item.\n";
-						std::cout << "  Press ENTER...";
-						std::cin.get();
+					else if (useItem(item)) {
+						out() << "  Press ENTER...";
+						waitForEnter();
 					}
 					break;
 				}
@@ -1371,7 +1241,7 @@ void GameplayEngine::displayInventory() {
 		}
 	}
 	else if (choice == 'e' || choice == 'E') {
-		std::cout << "\n  Enter weapon number to equip (0 to unequip): ";
+		out() << "\n  Enter weapon number to equip (0 to unequip): ";
 		int weaponNum;
 		std::cin >> weaponNum;
 		std::cin.ignore();
@@ -1380,10 +1250,10 @@ void GameplayEngine::displayInventory() {
 			// Unequip weapon
 			currentPlayer->setEquippedWeapon("Fists");
 			currentPlayer->setDamage(8); // Reset to base damage
-			std::cout << "\n  [UNEQUIPPED] Weapon removed.\n";
-			std::cout << "  Damage: 8 (base)\n";
-			std::cout << "  Press ENTER...";
-			std::cin.get();
+			out() << "\n  [UNEQUIPPED] Weapon removed.\n";
+			out() << "  Damage: 8 (base)\n";
+			out() << "  Press ENTER...";
+			waitForEnter();
 		}
 		else if (weaponNum > 0 && weaponNum <= currentPlayer->getInventorySize()) {
 			int idx = 1;
@@ -1396,15 +1266,15 @@ void GameplayEngine::displayInventory() {
 						int newDamage = baseDamage + item.getDamageBoost();
 						currentPlayer->setDamage(newDamage);
 						currentPlayer->setEquippedWeapon(item.getName());
-						std::cout << "\n  [EQUIPPED] " << item.getName() << "!\n";
-						std::cout << "  Damage: " << currentPlayer->getDamage() << " (+" << item.getDamageBoost() << " from weapon)\n";
-						std::cout << "  Press ENTER...";
-						std::cin.get();
+						out() << "\n  [EQUIPPED] " << item.getName() << "!\n";
+						out() << "  Damage: " << currentPlayer->getDamage() << " (+" << item.getDamageBoost() << " from weapon)\n";
+						out() << "  Press ENTER...";
+						waitForEnter();
 					}
 					else {
-						std::cout << "\n  [ERROR] Not a weapon.\n";
-						std::cout << "  Press ENTER...";
-						std::cin.get();
+						out() << "\n  [ERROR] Not a weapon.\n";
+						out() << "  Press ENTER...";
+						waitForEnter();
 					}
 					break;
 				}
@@ -1413,7 +1283,7 @@ void GameplayEngine::displayInventory() {
 		}
 	}
 	else if (choice == 'd' || choice == 'D') {
-		std::cout << "\n  Enter item number to drop: ";
+		out() << "\n  Enter item number to drop: ";
 		int dropNum;
 		std::cin >> dropNum;
 		std::cin.ignore();
@@ -1423,11 +1293,11 @@ void GameplayEngine::displayInventory() {
 			for (auto it = inv.begin(); it != inv.end(); ++it) {
 				if (idx == dropNum) {
 					const Item& item = *it;
-					std::cout << "\n  [DROPPED] " << item.getName() << "\n";
-					currentPlayer->removeItem(item);
-					std::cout << "  Freed " << item.getInventorySpace() << " slots.\n";
-					std::cout << "  Press ENTER...";
-					std::cin.get();
+					out() << "\n  [DROPPED] " << item.getName() << "\n";
+					out() << "  Freed " << item.getInventorySpace() << " slots.\n";
+					currentPlayer->removeItem(item); // item refers into the inventory, so remove it last
+					out() << "  Press ENTER...";
+					waitForEnter();
 					break;
 				}
 				idx++;
@@ -1438,62 +1308,62 @@ void GameplayEngine::displayInventory() {
 
 
 void GameplayEngine::displayCollectedClues() {
-	system(CLEAR_SCREEN);
-	std::cout << "\n  CLUE JOURNAL\n\n";
+	clearScreen();
+	out() << "\n  CLUE JOURNAL\n\n";
 	if (journal) {
 		journal->displayProgress();
 		if (journal->getTotalCollected() > 0) {
-			std::cout << "\n  COLLECTED CLUES:\n\n";
+			out() << "\n  COLLECTED CLUES:\n\n";
 			
 			// Display clue list with numbers
 			int count = 1;
-			std::vector<Clue> cluesList;
-			
-			// Copy clues to vector for safe iteration
-			DoublyLinkedList<Clue>& clues = journal->getClues();
-			for (auto it = clues.begin(); it != clues.end(); ++it) {
-				cluesList.push_back(*it);
+			std::vector<const Clue*> cluesList;
+
+			// Index the journal's clues in place (no copies)
+			const DoublyLinkedList<Clue>& clues = journal->getClues();
+			cluesList.reserve(clues.size());
+			for (const Clue& clue : clues) {
+				cluesList.push_back(&clue);
 			}
-			
-			// Display from vector
-			for (const auto& clue : cluesList) {
-				std::cout << "  [" << count++ << "] " << clue.getClueName() 
-					<< " (" << clue.getLocationFound() << ")\n";
+
+			for (const Clue* clue : cluesList) {
+				out() << "  [" << count++ << "] " << clue->getClueName()
+					<< " (" << clue->getLocationFound() << ")\n";
 			}
 			
-			std::cout << "\n  [R] Read Clue  [0] Back\n";
-			std::cout << "  Choice: ";
+			out() << "\n  [R] Read Clue  [0] Back\n";
+			out() << "  Choice: ";
 			
 			char choice;
 			std::cin >> choice;
 			std::cin.ignore();
 			
 			if (choice == 'r' || choice == 'R') {
-				std::cout << "\n  Enter clue number to read: ";
+				out() << "\n  Enter clue number to read: ";
 				int clueNum;
 				std::cin >> clueNum;
 				std::cin.ignore();
 				
 				if (clueNum > 0 && clueNum <= static_cast<int>(cluesList.size())) {
-					const Clue& selectedClue = cluesList[clueNum - 1];
-					system(CLEAR_SCREEN);
-					std::cout << "\n" << std::string(80, '=') << "\n";
-					std::cout << "  " << selectedClue.getClueName() << "\n";
-					std::cout << std::string(80, '=') << "\n\n";
-					std::cout << "  Location: " << selectedClue.getLocationFound() << "\n\n";
-					std::cout << "  " << selectedClue.getContent() << "\n\n";
-					std::cout << std::string(80, '=') << "\n";
-					std::cout << "\n  Press ENTER...";
-					std::cin.get();
+					const Clue& selectedClue = *cluesList[clueNum - 1];
+					clearScreen();
+					out() << "\n" << std::string(80, '=') << "\n";
+					out() << "  " << selectedClue.getClueName() << "\n";
+					out() << std::string(80, '=') << "\n\n";
+					out() << "  Location: " << selectedClue.getLocationFound() << "\n\n";
+					out() << "  " << selectedClue.getContent() << "\n\n";
+					out() << std::string(80, '=') << "\n";
+					out() << "\n  Press ENTER...";
+					waitForEnter();
 				}
 			}
 		}
 		else {
-			std::cout << "\n  No clues collected yet.\n";
+			out() << "\n  No clues collected yet.\n";
 		}
 	}
-	std::cout << "\n  Press ENTER...";
-	std::cin.get();
+	out() << "\n  Press ENTER...";
+	waitForEnter();
 }
 
 // ============================================================================
@@ -1505,37 +1375,37 @@ bool GameplayEngine::canTravelToNewLocation() const {
 }
 
 void GameplayEngine::displayTravelOptions() {
-	system(CLEAR_SCREEN);
-	std::cout << "\n  TRAVEL OPTIONS\n\n";
-	std::cout << "  Current: " << currentLocation->getName() << "\n\n";
-	std::cout << "  Available:\n\n";
+	clearScreen();
+	out() << "\n  TRAVEL OPTIONS\n\n";
+	out() << "  Current: " << currentLocation->getName() << "\n\n";
+	out() << "  Available:\n\n";
 
-	SinglyLinkedList<std::string>& connections = currentLocation->getConnections();
+	SinglyLinkedList<Symbol>& connections = currentLocation->getConnections();
 
 	if (connections.isEmpty()) {
-		std::cout << "  No locations available.\n";
-		std::cout << "\n  Press ENTER...";
-		std::cin.get();
+		out() << "  No locations available.\n";
+		out() << "\n  Press ENTER...";
+		waitForEnter();
 		return;
 	}
 
 	int i = 1;
-	GameEngine* engine = GameEngine::getInstance();
+	GameEngine* engine = &session.getGameEngine();
 	for (auto it = connections.begin(); it != connections.end(); ++it) {
 		// Get the location object to display its name
-		Location* loc = engine->getLocationByID(*it);
+		Location* loc = engine->getLocationByID(it->str());
 		if (loc) {
-			std::cout << "  [" << i++ << "] " << loc->getName() << "\n";
+			out() << "  [" << i++ << "] " << loc->getName() << "\n";
 		}
 		else {
-			std::cout << "  [" << i++ << "] " << *it << "\n";
+			out() << "  [" << i++ << "] " << *it << "\n";
 		}
 	}
-	std::cout << "  [0] Cancel\n";
+	out() << "  [0] Cancel\n";
 }
 
 bool GameplayEngine::travelToLocation(const std::string& locationID) {
-	GameEngine* engine = GameEngine::getInstance();
+	GameEngine* engine = &session.getGameEngine();
 	Location* newLocation = engine->getLocationByID(locationID);
 
 	if (!newLocation) {
@@ -1546,54 +1416,58 @@ bool GameplayEngine::travelToLocation(const std::string& locationID) {
 	setCurrentLocation(newLocation);
 	engine->setCurrentLocation(newLocation);  // Keep GameEngine in sync
 
-	system(CLEAR_SCREEN);
-	std::cout << "\n  Traveling to " << newLocation->getName() << "...\n\n";
-	std::this_thread::sleep_for(std::chrono::milliseconds(2000));
+	clearScreen();
+	out() << "\n  Traveling to " << newLocation->getName() << "...\n\n";
+	sleepFor(2000);
 
 	// Display chapter intro if first visit
 	if (!newLocation->isVisited()) {
-		newLocation->displayChapterIntro();
+		if (autopilot == nullptr) {
+			newLocation->displayChapterIntro(&session.getAudio());
+		}
 		newLocation->markVisited();
-		std::cout << "\n\n  Press ENTER to continue...";
-		std::cin.get();
+		out() << "\n\n  Press ENTER to continue...";
+		waitForEnter();
 	}
 
 	// SANCTUARY SPECIAL HANDLING: Trigger instant boss fight
-	if (locationID == "loc_sanctuary" && !newLocation->isCleared()) {
-		system(CLEAR_SCREEN);
-		std::cout << "\n" << std::string(80, '=') << "\n";
-		std::cout << "  FINAL ENCOUNTER\n";
-		std::cout << std::string(80, '=') << "\n\n";
-		std::cout << "  As you approach The Sanctuary's entrance, a massive figure\n";
-		std::cout << "  blocks your path. The Tank - the final guardian of the cure.\n\n";
-		std::cout << "  This is it. The end of your journey.\n\n";
-		std::cout << "  Press ENTER to begin the final battle...";
-		std::cin.get();
+	if (ExplorationRules::isBossLocation(locationID) && !newLocation->isCleared()) {
+		clearScreen();
+		out() << "\n" << std::string(80, '=') << "\n";
+		out() << "  FINAL ENCOUNTER\n";
+		out() << std::string(80, '=') << "\n\n";
+		out() << "  As you approach The Sanctuary's entrance, a massive figure\n";
+		out() << "  blocks your path. The Tank - the final guardian of the cure.\n\n";
+		out() << "  This is it. The end of your journey.\n\n";
+		out() << "  Press ENTER to begin the final battle...";
+		waitForEnter();
 
 		// Add the Tank boss to the location
 		Tank* tankBoss = new Tank("boss_tank", "The Protector");
 		newLocation->addZombie(tankBoss);
 
 		// Play sanctuary music and then combat music
-		AudioEngine* audio = AudioEngine::getInstance();
-		audio->playLocationMusic("loc_sanctuary");
-		std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+		session.getAudio().playLocationMusic(Symbol("loc_sanctuary"));
+		sleepFor(1000);
 
 		// Start combat
 		startCombat();
 
-		// Check if player won or lost
-		if (currentPlayer->getHealth() > 0) {
+		// Check if player won or lost (a scripted player reads the ending off the journal itself)
+		if (autopilot != nullptr) {
+			// No ending screen
+		}
+		else if (currentPlayer->getHealth() > 0) {
 			// VICTORY: Determine ending type
 			ClueJournal* journal = engine->getJournal();
 			EndingSystem::EndingType endingType = EndingSystem::determineEnding(false, true, currentPlayer, journal);
 			
 			// Display the ending
-			EndingSystem::displayEnding(endingType, currentPlayer, journal);
+			EndingSystem::displayEnding(&session.getAudio(), endingType, currentPlayer, journal);
 		}
 		else {
 			// DEFEAT: Bad ending
-			EndingSystem::displayEnding(EndingSystem::BAD_ENDING, currentPlayer, engine->getJournal());
+			EndingSystem::displayEnding(&session.getAudio(), EndingSystem::BAD_ENDING, currentPlayer, engine->getJournal());
 		}
 
 		// Mark location as cleared
@@ -7,33 +7,28 @@
 #include "Item.h"
 #include "ClueJournal.h"
 #include "Queue.h"
-#include "Stack.h"
+#include "CombatLog.h"
 #include "Crafting.h"
+#include "CombatRules.h"
+#include "ContentPack.h"
+#include "Direction.h"
+#include "Random.h"
+#include "Symbol.h"
+#include <ostream>
 #include <string>
 #include <vector>
 
-// ============================================================================
-// DIRECTION ENUM
-// ============================================================================
-enum class Direction {
-	UP,
-	DOWN,
-	LEFT,
-	RIGHT,
-	CENTER
-};
+class GameSession;
 
 // ============================================================================
 // LOOT STRUCT - Item at specific location
 // ============================================================================
 struct Loot {
-	std::string lootID;
-	Item item;
-	Direction location;
+	const ContentPack::LootEntry* entry; // Row in the content pack (item, ID and direction)
 	bool isPickedUp;
 
-	Loot(const std::string& id, const Item& it, Direction dir)
-		: lootID(id), item(it), location(dir), isPickedUp(false) {
+	Loot(const ContentPack::LootEntry& aEntry)
+		: entry(&aEntry), isPickedUp(false) {
 	}
 };
 
@@ -41,13 +36,11 @@ struct Loot {
 // CLUE LOCATION STRUCT - Lore item at specific location
 // ============================================================================
 struct ClueLocation {
-	int clueID;
-	std::string clueName;
-	Direction location;
+	const ContentPack::ClueSpawnEntry* entry; // Row in the content pack (clue ID, name and direction)
 	bool collected;
 
-	ClueLocation(int id, const std::string& name, Direction dir)
-		: clueID(id), clueName(name), location(dir), collected(false) {
+	ClueLocation(const ContentPack::ClueSpawnEntry& aEntry)
+		: entry(&aEntry), collected(false) {
 	}
 };
 
@@ -60,20 +53,42 @@ struct CombatResult {
 	int playerDamageTaken;
 	int zombiesKilled;
 	int zombiesRemaining;
+	int rounds; // Player actions taken
 
 	CombatResult()
 		: playerWon(false), playerDamageDealt(0), playerDamageTaken(0),
-		zombiesKilled(0), zombiesRemaining(0) {
+		zombiesKilled(0), zombiesRemaining(0), rounds(0) {
 	}
 };
 
+// ============================================================================
+// AUTOPILOT - Answers the engine's prompts for a scripted player
+// ============================================================================
+// With an autopilot set the engine never reads the console or waits: no "Press ENTER", screen
+// clears or presentation delays. The rules, and the order of random draws, are the same as for a
+// player at the keyboard.
+class Autopilot {
+public:
+	virtual ~Autopilot() {}
+
+	// Pick up loot found while exploring?
+	virtual bool takeLoot(const Item& item) = 0;
+
+	// The action for this combat round (ATTACK, DODGE, FLEE, or SPECIAL_ATTACK in boss fights)
+	virtual CombatRules::Action chooseCombatAction(const Player& player, const Zombie& zombie, bool bossFight) = 0;
+
+	// Combat notifications, for tallying
+	virtual void zombieKilled(const Zombie& /*zombie*/) {}
+	virtual void combatEnded(const CombatResult& /*result*/) {}
+};
+
 // ============================================================================
 // GAMEPLAY ENGINE - Core exploration, combat, and progression
 // ============================================================================
 class GameplayEngine {
 private:
-	// Singleton instance
-	static GameplayEngine* instance;
+	// The session this engine belongs to (game engine, storyteller, audio)
+	GameSession& session;
 
 	// Game state
 	Player* currentPlayer;
@@ -84,10 +99,11 @@ private:
 	Queue<Zombie*> currentWave;
 	int currentWaveNumber;
 	int maxWavesPerLocation;
+	bool bossFight; // The current fight is the sanctuary boss
 
 	// Combat history
-	Stack<std::string> combatActionHistory;
-	static const int MAX_COMBAT_HISTORY = 5;
+	CombatLog combatLog;
+	static const int MAX_COMBAT_HISTORY = 5; // Entries shown in the combat HUD
 
 	// Movement & exploration state
 	int movementSteps;
@@ -96,16 +112,22 @@ private:
 	// Location state
 	std::vector<Loot> currentLocationLoot;
 	std::vector<ClueLocation> currentLocationClues;
-	std::vector<std::string> pickedUpLootIDs; // Track picked up loot globally
+	std::vector<Symbol> pickedUpLootIDs; // Track picked up loot globally
 	bool inCombat;
 	bool hasExploredNewArea;
 
-	// Private constructor
-	GameplayEngine();
+	// Session random streams (combat, loot, events), shared with the AI storyteller
+	RandomStreams rng;
 
-	// Delete copy constructor and assignment operator
-	GameplayEngine(const GameplayEngine&) = delete;
-	GameplayEngine& operator=(const GameplayEngine&) = delete;
+	// Screen output (silentOutput discards everything) and the scripted player, if any
+	std::ostream* output;
+	std::ostream silentOutput;
+	Autopilot* autopilot;
+
+	std::ostream& out() { return *output; }
+	void waitForEnter(); // "Press ENTER", unless on autopilot
+	void clearScreen();
+	void sleepFor(int milliseconds);
 
 	// Private helper methods
 	void spawnZombieWave();
@@ -117,14 +139,21 @@ private:
 	void checkForLocationTransition();
 	void playerAttack(Zombie* zombie, bool isRanged = false);
 	int playerDodge();
-	bool playerUseItem(const std::string& itemName);
 	Zombie* getNextZombie();
+	void displayCombatStatus(Zombie* currentZombie, bool isBossFight); // Enemy, player, recent actions and the action menu
 
 public:
+	// Constructor
+	explicit GameplayEngine(GameSession& session);
+
+	// Delete copy constructor and assignment operator
+	GameplayEngine(const GameplayEngine&) = delete;
+	GameplayEngine& operator=(const GameplayEngine&) = delete;
+
 	// Destructor
 	~GameplayEngine();
 
-	// Singleton pattern
+	// Compatibility shims: the default session's engine, and a fresh one for it
 	static GameplayEngine* getInstance();
 	static void destroyInstance();
 
@@ -133,6 +162,8 @@ public:
 	// ========================================================================
 	void initialize(Player* player, Location* location, ClueJournal* journal);
 	void setCurrentLocation(Location* location);
+	void setOutput(std::ostream* stream); // nullptr discards all screen output
+	void setAutopilot(Autopilot* pilot); // Not owned; nullptr hands the prompts back to the console
 
 	// ========================================================================
 	// EXPLORATION SYSTEM
@@ -146,6 +177,8 @@ public:
 	bool canTravelToNewLocation() const;
 	void displayTravelOptions();
 	bool travelToLocation(const std::string& locationID);
+	void rest();
+	bool useItem(const Item& item); // Apply and use up a consumable; false if it had no effect
 
 	// AI Storyteller integration
 	void spawnAILoot(const std::string& lootType, int quantity, Direction direction);
@@ -155,6 +188,7 @@ public:
 	// COMBAT SYSTEM
 	// ========================================================================
 	void startCombat();
+	void startEncounter(int waveCount, bool isBossFight); // A fight on these terms, wherever the player is
 	CombatResult conductCombat();
 	void handleCombatRound();
 	void processZombieDeath(Zombie* zombie);
@@ -181,18 +215,38 @@ public:
 	// Setters for save/load
 	void setMovementSteps(int steps) { movementSteps = steps; }
 	void setExplorationProgress(int progress) { stepsToNewLocation = progress; }
-	void addPickedUpLootID(const std::string& lootID) { pickedUpLootIDs.push_back(lootID); }
-	void setPickedUpLootIDs(const std::vector<std::string>& ids) { pickedUpLootIDs = ids; }
+	void addPickedUpLootID(Symbol lootID) { pickedUpLootIDs.push_back(lootID); }
+	void setPickedUpLootIDs(const std::vector<std::string>& ids) {
+		pickedUpLootIDs.clear();
+		for (const auto& id : ids) {
+			pickedUpLootIDs.push_back(Symbol(id));
+		}
+	}
 
 	// Getters for save/load
 	size_t getPickedUpLootCount() const { return pickedUpLootIDs.size(); }
-	const std::vector<std::string>& getPickedUpLootIDs() const { return pickedUpLootIDs; }
-	bool isLootPickedUp(const std::string& lootID) const {
+	std::vector<std::string> getPickedUpLootIDs() const {
+		std::vector<std::string> ids;
+		ids.reserve(pickedUpLootIDs.size());
+		for (const auto& id : pickedUpLootIDs) {
+			ids.push_back(id.str());
+		}
+		return ids;
+	}
+	bool isLootPickedUp(Symbol lootID) const {
 		for (const auto& id : pickedUpLootIDs) {
 			if (id == lootID) return true;
 		}
 		return false;
 	}
+
+	// Random seed (set before a session to replay it exactly)
+	void setSeed(std::uint64_t seed) { rng.reseed(seed); }
+	std::uint64_t getSeed() const { return rng.getSeed(); }
+	RandomStreams& getRandomStreams() { return rng; }
+
+	// Combat log access (for analysis/export)
+	const CombatLog& getCombatLog() const { return combatLog; }
 };
 
 #endif /* GAMEPLAYENGINE_H */
\ No newline at end of file
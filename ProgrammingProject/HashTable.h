@@ -1,140 +1,264 @@
 ﻿#ifndef HASHTABLE_H
 #define HASHTABLE_H
-#include <iostream>
-#include <string>
+#include <new>
+#include <utility>
+#include "KeyHash.h"
 
-template <class Key, class Value >
+// Open-addressing hash table with linear probing.
+// Keys and values live in one contiguous slot array, the hash of every occupied
+// slot is cached alongside it, and the table doubles once it passes MAX_LOAD_PERCENT.
+// The slot array is raw storage: only occupied slots hold a constructed key and value.
+// Note: insert may rehash, so pointers returned by search are only valid until the next insert.
+template <class Key, class Value, class Hasher = KeyHash<Key> >
 class HashTable {
 private:
-	struct Node {
+	struct Slot {
 		Key key;
 		Value value;
-		Node* next;
-
-		// Sentinel node
-		static Node NIL;
 
 		// Constructor
-		Node(const Key& k, const Value& v) : key(k), value(v), next(&Node::NIL) {}
-
-		// Default constructor for NIL
-		Node() : key(Key()), value(Value()), next(nullptr) {}
+		template <class K, class V>
+		Slot(K&& k, V&& v) : key(std::forward<K>(k)), value(std::forward<V>(v)) {}
 	};
 
-	Node** table; // Array of pointers (buckets)
-	int tableSize; // Size of the array
+	static const unsigned int OCCUPIED = 0x80000000u; // Set on every stored hash so 0 means empty
+	static const int MAX_LOAD_PERCENT = 75;
+	static const int MIN_TABLE_SIZE = 8;
+
+	Slot* slots; // Contiguous key/value storage, constructed only where hashes[i] != 0
+	unsigned int* hashes; // Cached hash per slot (0 = empty)
+	int tableSize; // Number of slots, always a power of two
 	int numElements; // Number of elements stored
 
-	int hash(const Key& key) const {
-		unsigned long hashValue = 5381;
+	template <class LookupKey>
+	static unsigned int hash(const LookupKey& key) {
+		return Hasher::hash(key) | OCCUPIED;
+	}
+
+	static int roundUpToPowerOfTwo(int size) {
+		int capacity = MIN_TABLE_SIZE;
+		while (capacity < size) {
+			capacity <<= 1;
+		}
+		return capacity;
+	}
+
+	int mask() const {
+		return tableSize - 1;
+	}
 
-		// Convert key to string representation for hashing
-		std::string keyStr = keyToString(key);
+	// Index of the slot holding key, or -1
+	template <class LookupKey>
+	int findSlot(const LookupKey& key, unsigned int keyHash) const {
+		int index = static_cast<int>(keyHash) & mask();
+		while (hashes[index] != 0) {
+			if (hashes[index] == keyHash && slots[index].key == key) {
+				return index;
+			}
+			index = (index + 1) & mask();
+		}
+		return -1;
+	}
 
-		for (char c : keyStr) {
-			hashValue = ((hashValue << 5) + hashValue) + c;
+	// First empty slot on the probe path of keyHash
+	int findEmptySlot(unsigned int keyHash) const {
+		int index = static_cast<int>(keyHash) & mask();
+		while (hashes[index] != 0) {
+			index = (index + 1) & mask();
 		}
+		return index;
+	}
 
-		return hashValue % tableSize;
+	void allocate(int size) {
+		tableSize = size;
+		slots = static_cast<Slot*>(::operator new(sizeof(Slot) * tableSize));
+		hashes = new unsigned int[tableSize];
+		for (int i = 0; i < tableSize; ++i) {
+			hashes[i] = 0;
+		}
 	}
 
-	// Helper function to convert key to string
-	std::string keyToString(const std::string& key) const {
-		return key;
+	// Destroy the occupied slots and free both arrays
+	void release() {
+		for (int i = 0; i < tableSize; ++i) {
+			if (hashes[i] != 0) {
+				slots[i].~Slot();
+			}
+		}
+		::operator delete(slots);
+		delete[] hashes;
 	}
 
-	// Template specialization for other types
-	template<typename T>
-	std::string keyToString(const T& key) const {
-		return std::to_string(key);
+	void rehash(int newSize) {
+		Slot* oldSlots = slots;
+		unsigned int* oldHashes = hashes;
+		int oldSize = tableSize;
+
+		allocate(newSize);
+		for (int i = 0; i < oldSize; ++i) {
+			if (oldHashes[i] != 0) {
+				int index = findEmptySlot(oldHashes[i]);
+				hashes[index] = oldHashes[i];
+				new (&slots[index]) Slot(std::move(oldSlots[i].key), std::move(oldSlots[i].value));
+				oldSlots[i].~Slot();
+			}
+		}
+
+		::operator delete(oldSlots);
+		delete[] oldHashes;
 	}
 
-public:
-	// Constructor
-	HashTable(int size = 50) : tableSize(size), numElements(0) {
-		table = new Node * [size];
+	template <class K, class V>
+	void insertOrAssign(K&& key, V&& value) {
+		unsigned int keyHash = hash(key);
 
-		// Initialise all buckets to NIL
-		for (int i = 0; i < size; ++i) {
-			table[i] = &Node::NIL;
+		// Key exists, update value
+		int index = findSlot(key, keyHash);
+		if (index >= 0) {
+			slots[index].value = std::forward<V>(value);
+			return;
 		}
+
+		reserveForInsert();
+		index = findEmptySlot(keyHash);
+		new (&slots[index]) Slot(std::forward<K>(key), std::forward<V>(value));
+		hashes[index] = keyHash;
+
+		numElements++;
 	}
 
-	// Destructor
-	~HashTable() {
-		for (int i = 0; i < tableSize; ++i) {
-			Node* current = table[i];
+	// Grow before an insert would push the table past its load factor
+	void reserveForInsert() {
+		if ((numElements + 1) * 100 > tableSize * MAX_LOAD_PERCENT) {
+			rehash(tableSize * 2);
+		}
+	}
 
-			while (current != &Node::NIL) {
-				Node* toDelete = current;
-				current = current->next;
-				delete toDelete;
+public:
+	// Key bundled with its hash, so callers can hash once and reuse it for every lookup
+	struct PrehashedKey {
+		Key key;
+		unsigned int keyHash;
+	};
+
+	// Build a prehashed handle from anything the hasher accepts (e.g. string_view for string keys)
+	template <class LookupKey>
+	static PrehashedKey prehash(const LookupKey& key) {
+		return PrehashedKey{ Key(key), hash(key) };
+	}
+
+	// Constructor (size is the expected number of elements)
+	HashTable(int size = 50) : numElements(0) {
+		allocate(roundUpToPowerOfTwo(size * 100 / MAX_LOAD_PERCENT + 1));
+	}
+
+	// Copy constructor
+	HashTable(const HashTable& other) : numElements(other.numElements) {
+		allocate(other.tableSize);
+		for (int i = 0; i < tableSize; ++i) {
+			if (other.hashes[i] != 0) {
+				new (&slots[i]) Slot(other.slots[i].key, other.slots[i].value);
 			}
+			hashes[i] = other.hashes[i];
 		}
-		delete[] table; // Delete the array
+	}
+
+	// Copy assignment
+	HashTable& operator=(const HashTable& other) {
+		if (this != &other) {
+			HashTable copy(other);
+			std::swap(slots, copy.slots);
+			std::swap(hashes, copy.hashes);
+			std::swap(tableSize, copy.tableSize);
+			std::swap(numElements, copy.numElements);
+		}
+		return *this;
+	}
+
+	// Destructor
+	~HashTable() {
+		release();
 	}
 
 	void insert(const Key& key, const Value& value) {
-		int index = hash(key);
-
-		// Check if the key already exists in the bucket
-		Node* current = table[index];
-		while (current != &Node::NIL) {
-			if (current->key == key) {
-				// Key exists, update value
-				current->value = value;
-				return;
-			}
-			current = current->next;
+		insertOrAssign(key, value);
+	}
+
+	void insert(Key&& key, Value&& value) {
+		insertOrAssign(std::move(key), std::move(value));
+	}
+
+	// Construct the value for key from args if key is absent; returns the stored value either way
+	template <class... Args>
+	Value& emplace(const Key& key, Args&&... args) {
+		unsigned int keyHash = hash(key);
+		int index = findSlot(key, keyHash);
+		if (index >= 0) {
+			return slots[index].value;
 		}
 
-		// Key does not exist, insert new node at the head of the bucket
-		Node* newNode = new Node(key, value);
-		newNode->next = table[index];
-		table[index] = newNode;
+		reserveForInsert();
+		index = findEmptySlot(keyHash);
+		new (&slots[index]) Slot(key, Value(std::forward<Args>(args)...));
+		hashes[index] = keyHash;
 
 		numElements++;
+		return slots[index].value;
 	}
 
 	// Find value by key
 	Value* search(const Key& key) const {
-		int index = hash(key);
+		int index = findSlot(key, hash(key));
+		if (index < 0) {
+			return nullptr; // Key not found
+		}
+		return const_cast<Value*>(&(slots[index].value));
+	}
 
-		// Search through the chain in the bucket
-		Node* current = table[index];
-		while (current != &Node::NIL) {
-			if (current->key == key) {
-				return const_cast<Value*>(&(current->value));
-			}
-			current = current->next;
+	// Find value by any type comparable with Key (e.g. string_view or const char*), without building a Key
+	template <class LookupKey>
+	Value* search(const LookupKey& key) const {
+		int index = findSlot(key, hash(key));
+		if (index < 0) {
+			return nullptr; // Key not found
 		}
+		return const_cast<Value*>(&(slots[index].value));
+	}
 
-		return nullptr; // Key not found
+	// Find value by a prehashed key, skipping the hash step
+	Value* search(const PrehashedKey& key) const {
+		int index = findSlot(key.key, key.keyHash);
+		if (index < 0) {
+			return nullptr; // Key not found
+		}
+		return const_cast<Value*>(&(slots[index].value));
 	}
 
 	void remove(const Key& key) {
-		int index = hash(key);
-
-		Node* current = table[index];
-		Node* previous = &Node::NIL;
-
-		// Search for the key
-		while (current != &Node::NIL) {
-			if (current->key == key) {
-				if (previous == &Node::NIL) {
-					table[index] = current->next; // Remove head
-				}
-				else {
-					previous->next = current->next;
-				}
-				delete current;
-				numElements--;
-				return;
+		int index = findSlot(key, hash(key));
+		if (index < 0) {
+			return; // Key not found
+		}
+
+		// Backward-shift deletion: pull later entries of the probe run into the hole
+		// so that lookups never need tombstones
+		int hole = index;
+		int next = (hole + 1) & mask();
+		while (hashes[next] != 0) {
+			int home = static_cast<int>(hashes[next]) & mask();
+			bool canMove = (next > hole) ? (home <= hole || home > next) : (home <= hole && home > next);
+			if (canMove) {
+				hashes[hole] = hashes[next];
+				slots[hole].key = std::move(slots[next].key);
+				slots[hole].value = std::move(slots[next].value);
+				hole = next;
 			}
-			previous = current;
-			current = current->next;
+			next = (next + 1) & mask();
 		}
-		return; // Key not found
+
+		hashes[hole] = 0;
+		slots[hole].~Slot();
+		numElements--;
 	}
 
 	// Get number of elements in hash table
@@ -142,13 +266,15 @@ public:
 		return numElements;
 	}
 
+	// Get number of slots currently allocated
+	int getCapacity() const {
+		return tableSize;
+	}
+
 	// Check if the hash table is empty
 	bool isEmpty() const {
 		return numElements == 0;
 	}
 };
 
-template <class Key, class Value>
-typename HashTable<Key, Value>::Node HashTable<Key, Value>::Node::NIL;
-
-#endif /* HASHTABLE_H */
\ No newline at end of file
+#endif /* HASHTABLE_H */
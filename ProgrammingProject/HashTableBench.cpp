@@ -0,0 +1,259 @@
+#include "HashTable.h"
+#include "Random.h"
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Microbenchmark: HashTable (open addressing) against the separately chained table it replaced,
+// for int and string keys at 10^3 up to --max entries. Times are nanoseconds per operation.
+
+namespace {
+
+// The table HashTable replaced, kept as it was: fixed bucket count, a heap node per entry,
+// and every key converted to a string to be hashed
+template <class Key, class Value>
+class ChainedHashTable {
+private:
+	struct Node {
+		Key key;
+		Value value;
+		Node* next;
+
+		// Constructor
+		Node(const Key& k, const Value& v) : key(k), value(v), next(nullptr) {}
+	};
+
+	Node** table; // Array of pointers (buckets)
+	int tableSize; // Size of the array
+	int numElements; // Number of elements stored
+
+	int hash(const Key& key) const {
+		unsigned long hashValue = 5381;
+
+		// Convert key to string representation for hashing
+		std::string keyStr = keyToString(key);
+
+		for (char c : keyStr) {
+			hashValue = ((hashValue << 5) + hashValue) + c;
+		}
+
+		return hashValue % tableSize;
+	}
+
+	std::string keyToString(const std::string& key) const {
+		return key;
+	}
+
+	template <typename T>
+	std::string keyToString(const T& key) const {
+		return std::to_string(key);
+	}
+
+public:
+	// Constructor
+	ChainedHashTable(int size) : tableSize(size), numElements(0) {
+		table = new Node*[size];
+		for (int i = 0; i < size; ++i) {
+			table[i] = nullptr;
+		}
+	}
+
+	ChainedHashTable(const ChainedHashTable&) = delete;
+	ChainedHashTable& operator=(const ChainedHashTable&) = delete;
+
+	// Destructor
+	~ChainedHashTable() {
+		for (int i = 0; i < tableSize; ++i) {
+			Node* current = table[i];
+			while (current != nullptr) {
+				Node* toDelete = current;
+				current = current->next;
+				delete toDelete;
+			}
+		}
+		delete[] table;
+	}
+
+	void insert(const Key& key, const Value& value) {
+		int index = hash(key);
+		for (Node* current = table[index]; current != nullptr; current = current->next) {
+			if (current->key == key) {
+				current->value = value;
+				return;
+			}
+		}
+
+		Node* newNode = new Node(key, value);
+		newNode->next = table[index];
+		table[index] = newNode;
+		numElements++;
+	}
+
+	Value* search(const Key& key) const {
+		for (Node* current = table[hash(key)]; current != nullptr; current = current->next) {
+			if (current->key == key) {
+				return &current->value;
+			}
+		}
+		return nullptr;
+	}
+
+	int getSize() const {
+		return numElements;
+	}
+};
+
+struct Timings {
+	double insertNs;
+	double hitNs;
+	double missNs;
+	long long checksum; // Keeps the lookups from being optimised away
+};
+
+double nanosecondsPer(std::chrono::steady_clock::time_point aStart, std::size_t aOperations) {
+	std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - aStart;
+	return elapsed.count() / static_cast<double>(aOperations);
+}
+
+// Insert aKeys, look every one up in a shuffled order, then look up aMisses (none present)
+template <class Table, class Key>
+Timings measure(Table& aTable, const std::vector<Key>& aKeys, const std::vector<Key>& aLookups, const std::vector<Key>& aMisses) {
+	Timings timings = { 0.0, 0.0, 0.0, 0 };
+
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	for (std::size_t i = 0; i < aKeys.size(); ++i) {
+		aTable.insert(aKeys[i], static_cast<int>(i));
+	}
+	timings.insertNs = nanosecondsPer(start, aKeys.size());
+
+	start = std::chrono::steady_clock::now();
+	for (const Key& key : aLookups) {
+		int* value = aTable.search(key);
+		timings.checksum += value != nullptr ? *value : -1;
+	}
+	timings.hitNs = nanosecondsPer(start, aLookups.size());
+
+	start = std::chrono::steady_clock::now();
+	for (const Key& key : aMisses) {
+		timings.checksum += aTable.search(key) != nullptr ? 1 : 0;
+	}
+	timings.missNs = nanosecondsPer(start, aMisses.size());
+	return timings;
+}
+
+template <class Key>
+void shuffle(std::vector<Key>& aKeys, Random& aRandom) {
+	for (std::size_t i = aKeys.size(); i > 1; --i) {
+		std::size_t j = static_cast<std::size_t>(aRandom.next() % i);
+		std::swap(aKeys[i - 1], aKeys[j]);
+	}
+}
+
+void printRow(std::size_t aEntries, const char* aKeyType, const char* aTable, const Timings& aTimings) {
+	std::cout << std::setw(10) << aEntries << "  " << std::left << std::setw(7) << aKeyType
+		<< std::setw(15) << aTable << std::right << std::fixed << std::setprecision(1)
+		<< std::setw(10) << aTimings.insertNs << std::setw(10) << aTimings.hitNs
+		<< std::setw(10) << aTimings.missNs << "\n";
+}
+
+template <class Key, class MakeKey>
+void runSize(std::size_t aEntries, int aChainedBuckets, const char* aKeyType, MakeKey aMakeKey, Random& aRandom, long long& aChecksum) {
+	std::vector<Key> keys;
+	std::vector<Key> misses;
+	keys.reserve(aEntries);
+	misses.reserve(aEntries);
+	for (std::size_t i = 0; i < aEntries; ++i) {
+		keys.push_back(aMakeKey(2 * i));
+		misses.push_back(aMakeKey(2 * i + 1));
+	}
+	shuffle(keys, aRandom);
+	std::vector<Key> lookups = keys;
+	shuffle(lookups, aRandom);
+
+	{
+		HashTable<Key, int> table;
+		Timings timings = measure(table, keys, lookups, misses);
+		aChecksum += timings.checksum + table.getSize();
+		printRow(aEntries, aKeyType, "open", timings);
+	}
+	{
+		int buckets = aChainedBuckets > 0 ? aChainedBuckets : static_cast<int>(aEntries);
+		ChainedHashTable<Key, int> table(buckets);
+		Timings timings = measure(table, keys, lookups, misses);
+		aChecksum += timings.checksum + table.getSize();
+		printRow(aEntries, aKeyType, "chained", timings);
+	}
+}
+
+void printUsage() {
+	std::cerr << "Usage: hashtable_bench [options]\n"
+		<< "  --max N              Largest table, a power of ten (default 10000000)\n"
+		<< "  --string-max N       Largest table with string keys (default 1000000)\n"
+		<< "  --chained-buckets N  Buckets in the chained table (default one per entry, its best\n"
+		<< "                       case; 50 was the old default and is quadratic past ~10^4)\n"
+		<< "  --seed N             Seed for the key order (default 1)\n";
+}
+
+bool parseCount(const char* aText, long long& aValue) {
+	char* end = nullptr;
+	aValue = std::strtoll(aText, &end, 10);
+	return end != aText && *end == '\0' && aValue > 0;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+	long long maxEntries = 10000000;
+	long long stringMax = 1000000;
+	long long chainedBuckets = 0;
+	long long seed = 1;
+
+	for (int i = 1; i < argc; ++i) {
+		std::string option = argv[i];
+		bool valid = i + 1 < argc;
+		if (option == "--help" || option == "-h") {
+			printUsage();
+			return 0;
+		}
+		else if (valid && option == "--max") {
+			valid = parseCount(argv[++i], maxEntries);
+		}
+		else if (valid && option == "--string-max") {
+			valid = parseCount(argv[++i], stringMax);
+		}
+		else if (valid && option == "--chained-buckets") {
+			valid = parseCount(argv[++i], chainedBuckets) && chainedBuckets <= 0x7FFFFFFF;
+		}
+		else if (valid && option == "--seed") {
+			valid = parseCount(argv[++i], seed);
+		}
+		else {
+			valid = false;
+		}
+
+		if (!valid) {
+			std::cerr << "Invalid option: " << option << "\n";
+			printUsage();
+			return 1;
+		}
+	}
+
+	Random random(static_cast<std::uint64_t>(seed));
+	long long checksum = 0;
+
+	std::cout << "   entries  key    table              insert       hit      miss  (ns/op)\n";
+	for (long long entries = 1000; entries <= maxEntries; entries *= 10) {
+		std::size_t count = static_cast<std::size_t>(entries);
+		runSize<int>(count, static_cast<int>(chainedBuckets), "int",
+			[](std::size_t aIndex) { return static_cast<int>(aIndex); }, random, checksum);
+		if (entries <= stringMax) {
+			runSize<std::string>(count, static_cast<int>(chainedBuckets), "string",
+				[](std::size_t aIndex) { return "item_" + std::to_string(aIndex); }, random, checksum);
+		}
+	}
+	std::cout << "(checksum " << checksum << ")\n";
+	return 0;
+}
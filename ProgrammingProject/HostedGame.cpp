@@ -0,0 +1,257 @@
+#include "HostedGame.h"
+#include "GameEngine.h"
+#include "Random.h"
+#include <cstdint>
+#include <exception>
+#include <iostream>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace {
+
+// Buffers that grew past this while busy are released once drained, so idle games stay small
+const std::size_t IDLE_BUFFER_CAPACITY = 16 * 1024;
+
+}
+
+// ============================================================================
+// INPUT
+// ============================================================================
+
+// Constructor
+HostedGame::InputBuffer::InputBuffer(HostedGame& aGame) : fGame(aGame) {
+	setg(&fData[0], &fData[0], &fData[0]);
+}
+
+HostedGame::InputBuffer::int_type HostedGame::InputBuffer::underflow() {
+	while (gptr() == egptr()) {
+		if (fGame.fClosed) {
+			throw Closed(); // std::cin rethrows it: its exception mask includes badbit while a game runs
+		}
+		fGame.suspend();
+	}
+	return traits_type::to_int_type(*gptr());
+}
+
+void HostedGame::InputBuffer::append(const char* aData, std::size_t aLength) {
+	fData.erase(0, gptr() - eback());
+	if (fData.empty() && fData.capacity() > IDLE_BUFFER_CAPACITY) {
+		std::string().swap(fData);
+	}
+
+	for (std::size_t i = 0; i < aLength; ++i) {
+		if (aData[i] != '\r') {
+			fData.push_back(aData[i]);
+			if (fGame.fRecording) {
+				fGame.fReplay.appendInput(&aData[i], 1);
+			}
+		}
+	}
+	setg(&fData[0], &fData[0], &fData[0] + fData.size());
+}
+
+std::size_t HostedGame::InputBuffer::getPending() const {
+	return egptr() - gptr();
+}
+
+// ============================================================================
+// OUTPUT
+// ============================================================================
+
+HostedGame::OutputBuffer::int_type HostedGame::OutputBuffer::overflow(int_type aCharacter) {
+	if (!traits_type::eq_int_type(aCharacter, traits_type::eof())) {
+		char character = traits_type::to_char_type(aCharacter);
+		xsputn(&character, 1);
+	}
+	return traits_type::not_eof(aCharacter);
+}
+
+std::streamsize HostedGame::OutputBuffer::xsputn(const char* aText, std::streamsize aCount) {
+	for (std::streamsize i = 0; i < aCount; ++i) {
+		if (aText[i] == '\n') {
+			fData.push_back('\r');
+		}
+		fData.push_back(aText[i]);
+	}
+	return aCount;
+}
+
+void HostedGame::OutputBuffer::take(std::string& aOutput) {
+	aOutput.append(fData);
+	fData.clear();
+	if (fData.capacity() > IDLE_BUFFER_CAPACITY) {
+		std::string().swap(fData);
+	}
+}
+
+// ============================================================================
+// STREAM STATE
+// ============================================================================
+
+HostedGame::StreamState HostedGame::StreamState::capture() {
+	StreamState state;
+	state.inState = std::cin.rdstate();
+	state.inExceptions = std::cin.exceptions();
+	state.outFlags = std::cout.flags();
+	state.outPrecision = std::cout.precision();
+	state.outWidth = std::cout.width();
+	state.outFill = std::cout.fill();
+	return state;
+}
+
+void HostedGame::StreamState::apply() const {
+	std::cin.exceptions(std::ios_base::goodbit);
+	std::cin.clear(inState);
+	std::cin.exceptions(inExceptions);
+	std::cout.flags(outFlags);
+	std::cout.precision(outPrecision);
+	std::cout.width(outWidth);
+	std::cout.fill(outFill);
+}
+
+// ============================================================================
+// GAME
+// ============================================================================
+
+// Constructor
+HostedGame::HostedGame(const ContentPack& aContent)
+	: fSession(nullptr, &aContent), fRecording(false), fInput(*this), fStack(nullptr),
+	fStarted(false), fRunning(false), fFinished(false), fClosed(false) {
+	// A fresh std::cin/std::cout, except that a failing input buffer throws (see InputBuffer::underflow)
+	fGameStreams.inState = std::ios_base::goodbit;
+	fGameStreams.inExceptions = std::ios_base::badbit;
+	fGameStreams.outFlags = std::ios_base::dec | std::ios_base::skipws;
+	fGameStreams.outPrecision = 6;
+	fGameStreams.outWidth = 0;
+	fGameStreams.outFill = ' ';
+}
+
+bool HostedGame::initialize() {
+	if (!fSession.initialize()) {
+		return false;
+	}
+
+	void* stack = mmap(nullptr, STACK_SIZE, PROT_READ | PROT_WRITE,
+		MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE | MAP_STACK, -1, 0);
+	if (stack == MAP_FAILED) {
+		return false;
+	}
+	// Overflow faults instead of corrupting the heap
+	if (mprotect(stack, sysconf(_SC_PAGESIZE), PROT_NONE) != 0) {
+		munmap(stack, STACK_SIZE);
+		return false;
+	}
+	fStack = static_cast<char*>(stack);
+
+	getcontext(&fContext);
+	fContext.uc_stack.ss_sp = fStack;
+	fContext.uc_stack.ss_size = STACK_SIZE;
+	fContext.uc_link = &fHostContext; // Returning from entry() lands back in resume()
+
+	// makecontext only passes int arguments, so the pointer travels in two halves
+	std::uint64_t self = reinterpret_cast<std::uintptr_t>(this);
+	makecontext(&fContext, reinterpret_cast<void (*)()>(&HostedGame::entry), 2,
+		static_cast<unsigned int>(self >> 32), static_cast<unsigned int>(self & 0xffffffffu));
+	fStarted = true;
+	return true;
+}
+
+void HostedGame::entry(unsigned int aHigh, unsigned int aLow) {
+	std::uint64_t self = (static_cast<std::uint64_t>(aHigh) << 32) | aLow;
+	reinterpret_cast<HostedGame*>(static_cast<std::uintptr_t>(self))->run();
+}
+
+// The game proper: a new game on this connection, start to finish
+void HostedGame::run() {
+	fReplay.setSeed(RandomStreams::generateSeed());
+	fReplay.setProfiles(fSession.getGameEngine().getProfileStore() != nullptr);
+	try {
+		fSession.playNewGame(fReplay.getSeed());
+		std::cout << "\n  Thanks for playing OUTBREAK.\n";
+	}
+	catch (const Closed&) {
+		// Connection gone; every frame of the game has unwound
+	}
+	catch (const std::exception& e) {
+		std::cout << "\n  [ERROR] Session ended: " << e.what() << "\n";
+	}
+	if (fRecording) {
+		fReplay.setStateHash(fSession.getStateHash());
+	}
+	fFinished = true;
+}
+
+void HostedGame::suspend() {
+	swapcontext(&fContext, &fHostContext);
+}
+
+void HostedGame::resume() {
+	if (!fStarted || fFinished || fRunning) {
+		return;
+	}
+
+	// Lend std::cin/std::cout to the game for as long as it runs
+	StreamState hostStreams = StreamState::capture();
+	std::streambuf* hostInput = std::cin.rdbuf(&fInput);
+	std::streambuf* hostOutput = std::cout.rdbuf(&fOutput);
+	fGameStreams.apply();
+
+	fRunning = true;
+	swapcontext(&fHostContext, &fContext);
+	fRunning = false;
+
+	fGameStreams = StreamState::capture();
+	std::cin.rdbuf(hostInput);
+	std::cout.rdbuf(hostOutput);
+	hostStreams.apply();
+}
+
+void HostedGame::setRecording(bool aRecording) {
+	fRecording = aRecording;
+}
+
+const ReplayLog* HostedGame::getReplay() const {
+	return fRecording ? &fReplay : nullptr;
+}
+
+GameSession& HostedGame::getSession() {
+	return fSession;
+}
+
+void HostedGame::receive(const char* aData, std::size_t aLength) {
+	fInput.append(aData, aLength);
+}
+
+void HostedGame::close() {
+	if (fFinished) {
+		return;
+	}
+	fClosed = true;
+	resume(); // The next read finds no input and throws Closed
+}
+
+void HostedGame::takeOutput(std::string& aOutput) {
+	fOutput.take(aOutput);
+}
+
+bool HostedGame::isFinished() const {
+	return fFinished;
+}
+
+bool HostedGame::isClosed() const {
+	return fClosed;
+}
+
+std::size_t HostedGame::getPendingInput() const {
+	return fInput.getPending();
+}
+
+// Destructor
+HostedGame::~HostedGame() {
+	if (fStarted && !fFinished) {
+		close();
+	}
+	if (fStack != nullptr) {
+		munmap(fStack, STACK_SIZE);
+	}
+}
@@ -0,0 +1,126 @@
+#ifndef HOSTEDGAME_H
+#define HOSTEDGAME_H
+#include "GameSession.h"
+#include "ReplayLog.h"
+#include <cstddef>
+#include <ios>
+#include <streambuf>
+#include <string>
+#include <ucontext.h>
+
+class ContentPack;
+
+// One remote player's game, run as a coroutine on its own stack (POSIX ucontext).
+// The game code is unchanged: while it runs, std::cin and std::cout point at this game's buffers,
+// and reading past the input received so far suspends it until the host feeds more. A suspended
+// game costs its session state and the stack pages it has touched, nothing else.
+// Not thread-safe: every game of a process must be resumed from the same thread.
+class HostedGame {
+private:
+	// Bytes received from the connection; running dry suspends the game
+	class InputBuffer : public std::streambuf {
+	private:
+		HostedGame& fGame;
+		std::string fData;
+
+	protected:
+		int_type underflow() override;
+
+	public:
+		// Constructor
+		explicit InputBuffer(HostedGame& aGame);
+
+		void append(const char* aData, std::size_t aLength); // Drops '\r' so telnet's CRLF reads as lines
+		std::size_t getPending() const;
+	};
+
+	// Everything the game prints, with '\n' sent as telnet's CRLF
+	class OutputBuffer : public std::streambuf {
+	private:
+		std::string fData;
+
+	protected:
+		int_type overflow(int_type aCharacter) override;
+		std::streamsize xsputn(const char* aText, std::streamsize aCount) override;
+
+	public:
+		void take(std::string& aOutput);
+	};
+
+	// std::cin/std::cout state that belongs to whoever is running
+	struct StreamState {
+		std::ios_base::iostate inState;
+		std::ios_base::iostate inExceptions;
+		std::ios_base::fmtflags outFlags;
+		std::streamsize outPrecision;
+		std::streamsize outWidth;
+		char outFill;
+
+		static StreamState capture();
+		void apply() const;
+	};
+
+	// Thrown through the game's frames when the connection goes away (not a std::exception,
+	// so the game's own handlers let it pass)
+	struct Closed {};
+
+	GameSession fSession;
+	ReplayLog fReplay;
+	bool fRecording;
+	InputBuffer fInput;
+	OutputBuffer fOutput;
+	StreamState fGameStreams;
+
+	char* fStack; // mmap'd, lowest page is a guard
+	ucontext_t fContext;
+	ucontext_t fHostContext;
+	bool fStarted;
+	bool fRunning;
+	bool fFinished;
+	bool fClosed;
+
+	static void entry(unsigned int aHigh, unsigned int aLow);
+	void run();
+	void suspend(); // Game side: hand control back to the host
+
+public:
+	static const std::size_t STACK_SIZE = 256 * 1024;
+
+	// Constructor (the content pack must be loaded and outlive the game)
+	explicit HostedGame(const ContentPack& aContent);
+
+	HostedGame(const HostedGame&) = delete;
+	HostedGame& operator=(const HostedGame&) = delete;
+
+	// Build the world and the coroutine stack; false if either fails
+	bool initialize();
+
+	// Keep an input log of the game for the replay tool (call before the first resume)
+	void setRecording(bool aRecording);
+
+	// The game's input log, complete with its state hash once the game has finished;
+	// nullptr unless recording
+	const ReplayLog* getReplay() const;
+
+	GameSession& getSession();
+
+	void receive(const char* aData, std::size_t aLength);
+
+	// Run until the game needs input it has not received, or ends
+	void resume();
+
+	// The connection is gone: unwind the game's frames and finish it (no-op once finished)
+	void close();
+
+	// Output produced since the last call, appended to aOutput
+	void takeOutput(std::string& aOutput);
+
+	bool isFinished() const;
+	bool isClosed() const; // Finished by close() rather than by reaching its end
+	std::size_t getPendingInput() const;
+
+	// Destructor (closes a game still in progress)
+	~HostedGame();
+};
+
+#endif /* HOSTEDGAME_H */
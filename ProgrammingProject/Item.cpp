@@ -13,7 +13,7 @@ Item::Item(const std::string& aID, const std::string& aName, Category aCategory,
 	int aQuantity, int aInventorySpace, bool aConsumable, bool aUsable,
 	int aHealthRestore, int aHungerRestore, int aInfectionCure, int aDamageBoost,
 	EffectType aEffectType, int aEffectTurns, int aEffectPower)
-	: Entity(aName), fCategory(aCategory), fDescription(aDescription), fQuantity(aQuantity),
+	: Entity(aID, aName), fCategory(aCategory), fDescription(aDescription), fQuantity(aQuantity),
 	fInventorySpace(aInventorySpace), fConsumable(aConsumable), fUsable(aUsable),
 	fHealthRestore(aHealthRestore), fHungerRestore(aHungerRestore),
 	fInfectionCure(aInfectionCure), fDamageBoost(aDamageBoost), fAmmo(0), fMaxAmmo(0),
@@ -0,0 +1,55 @@
+#ifndef KEYHASH_H
+#define KEYHASH_H
+#include <string>
+#include <string_view>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+// Finalising mix so that the low bits (used as the bucket index) depend on every input bit
+inline unsigned int mixHash(std::uint64_t x) {
+	x ^= x >> 33;
+	x *= 0xff51afd7ed558ccdULL;
+	x ^= x >> 33;
+	x *= 0xc4ceb9fe1a85ec53ULL;
+	x ^= x >> 33;
+	return static_cast<unsigned int>(x);
+}
+
+// DJB2 over a run of characters
+inline unsigned int hashChars(const char* data, std::size_t length) {
+	std::uint64_t hashValue = 5381;
+	for (std::size_t i = 0; i < length; ++i) {
+		hashValue = ((hashValue << 5) + hashValue) + static_cast<unsigned char>(data[i]);
+	}
+	return mixHash(hashValue);
+}
+
+// Hashing specialised per key type. Integral and enum keys are mixed directly,
+// strings are hashed over their characters, so std::string, string_view and
+// const char* all produce the same hash without building a temporary.
+template <class Key, class Enable = void>
+struct KeyHash;
+
+template <class Key>
+struct KeyHash<Key, typename std::enable_if<std::is_integral<Key>::value || std::is_enum<Key>::value>::type> {
+	static unsigned int hash(Key key) {
+		return mixHash(static_cast<std::uint64_t>(key));
+	}
+};
+
+template <class T>
+struct KeyHash<T*> {
+	static unsigned int hash(const T* key) {
+		return mixHash(static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(key)));
+	}
+};
+
+template <>
+struct KeyHash<std::string> {
+	static unsigned int hash(std::string_view key) {
+		return hashChars(key.data(), key.size());
+	}
+};
+
+#endif /* KEYHASH_H */
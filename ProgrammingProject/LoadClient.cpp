@@ -0,0 +1,345 @@
+#include <algorithm>
+#include <arpa/inet.h>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sstream>
+#include <string>
+#include <sys/epoll.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+// Scripted load client for outbreak_server: opens many loopback connections at once, plays a
+// short command script on each (answering the game's own prompts in between) and reports how
+// long the server took to come back with each prompt. The server marks every prompt with
+// telnet GA, so the client always knows when it is its turn.
+
+namespace {
+
+enum class ClientState {
+	CONNECTING,
+	PLAYING,
+	DONE, // Script finished, connection left open and idle
+	ENDED, // The server closed the connection (the game ended)
+	FAILED
+};
+
+struct Client {
+	int fd;
+	int index;
+	ClientState state;
+	std::string text; // Output since the last prompt (last few KB only)
+	int commandsSent;
+	long long sentAt; // Microseconds, when the last line went out
+};
+
+const std::size_t MAX_PROMPT_TEXT = 4096;
+
+long long nowMicroseconds() {
+	return std::chrono::duration_cast<std::chrono::microseconds>(
+		std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void printUsage() {
+	std::cerr << "Usage: load_client [options]\n"
+		<< "  --host ADDRESS      Server IPv4 address (default 127.0.0.1)\n"
+		<< "  --port N            Server port (default 4000)\n"
+		<< "  --connections N     Concurrent connections (default 10000)\n"
+		<< "  --commands N        Exploration commands per connection (default 20)\n"
+		<< "  --script A,B        Commands to cycle through (default status,inventory,clues)\n"
+		<< "  --ramp N            Connection attempts in flight at once (default 256)\n"
+		<< "  --hold N            Keep the idle connections open N seconds before exiting (default 0)\n";
+}
+
+bool parseInteger(const char* aText, long long& aValue) {
+	char* end = nullptr;
+	aValue = std::strtoll(aText, &end, 10);
+	return end != aText && *end == '\0';
+}
+
+void raiseDescriptorLimit() {
+	rlimit limit;
+	if (getrlimit(RLIMIT_NOFILE, &limit) == 0 && limit.rlim_cur < limit.rlim_max) {
+		limit.rlim_cur = limit.rlim_max;
+		setrlimit(RLIMIT_NOFILE, &limit);
+	}
+}
+
+bool sendLine(Client& aClient, const std::string& aLine) {
+	std::string line = aLine + "\r\n";
+	aClient.sentAt = nowMicroseconds();
+	// Lines are tiny, so a short write only happens if the server stopped reading
+	return send(aClient.fd, line.data(), line.size(), MSG_NOSIGNAL) == (ssize_t)line.size();
+}
+
+// The game stopped for input: answer from the prompt on its last line
+bool answerPrompt(Client& aClient, const std::vector<std::string>& aScript, int aCommandCount) {
+	std::size_t lastBreak = aClient.text.find_last_of('\n');
+	std::string prompt = lastBreak == std::string::npos ? aClient.text : aClient.text.substr(lastBreak + 1);
+	std::string answer;
+
+	if (prompt.find("Command:") != std::string::npos) {
+		if (aClient.commandsSent >= aCommandCount) {
+			aClient.state = ClientState::DONE;
+			return true;
+		}
+		answer = aScript[aClient.commandsSent % aScript.size()];
+		aClient.commandsSent++;
+	}
+	else if (prompt.find("Enter name") != std::string::npos) {
+		answer = "Bot" + std::to_string(aClient.index);
+	}
+	else if (prompt.find("(y/n)") != std::string::npos) {
+		answer = "y";
+	}
+	else if (prompt.find("ENTER") != std::string::npos) {
+		answer = "";
+	}
+	else if (prompt.find("Choice:") != std::string::npos && aClient.text.find("[1] Attack") != std::string::npos) {
+		answer = "1"; // Fight it out
+	}
+	else {
+		answer = "0"; // Back out of menus
+	}
+	return sendLine(aClient, answer);
+}
+
+double percentile(const std::vector<long long>& aSorted, double aFraction) {
+	if (aSorted.empty()) return 0.0;
+	std::size_t index = static_cast<std::size_t>(aFraction * (aSorted.size() - 1));
+	return aSorted[index] / 1000.0;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+	std::string host = "127.0.0.1";
+	long long port = 4000;
+	long long connections = 10000;
+	long long commands = 20;
+	long long ramp = 256;
+	long long holdSeconds = 0;
+	std::string scriptText = "status,inventory,clues";
+
+	for (int i = 1; i < argc; ++i) {
+		std::string option = argv[i];
+		bool hasValue = i + 1 < argc;
+		bool valid = true;
+
+		if (option == "--help" || option == "-h") {
+			printUsage();
+			return 0;
+		}
+		else if (!hasValue) {
+			valid = false;
+		}
+		else if (option == "--host") {
+			host = argv[++i];
+		}
+		else if (option == "--port") {
+			valid = parseInteger(argv[++i], port) && port > 0 && port < 65536;
+		}
+		else if (option == "--connections") {
+			valid = parseInteger(argv[++i], connections) && connections > 0;
+		}
+		else if (option == "--commands") {
+			valid = parseInteger(argv[++i], commands) && commands >= 0;
+		}
+		else if (option == "--script") {
+			scriptText = argv[++i];
+		}
+		else if (option == "--ramp") {
+			valid = parseInteger(argv[++i], ramp) && ramp > 0;
+		}
+		else if (option == "--hold") {
+			valid = parseInteger(argv[++i], holdSeconds) && holdSeconds >= 0;
+		}
+		else {
+			valid = false;
+		}
+
+		if (!valid) {
+			std::cerr << "Invalid option: " << option << "\n";
+			printUsage();
+			return 1;
+		}
+	}
+
+	std::vector<std::string> script;
+	std::stringstream scriptList(scriptText);
+	std::string command;
+	while (std::getline(scriptList, command, ',')) {
+		script.push_back(command);
+	}
+	if (script.empty()) {
+		std::cerr << "Empty script\n";
+		return 1;
+	}
+
+	sockaddr_in address;
+	std::memset(&address, 0, sizeof(address));
+	address.sin_family = AF_INET;
+	address.sin_port = htons(static_cast<unsigned short>(port));
+	if (inet_pton(AF_INET, host.c_str(), &address.sin_addr) != 1) {
+		std::cerr << "Invalid host: " << host << "\n";
+		return 1;
+	}
+
+	raiseDescriptorLimit();
+	int epollFd = epoll_create1(EPOLL_CLOEXEC);
+
+	std::vector<Client> clients(connections);
+	std::vector<long long> latencies; // Microseconds from a line sent to the next prompt
+	latencies.reserve(connections * (commands + 4));
+
+	long long opened = 0;
+	long long connecting = 0;
+	long long active = 0; // Connecting or playing
+	long long failed = 0;
+	long long done = 0;
+	long long ended = 0;
+	long long start = nowMicroseconds();
+
+	std::cout << "Opening " << connections << " connections to " << host << ":" << port
+		<< ", " << commands << " commands each" << std::endl;
+
+	epoll_event events[512];
+	char buffer[16 * 1024];
+
+	while (opened < connections || active > 0) {
+		// Ramp up: a bounded number of handshakes in flight keeps the listen backlog from overflowing
+		while (opened < connections && connecting < ramp) {
+			Client& client = clients[opened];
+			client.index = static_cast<int>(opened);
+			client.commandsSent = 0;
+			client.sentAt = nowMicroseconds();
+			opened++;
+
+			client.fd = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+			if (client.fd < 0 ||
+				(connect(client.fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) < 0 && errno != EINPROGRESS)) {
+				if (client.fd >= 0) ::close(client.fd);
+				client.state = ClientState::FAILED;
+				failed++;
+				continue;
+			}
+			int enable = 1;
+			setsockopt(client.fd, IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(enable));
+
+			client.state = ClientState::CONNECTING;
+			epoll_event event;
+			event.events = EPOLLOUT;
+			event.data.ptr = &client;
+			epoll_ctl(epollFd, EPOLL_CTL_ADD, client.fd, &event);
+			connecting++;
+			active++;
+		}
+
+		int count = epoll_wait(epollFd, events, 512, 1000);
+		for (int i = 0; i < count; ++i) {
+			Client& client = *static_cast<Client*>(events[i].data.ptr);
+
+			if (client.state == ClientState::CONNECTING) {
+				int error = 0;
+				socklen_t length = sizeof(error);
+				getsockopt(client.fd, SOL_SOCKET, SO_ERROR, &error, &length);
+				connecting--;
+				if (error != 0) {
+					epoll_ctl(epollFd, EPOLL_CTL_DEL, client.fd, nullptr);
+					::close(client.fd);
+					client.state = ClientState::FAILED;
+					failed++;
+					active--;
+					continue;
+				}
+				client.state = ClientState::PLAYING;
+				epoll_event event;
+				event.events = EPOLLIN;
+				event.data.ptr = &client;
+				epoll_ctl(epollFd, EPOLL_CTL_MOD, client.fd, &event);
+				continue;
+			}
+
+			// Read everything; every telnet GA (0xff 0xf9) is the game asking for a line
+			bool closed = false;
+			bool ok = true;
+			while (ok && !closed) {
+				ssize_t received = recv(client.fd, buffer, sizeof(buffer), 0);
+				if (received == 0 || (received < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)) {
+					closed = true;
+					break;
+				}
+				if (received < 0) {
+					break;
+				}
+
+				for (ssize_t j = 0; j < received && ok; ++j) {
+					if ((unsigned char)buffer[j] == 0xff && j + 1 < received && (unsigned char)buffer[j + 1] == 0xf9) {
+						latencies.push_back(nowMicroseconds() - client.sentAt);
+						ok = answerPrompt(client, script, static_cast<int>(commands));
+						client.text.clear();
+						j++;
+						if (client.state == ClientState::DONE) {
+							done++;
+							active--;
+						}
+					}
+					else {
+						client.text.push_back(buffer[j]);
+					}
+				}
+				if (client.text.size() > MAX_PROMPT_TEXT) {
+					client.text.erase(0, client.text.size() - MAX_PROMPT_TEXT);
+				}
+			}
+
+			if (closed || !ok) {
+				epoll_ctl(epollFd, EPOLL_CTL_DEL, client.fd, nullptr);
+				::close(client.fd);
+				if (client.state == ClientState::PLAYING) {
+					client.state = closed ? ClientState::ENDED : ClientState::FAILED;
+					(closed ? ended : failed)++;
+					active--;
+				}
+				else if (client.state == ClientState::DONE) {
+					client.state = ClientState::ENDED; // Server let go after the script finished
+				}
+			}
+		}
+	}
+
+	double seconds = (nowMicroseconds() - start) / 1e6;
+	std::sort(latencies.begin(), latencies.end());
+
+	std::cout << std::fixed << std::setprecision(2);
+	std::cout << "  Scripts finished:  " << done << " (idle connections still open)\n";
+	std::cout << "  Games ended:       " << ended << " (server closed the connection)\n";
+	std::cout << "  Failed:            " << failed << "\n";
+	std::cout << "  Prompts answered:  " << latencies.size() << " in " << seconds << " s, "
+		<< std::setprecision(0) << latencies.size() / seconds << " per second\n";
+	std::cout << std::setprecision(2) << "  Prompt latency ms: p50 " << percentile(latencies, 0.50)
+		<< "  p90 " << percentile(latencies, 0.90) << "  p99 " << percentile(latencies, 0.99)
+		<< "  max " << percentile(latencies, 1.0) << std::endl;
+
+	if (holdSeconds > 0) {
+		std::cout << "  Holding idle connections for " << holdSeconds << " s" << std::endl;
+		std::this_thread::sleep_for(std::chrono::seconds(holdSeconds));
+	}
+
+	for (Client& client : clients) {
+		if (client.state == ClientState::DONE) {
+			::close(client.fd);
+		}
+	}
+	::close(epollFd);
+	return failed == 0 ? 0 : 1;
+}
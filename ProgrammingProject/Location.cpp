@@ -52,18 +52,18 @@ Location::~Location() {
 }
 
 // Connection management (graph edges)
-void Location::addConnection(const std::string& aLocationID) {
+void Location::addConnection(Symbol aLocationID) {
 	// Check if connection already exists
 	if (!isConnectedTo(aLocationID)) {
 		fConnectedLocations.pushBack(aLocationID);
 	}
 }
 
-void Location::removeConnection(const std::string& aLocationID) {
+void Location::removeConnection(Symbol aLocationID) {
 	fConnectedLocations.remove(aLocationID);
 }
 
-bool Location::isConnectedTo(const std::string& aLocationID) const {
+bool Location::isConnectedTo(Symbol aLocationID) const {
 	for (auto it = fConnectedLocations.begin(); it != fConnectedLocations.end(); ++it) {
 		if (*it == aLocationID) {
 			return true;
@@ -72,7 +72,7 @@ bool Location::isConnectedTo(const std::string& aLocationID) const {
 	return false;
 }
 
-SinglyLinkedList<std::string>& Location::getConnections() {
+SinglyLinkedList<Symbol>& Location::getConnections() {
 	return fConnectedLocations;
 }
 
@@ -85,6 +85,10 @@ void Location::addItem(const Item& aItem) {
 	fItemsInLocation.pushBack(aItem);
 }
 
+void Location::addItem(Item&& aItem) {
+	fItemsInLocation.pushBack(std::move(aItem));
+}
+
 bool Location::removeItem(const Item& aItem) {
 	return fItemsInLocation.remove(aItem);
 }
@@ -334,15 +338,14 @@ std::string Location::getChapterStory() const {
 	return fChapterStory;
 }
 
-void Location::displayChapterIntro() const {
+void Location::displayChapterIntro(AudioEngine* aAudio) const {
 	if (fChapterNumber == 0) {
 		return; // No chapter assigned
 	}
 
 	// Play location music when displaying chapter intro
-	AudioEngine* audio = AudioEngine::getInstance();
-	if (audio) {
-		audio->playLocationMusic(fID);
+	if (aAudio) {
+		aAudio->playLocationMusic(fID);
 	}
 
 	std::cout << "\n";
@@ -7,6 +7,8 @@
 #include "Zombie.h"
 #include <string>
 
+class AudioEngine;
+
 class Location : public Entity {
 public:
 	enum class LocationType {
@@ -38,7 +40,7 @@ private:
 	bool fCleared; // All zombies defeated
 
 	// Graph connections (bidirectional edges)
-	SinglyLinkedList<std::string> fConnectedLocations; // IDs of connected locations
+	SinglyLinkedList<Symbol> fConnectedLocations; // IDs of connected locations
 
 	// Location contents
 	SinglyLinkedList<Item> fItemsInLocation;
@@ -71,14 +73,15 @@ public:
 	virtual ~Location();
 
 	// Connection management (graph edges)
-	void addConnection(const std::string& aLocationID);
-	void removeConnection(const std::string& aLocationID);
-	bool isConnectedTo(const std::string& aLocationID) const;
-	SinglyLinkedList<std::string>& getConnections();
+	void addConnection(Symbol aLocationID);
+	void removeConnection(Symbol aLocationID);
+	bool isConnectedTo(Symbol aLocationID) const;
+	SinglyLinkedList<Symbol>& getConnections();
 	int getConnectionCount() const;
 
 	// Item management
 	void addItem(const Item& aItem);
+	void addItem(Item&& aItem);
 	bool removeItem(const Item& aItem);
 	SinglyLinkedList<Item>& getItems();
 	bool hasItems() const;
@@ -110,7 +113,7 @@ public:
 	int getChapterNumber() const;
 	std::string getChapterTitle() const;
 	std::string getChapterStory() const;
-	void displayChapterIntro() const;
+	void displayChapterIntro(AudioEngine* aAudio) const; // Plays the location music on aAudio, if given
 
 	// Getter methods
 	LocationType getLocationType() const;
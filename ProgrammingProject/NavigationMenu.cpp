@@ -1,13 +1,8 @@
 #include "NavigationMenu.h"
+#include "Platform.h"
 #include <iostream>
 #include <cstdlib>
 
-#ifdef _WIN32
-	#define CLEAR_SCREEN "cls"
-#else
-	#define CLEAR_SCREEN "clear"
-#endif
-
 NavigationMenu::NavigationMenu() : selectedIndex(0), lastRenderedIndex(-1), isRunning(false) {
 	// Initialize
 }
@@ -17,7 +12,7 @@ NavigationMenu::~NavigationMenu() {
 }
 
 void NavigationMenu::clearScreen() {
-	system(CLEAR_SCREEN);
+	Platform::clearScreen();
 }
 
 void NavigationMenu::centerText(const std::string& text) {
@@ -30,34 +25,45 @@ void NavigationMenu::drawSeparator() {
 }
 
 bool NavigationMenu::handleInput(int maxOptions) {
-	#ifdef _WIN32
-		bool selectionChanged = false;
-
-		if (GetAsyncKeyState(VK_UP) & 0x8000) {
-			if (selectedIndex > 0) {
-				selectedIndex--;
-				selectionChanged = true;
-			}
-			std::this_thread::sleep_for(std::chrono::milliseconds(200));
-		}
+	bool selectionChanged = false;
 
-		if (GetAsyncKeyState(VK_DOWN) & 0x8000) {
-			if (selectedIndex < maxOptions - 1) {
-				selectedIndex++;
-				selectionChanged = true;
-			}
-			std::this_thread::sleep_for(std::chrono::milliseconds(200));
+	if (Platform::isKeyDown(Platform::Key::UP)) {
+		if (selectedIndex > 0) {
+			selectedIndex--;
+			selectionChanged = true;
 		}
+		Platform::sleepFor(200);
+	}
 
-		if (GetAsyncKeyState(VK_RETURN) & 0x8000) {
-			isRunning = false;
-			std::this_thread::sleep_for(std::chrono::milliseconds(200));
+	if (Platform::isKeyDown(Platform::Key::DOWN)) {
+		if (selectedIndex < maxOptions - 1) {
+			selectedIndex++;
+			selectionChanged = true;
 		}
+		Platform::sleepFor(200);
+	}
 
-		return selectionChanged;
-	#else
-		return false;
-	#endif
+	if (Platform::isKeyDown(Platform::Key::ENTER)) {
+		isRunning = false;
+		Platform::sleepFor(200);
+	}
+
+	return selectionChanged;
+}
+
+// Line-based selection for platforms without key polling (end of input picks the last option)
+int NavigationMenu::readSelectionLine(int maxOptions) {
+	while (true) {
+		std::cout << "\n  Select option (1-" << maxOptions << "): ";
+		std::string line;
+		if (!std::getline(std::cin, line)) {
+			return maxOptions - 1;
+		}
+		int choice = std::atoi(line.c_str());
+		if (choice >= 1 && choice <= maxOptions) {
+			return choice - 1;
+		}
+	}
 }
 
 void NavigationMenu::renderMenuOptions(const std::string& title, const std::vector<std::string>& options) {
@@ -111,6 +117,11 @@ int NavigationMenu::displayMenu(const std::string& title, const std::vector<std:
 	std::cout << "\n";
 	renderMenuOptions(title, options);
 
+	if (!Platform::supportsKeyPolling()) {
+		selectedIndex = readSelectionLine(static_cast<int>(options.size()));
+		isRunning = false;
+	}
+
 	while (isRunning) {
 		bool selectionChanged = handleInput(options.size());
 
@@ -121,7 +132,7 @@ int NavigationMenu::displayMenu(const std::string& title, const std::vector<std:
 			renderMenuOptions(title, options);
 		}
 
-		std::this_thread::sleep_for(std::chrono::milliseconds(50));
+		Platform::sleepFor(50);
 	}
 
 	return selectedIndex;
@@ -3,9 +3,6 @@
 #include <string>
 #include <vector>
 #include <iostream>
-#include <thread>
-#include <chrono>
-#include <Windows.h>
 
 class NavigationMenu {
 public:
@@ -37,6 +34,7 @@ private:
 
 	// Input handling
 	bool handleInput(int maxOptions);
+	int readSelectionLine(int maxOptions);
 	void renderMenuOptions(const std::string& title, const std::vector<std::string>& options);
 	std::string getCurrentTitle() const;
 	std::vector<std::string> getCurrentOptions() const;
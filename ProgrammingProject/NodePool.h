@@ -0,0 +1,258 @@
+#ifndef NODEPOOL_H
+#define NODEPOOL_H
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <utility>
+
+// Slab/free-list pool for fixed-size blocks.
+// Blocks are carved out of slabs and recycled through an intrusive free list, so
+// steady-state allocation never reaches the global heap. Each thread allocates from
+// its own pool without locking. Every block goes back to the pool that handed it out:
+// slabs are aligned to their size, so a block finds its slab (and owner) by masking
+// its address. A block freed on another thread is queued on the owner's remote list
+// under a lock and reclaimed the next time the owner runs dry.
+// When a thread exits, its pool lives on until the last of its blocks comes back, so
+// lists may outlive, or be destroyed after, the thread that filled them.
+template <class Block>
+class NodePool {
+private:
+	union Cell {
+		Cell* nextFree;
+		alignas(Block) unsigned char storage[sizeof(Block)];
+	};
+
+	struct SlabHeader {
+		NodePool* owner;
+		SlabHeader* nextSlab;
+	};
+
+	static constexpr std::size_t MIN_BLOCKS_PER_SLAB = 64;
+
+	static constexpr std::size_t roundUp(std::size_t value, std::size_t multiple) {
+		return (value + multiple - 1) / multiple * multiple;
+	}
+
+	static constexpr std::size_t roundUpToPowerOfTwo(std::size_t value) {
+		std::size_t result = 1;
+		while (result < value) {
+			result <<= 1;
+		}
+		return result;
+	}
+
+	static constexpr std::size_t CELLS_OFFSET = roundUp(sizeof(SlabHeader), alignof(Cell));
+	static constexpr std::size_t SLAB_BYTES = roundUpToPowerOfTwo(CELLS_OFFSET + MIN_BLOCKS_PER_SLAB * sizeof(Cell));
+	static constexpr std::size_t BLOCKS_PER_SLAB = (SLAB_BYTES - CELLS_OFFSET) / sizeof(Cell);
+
+	SlabHeader* slabs; // Every slab this pool has allocated
+	Cell* freeList; // Cells ready for reuse
+	int slabCount;
+	int liveBlocks; // Handed out and not yet reclaimed
+
+	std::mutex remoteLock; // Guards remoteFree and orphaned, and the whole pool once orphaned
+	Cell* remoteFree; // Blocks freed by other threads, not yet reclaimed
+	bool orphaned; // The owning thread has exited (or there never was one)
+
+	// Constructor
+	NodePool() : slabs(nullptr), freeList(nullptr), slabCount(0), liveBlocks(0), remoteFree(nullptr), orphaned(false) {}
+
+	// Destructor (only once every block has come back)
+	~NodePool() {
+		while (slabs != nullptr) {
+			SlabHeader* next = slabs->nextSlab;
+			::operator delete(slabs, std::align_val_t(SLAB_BYTES));
+			slabs = next;
+		}
+	}
+
+	static SlabHeader* slabOf(void* block) {
+		return reinterpret_cast<SlabHeader*>(reinterpret_cast<std::uintptr_t>(block) & ~(SLAB_BYTES - 1));
+	}
+
+	// The calling thread's pool; null once the thread has begun to exit
+	static NodePool*& currentPool() {
+		static thread_local NodePool* pool = nullptr;
+		return pool;
+	}
+
+	static bool& threadExiting() {
+		static thread_local bool exiting = false;
+		return exiting;
+	}
+
+	// Hands the pool over to its blocks when the thread exits
+	struct ThreadOwner {
+		NodePool* pool;
+
+		// Destructor
+		~ThreadOwner() {
+			currentPool() = nullptr;
+			threadExiting() = true;
+			pool->abandon();
+		}
+	};
+
+	static NodePool& getThreadPool() {
+		static thread_local ThreadOwner owner = { new NodePool() };
+		currentPool() = owner.pool;
+		return *owner.pool;
+	}
+
+	// For blocks allocated while a thread is exiting, after its own pool has been abandoned
+	static NodePool& getSharedPool() {
+		static NodePool* shared = [] {
+			NodePool* pool = new NodePool();
+			pool->orphaned = true;
+			pool->liveBlocks = 1; // Never reaches zero, the shared pool is never freed
+			return pool;
+		}();
+		return *shared;
+	}
+
+	void addSlab() {
+		void* memory = ::operator new(SLAB_BYTES, std::align_val_t(SLAB_BYTES));
+		SlabHeader* slab = static_cast<SlabHeader*>(memory);
+		slab->owner = this;
+		slab->nextSlab = slabs;
+		slabs = slab;
+		++slabCount;
+
+		Cell* cells = reinterpret_cast<Cell*>(static_cast<unsigned char*>(memory) + CELLS_OFFSET);
+		for (std::size_t i = BLOCKS_PER_SLAB; i > 0; --i) {
+			cells[i - 1].nextFree = freeList;
+			freeList = &cells[i - 1];
+		}
+	}
+
+	// Move blocks freed by other threads onto the free list (remoteLock held)
+	void reclaimRemoteLocked() {
+		while (remoteFree != nullptr) {
+			Cell* next = remoteFree->nextFree;
+			give(remoteFree);
+			remoteFree = next;
+		}
+	}
+
+	void* take() {
+		if (freeList == nullptr) {
+			addSlab();
+		}
+		Cell* cell = freeList;
+		freeList = cell->nextFree;
+		++liveBlocks;
+		return cell->storage;
+	}
+
+	void give(Cell* cell) {
+		cell->nextFree = freeList;
+		freeList = cell;
+		--liveBlocks;
+	}
+
+	// A block freed by a thread other than the owner
+	void giveRemote(Cell* cell) {
+		bool release = false;
+		{
+			std::lock_guard<std::mutex> lock(remoteLock);
+			if (!orphaned) {
+				cell->nextFree = remoteFree;
+				remoteFree = cell;
+				return;
+			}
+			give(cell);
+			release = liveBlocks == 0;
+		}
+		if (release) {
+			delete this; // The last block of an exited thread's pool
+		}
+	}
+
+	// The owning thread is exiting: free the pool now if nothing is out, else leave it to the last block
+	void abandon() {
+		bool release;
+		{
+			std::lock_guard<std::mutex> lock(remoteLock);
+			reclaimRemoteLocked();
+			orphaned = true;
+			release = liveBlocks == 0;
+		}
+		if (release) {
+			delete this;
+		}
+	}
+
+public:
+	NodePool(const NodePool&) = delete;
+	NodePool& operator=(const NodePool&) = delete;
+
+	static void* allocate() {
+		NodePool* pool = currentPool();
+		if (pool == nullptr) {
+			if (threadExiting()) {
+				NodePool& shared = getSharedPool();
+				std::lock_guard<std::mutex> lock(shared.remoteLock);
+				return shared.take();
+			}
+			pool = &getThreadPool();
+		}
+		if (pool->freeList == nullptr) {
+			std::lock_guard<std::mutex> lock(pool->remoteLock);
+			pool->reclaimRemoteLocked();
+		}
+		return pool->take();
+	}
+
+	static void deallocate(void* block) {
+		Cell* cell = static_cast<Cell*>(block);
+		NodePool* owner = slabOf(block)->owner;
+		if (owner == currentPool()) {
+			owner->give(cell);
+		}
+		else {
+			owner->giveRemote(cell);
+		}
+	}
+
+	// Number of slabs the calling thread's pool has requested from the heap so far
+	static int getSlabCount() {
+		return threadExiting() ? 0 : getThreadPool().slabCount;
+	}
+
+	// Number of blocks the calling thread's pool has handed out (blocks freed on other
+	// threads count until the pool reclaims them)
+	static int getLiveBlocks() {
+		return threadExiting() ? 0 : getThreadPool().liveBlocks;
+	}
+};
+
+// Default list allocator: nodes come from the thread's NodePool
+template <class Node>
+struct PoolAllocator {
+	template <class... Args>
+	static Node* create(Args&&... args) {
+		void* block = NodePool<Node>::allocate();
+		return new (block) Node(std::forward<Args>(args)...);
+	}
+
+	static void destroy(Node* node) {
+		node->~Node();
+		NodePool<Node>::deallocate(node);
+	}
+};
+
+// Plain new/delete, for lists that should bypass the pool
+template <class Node>
+struct HeapAllocator {
+	template <class... Args>
+	static Node* create(Args&&... args) {
+		return new Node(std::forward<Args>(args)...);
+	}
+
+	static void destroy(Node* node) {
+		delete node;
+	}
+};
+
+#endif /* NODEPOOL_H */
@@ -0,0 +1,131 @@
+#include "AudioEngine.h"
+
+// Null audio backend for headless builds. Nothing is played, but the music state
+// (current track, combat music) is still tracked so callers see consistent answers.
+
+// Initialize static member
+AudioEngine* AudioEngine::instance = nullptr;
+
+// Constructor
+AudioEngine::AudioEngine()
+	: pDirectSound(nullptr),
+	  pPrimaryBuffer(nullptr),
+	  pMusicBuffer(nullptr),
+	  pMenuSelectBuffer(nullptr),
+	  pMenuNavigateBuffer(nullptr),
+	  pCombatAttackBuffer(nullptr),
+	  pCombatHitBuffer(nullptr),
+	  pCombatMissBuffer(nullptr),
+	  pLootPickupBuffer(nullptr),
+	  pZombieDeathBuffer(nullptr),
+	  pEnvironmentalHazardBuffer(nullptr),
+	  pLevelUpBuffer(nullptr),
+	  pSkillUnlockBuffer(nullptr),
+	  pSaveGameBuffer(nullptr),
+	  isMusicPlaying(false),
+	  usingMCI(false),
+	  inCombatMusic(false) {
+}
+
+// Destructor
+AudioEngine::~AudioEngine() {
+}
+
+// Get singleton instance
+AudioEngine* AudioEngine::getInstance() {
+	if (instance == nullptr) {
+		instance = new AudioEngine();
+	}
+	return instance;
+}
+
+void AudioEngine::destroyInstance() {
+	if (instance != nullptr) {
+		delete instance;
+		instance = nullptr;
+	}
+}
+
+// ============================================================================
+// MUSIC
+// ============================================================================
+
+bool AudioEngine::playBackgroundMusic(const std::string& musicFilePath) {
+	isMusicPlaying = true;
+	currentMusicTrack = musicFilePath;
+	return true;
+}
+
+bool AudioEngine::stopBackgroundMusic() {
+	isMusicPlaying = false;
+	currentMusicTrack = "";
+	return true;
+}
+
+bool AudioEngine::pauseBackgroundMusic() {
+	return isMusicPlaying;
+}
+
+bool AudioEngine::resumeBackgroundMusic() {
+	return isMusicPlaying;
+}
+
+bool AudioEngine::setMusicVolume(int /*volume*/) {
+	return isMusicPlaying;
+}
+
+bool AudioEngine::isPlayingMusic() const {
+	return isMusicPlaying;
+}
+
+bool AudioEngine::playLocationMusic(Symbol locationID) {
+	if (inCombatMusic) {
+		pausedMusicTrack = locationID.str();
+		return true;
+	}
+	return playBackgroundMusic(locationID.str());
+}
+
+bool AudioEngine::stopAllMusic() {
+	inCombatMusic = false;
+	pausedMusicTrack = "";
+	return stopBackgroundMusic();
+}
+
+bool AudioEngine::playCombatMusic() {
+	if (inCombatMusic) {
+		return true;
+	}
+	pausedMusicTrack = currentMusicTrack;
+	inCombatMusic = true;
+	return playBackgroundMusic("combat");
+}
+
+bool AudioEngine::stopCombatMusic() {
+	if (!inCombatMusic) {
+		return true;
+	}
+	inCombatMusic = false;
+	if (pausedMusicTrack.empty()) {
+		return stopBackgroundMusic();
+	}
+	bool resumed = playBackgroundMusic(pausedMusicTrack);
+	pausedMusicTrack = "";
+	return resumed;
+}
+
+// ============================================================================
+// SOUND EFFECTS
+// ============================================================================
+
+void AudioEngine::playMenuSelectSound() {}
+void AudioEngine::playMenuNavigateSound() {}
+void AudioEngine::playCombatAttackSound() {}
+void AudioEngine::playCombatHitSound() {}
+void AudioEngine::playCombatMissSound() {}
+void AudioEngine::playLootPickupSound() {}
+void AudioEngine::playZombieDeathSound() {}
+void AudioEngine::playEnvironmentalHazardSound() {}
+void AudioEngine::playLevelUpSound() {}
+void AudioEngine::playSkillUnlockSound() {}
+void AudioEngine::playSaveGameSound() {}
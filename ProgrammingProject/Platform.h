@@ -0,0 +1,54 @@
+#ifndef PLATFORM_H
+#define PLATFORM_H
+#include <cstddef>
+#include <string>
+
+// Host services the game needs: terminal, keyboard, clock and files.
+// Exactly one backend is linked in: PlatformWin32.cpp for the Windows console build,
+// PlatformHeadless.cpp for the portable core (no terminal control, no key polling, no pacing).
+class Platform {
+public:
+	enum class Key {
+		UP,
+		DOWN,
+		ENTER
+	};
+
+	// Terminal
+	static void clearScreen();
+	static bool configureConsole(int width, int height); // False if there is no console to size
+	static void setCursorPosition(int column, int row);
+
+	// Input
+	static bool supportsKeyPolling(); // False when input only arrives as lines on stdin
+	static bool isKeyDown(Key key);
+
+	// Clock
+	static void sleepFor(int milliseconds); // Presentation delay; headless backends skip it
+	static long long getMilliseconds(); // Monotonic time since an arbitrary start point
+
+	// Files
+	static const char* mapFile(const std::string& path, std::size_t& size); // Read-only view of a whole file, nullptr on failure
+	static void unmapFile(const char* data, std::size_t size);
+
+	// Write a whole file crash-safely: the data goes to path + ".tmp", is flushed to disk and then
+	// renamed over path, so path holds either the old or the new contents, never a torn mix.
+	// Not durable skips both flushes, for caches rebuilt when damaged: the rename still keeps other
+	// processes from seeing a torn file, but a power cut may leave it empty.
+	static bool replaceFile(const std::string& path, const char* data, std::size_t size, bool durable = true);
+
+	// Append to an existing file and flush it to disk before returning; false if path does not exist
+	static bool appendFile(const std::string& path, const char* data, std::size_t size);
+
+	// Create one directory (its parent must exist); true if it exists afterwards
+	static bool createDirectory(const std::string& path);
+
+	// Create a new, empty directory under the system's temporary directory for scratch files;
+	// its path ending in '/', or "" on failure
+	static std::string createTemporaryDirectory();
+
+	// Delete a directory and everything below it; true if it is gone afterwards
+	static bool removeDirectoryTree(const std::string& path);
+};
+
+#endif /* PLATFORM_H */
@@ -0,0 +1,155 @@
+#include "Platform.h"
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fcntl.h>
+#include <ftw.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Headless backend: output is a plain stream (logs, pipes, profilers), input is line-based
+// stdin, and presentation delays are skipped so simulations run at full speed.
+
+// ============================================================================
+// TERMINAL
+// ============================================================================
+
+void Platform::clearScreen() {
+}
+
+bool Platform::configureConsole(int /*width*/, int /*height*/) {
+	return false;
+}
+
+void Platform::setCursorPosition(int /*column*/, int /*row*/) {
+}
+
+// ============================================================================
+// INPUT
+// ============================================================================
+
+bool Platform::supportsKeyPolling() {
+	return false;
+}
+
+bool Platform::isKeyDown(Key /*key*/) {
+	return false;
+}
+
+// ============================================================================
+// CLOCK
+// ============================================================================
+
+void Platform::sleepFor(int /*milliseconds*/) {
+}
+
+long long Platform::getMilliseconds() {
+	return std::chrono::duration_cast<std::chrono::milliseconds>(
+		std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// ============================================================================
+// FILES
+// ============================================================================
+
+const char* Platform::mapFile(const std::string& path, std::size_t& size) {
+	int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+	if (fd < 0) {
+		return nullptr;
+	}
+
+	struct stat info;
+	void* data = MAP_FAILED;
+	if (fstat(fd, &info) == 0 && info.st_size > 0) {
+		size = static_cast<std::size_t>(info.st_size);
+		data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+	}
+	close(fd); // The mapping keeps the file open
+	return data == MAP_FAILED ? nullptr : static_cast<const char*>(data);
+}
+
+void Platform::unmapFile(const char* data, std::size_t size) {
+	munmap(const_cast<char*>(data), size);
+}
+
+namespace {
+
+bool writeAll(int fd, const char* data, std::size_t size) {
+	while (size > 0) {
+		ssize_t count = write(fd, data, size);
+		if (count < 0 && errno == EINTR) continue;
+		if (count <= 0) return false;
+		data += count;
+		size -= static_cast<std::size_t>(count);
+	}
+	return true;
+}
+
+}
+
+bool Platform::replaceFile(const std::string& path, const char* data, std::size_t size, bool durable) {
+	std::string temporary = path + ".tmp";
+	int fd = open(temporary.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+	if (fd < 0) {
+		return false;
+	}
+
+	bool written = writeAll(fd, data, size) && (!durable || fsync(fd) == 0);
+	written = close(fd) == 0 && written;
+	if (!written || std::rename(temporary.c_str(), path.c_str()) != 0) {
+		unlink(temporary.c_str());
+		return false;
+	}
+	if (!durable) {
+		return true;
+	}
+
+	// The rename itself is only durable once the directory is
+	std::string::size_type slash = path.find_last_of('/');
+	std::string directory = slash == std::string::npos ? "." : slash == 0 ? "/" : path.substr(0, slash);
+	int directoryFd = open(directory.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+	if (directoryFd >= 0) {
+		fsync(directoryFd);
+		close(directoryFd);
+	}
+	return true;
+}
+
+bool Platform::appendFile(const std::string& path, const char* data, std::size_t size) {
+	int fd = open(path.c_str(), O_WRONLY | O_APPEND | O_CLOEXEC);
+	if (fd < 0) {
+		return false;
+	}
+	bool written = writeAll(fd, data, size) && fdatasync(fd) == 0;
+	return close(fd) == 0 && written;
+}
+
+bool Platform::createDirectory(const std::string& path) {
+	struct stat info;
+	return mkdir(path.c_str(), 0755) == 0 || (errno == EEXIST && stat(path.c_str(), &info) == 0 && S_ISDIR(info.st_mode));
+}
+
+std::string Platform::createTemporaryDirectory() {
+	const char* base = std::getenv("TMPDIR");
+	std::string pattern = std::string(base != nullptr && *base != '\0' ? base : "/tmp") + "/outbreak-XXXXXX";
+	if (mkdtemp(&pattern[0]) == nullptr) {
+		return std::string();
+	}
+	return pattern + "/";
+}
+
+namespace {
+
+int removeEntry(const char* path, const struct stat* /*info*/, int /*type*/, struct FTW* /*position*/) {
+	return std::remove(path) == 0 ? 0 : -1;
+}
+
+}
+
+bool Platform::removeDirectoryTree(const std::string& path) {
+	struct stat info;
+	// Depth first, so each directory is empty by the time it is removed; links are not followed
+	return nftw(path.c_str(), removeEntry, 16, FTW_DEPTH | FTW_PHYS) == 0 || stat(path.c_str(), &info) != 0;
+}
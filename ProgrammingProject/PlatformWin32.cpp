@@ -0,0 +1,207 @@
+#define NOMINMAX
+#include "Platform.h"
+#include <windows.h>
+#include <cstdlib>
+#include <thread>
+#include <chrono>
+
+// ============================================================================
+// TERMINAL
+// ============================================================================
+
+void Platform::clearScreen() {
+	system("cls");
+}
+
+bool Platform::configureConsole(int width, int height) {
+	HANDLE handle = GetStdHandle(STD_OUTPUT_HANDLE);
+	HWND consoleWindow = GetConsoleWindow();
+
+	if (consoleWindow == NULL || handle == INVALID_HANDLE_VALUE)
+		return false;
+
+	// Set buffer size
+	COORD bufferSize = { (SHORT)width, (SHORT)height };
+	SetConsoleScreenBufferSize(handle, bufferSize);
+
+	// Set window size (matching buffer)
+	SMALL_RECT windowSize = { 0, 0, (SHORT)(width - 1), (SHORT)(height - 1) };
+	SetConsoleWindowInfo(handle, TRUE, &windowSize);
+	return true;
+}
+
+void Platform::setCursorPosition(int column, int row) {
+	COORD position = { (SHORT)column, (SHORT)row };
+	SetConsoleCursorPosition(GetStdHandle(STD_OUTPUT_HANDLE), position);
+}
+
+// ============================================================================
+// INPUT
+// ============================================================================
+
+bool Platform::supportsKeyPolling() {
+	return true;
+}
+
+bool Platform::isKeyDown(Key key) {
+	int virtualKey = VK_RETURN;
+	switch (key) {
+	case Key::UP:
+		virtualKey = VK_UP;
+		break;
+	case Key::DOWN:
+		virtualKey = VK_DOWN;
+		break;
+	case Key::ENTER:
+		virtualKey = VK_RETURN;
+		break;
+	}
+	return (GetAsyncKeyState(virtualKey) & 0x8000) != 0;
+}
+
+// ============================================================================
+// CLOCK
+// ============================================================================
+
+void Platform::sleepFor(int milliseconds) {
+	std::this_thread::sleep_for(std::chrono::milliseconds(milliseconds));
+}
+
+long long Platform::getMilliseconds() {
+	return std::chrono::duration_cast<std::chrono::milliseconds>(
+		std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// ============================================================================
+// FILES
+// ============================================================================
+
+const char* Platform::mapFile(const std::string& path, std::size_t& size) {
+	HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (file == INVALID_HANDLE_VALUE) {
+		return nullptr;
+	}
+
+	const char* data = nullptr;
+	LARGE_INTEGER fileSize;
+	if (GetFileSizeEx(file, &fileSize) && fileSize.QuadPart > 0) {
+		HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+		if (mapping != NULL) {
+			data = static_cast<const char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+			size = static_cast<std::size_t>(fileSize.QuadPart);
+			CloseHandle(mapping); // The view keeps the mapping alive
+		}
+	}
+	CloseHandle(file);
+	return data;
+}
+
+void Platform::unmapFile(const char* data, std::size_t size) {
+	UnmapViewOfFile(data);
+}
+
+bool Platform::replaceFile(const std::string& path, const char* data, std::size_t size, bool durable) {
+	std::string temporary = path + ".tmp";
+	HANDLE file = CreateFileA(temporary.c_str(), GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (file == INVALID_HANDLE_VALUE) {
+		return false;
+	}
+
+	bool written = true;
+	while (size > 0 && written) {
+		DWORD chunk = size > 0x40000000 ? 0x40000000 : static_cast<DWORD>(size);
+		DWORD count = 0;
+		written = WriteFile(file, data, chunk, &count, NULL) && count > 0;
+		data += count;
+		size -= count;
+	}
+	written = written && (!durable || FlushFileBuffers(file));
+	CloseHandle(file);
+
+	// Write-through: the rename is on disk before this returns
+	DWORD flags = MOVEFILE_REPLACE_EXISTING | (durable ? MOVEFILE_WRITE_THROUGH : 0);
+	if (!written || !MoveFileExA(temporary.c_str(), path.c_str(), flags)) {
+		DeleteFileA(temporary.c_str());
+		return false;
+	}
+	return true;
+}
+
+bool Platform::appendFile(const std::string& path, const char* data, std::size_t size) {
+	HANDLE file = CreateFileA(path.c_str(), FILE_APPEND_DATA, 0, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (file == INVALID_HANDLE_VALUE) {
+		return false;
+	}
+
+	bool written = true;
+	while (size > 0 && written) {
+		DWORD chunk = size > 0x40000000 ? 0x40000000 : static_cast<DWORD>(size);
+		DWORD count = 0;
+		written = WriteFile(file, data, chunk, &count, NULL) && count > 0;
+		data += count;
+		size -= count;
+	}
+	written = written && FlushFileBuffers(file);
+	CloseHandle(file);
+	return written;
+}
+
+bool Platform::createDirectory(const std::string& path) {
+	if (CreateDirectoryA(path.c_str(), NULL)) {
+		return true;
+	}
+	DWORD attributes = GetFileAttributesA(path.c_str());
+	return attributes != INVALID_FILE_ATTRIBUTES && (attributes & FILE_ATTRIBUTE_DIRECTORY) != 0;
+}
+
+std::string Platform::createTemporaryDirectory() {
+	char base[MAX_PATH + 1];
+	DWORD length = GetTempPathA(sizeof(base), base);
+	if (length == 0 || length > MAX_PATH) {
+		return std::string();
+	}
+
+	// CreateDirectory fails on an existing name, so the first name it accepts is ours alone
+	for (unsigned int attempt = 0; attempt < 100; ++attempt) {
+		std::string path = std::string(base) + "outbreak-" + std::to_string(GetCurrentProcessId()) + "-"
+			+ std::to_string(GetTickCount() + attempt);
+		if (CreateDirectoryA(path.c_str(), NULL)) {
+			return path + "/"; // Windows takes either separator; the rest of the game uses this one
+		}
+		if (GetLastError() != ERROR_ALREADY_EXISTS) {
+			break;
+		}
+	}
+	return std::string();
+}
+
+bool Platform::removeDirectoryTree(const std::string& path) {
+	std::string directory = path;
+	while (!directory.empty() && (directory.back() == '\\' || directory.back() == '/')) {
+		directory.pop_back();
+	}
+
+	WIN32_FIND_DATAA entry;
+	HANDLE search = FindFirstFileA((directory + "\\*").c_str(), &entry);
+	if (search != INVALID_HANDLE_VALUE) {
+		do {
+			std::string name = entry.cFileName;
+			if (name == "." || name == "..") {
+				continue;
+			}
+			std::string child = directory + "\\" + name;
+			if ((entry.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0 && (entry.dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT) == 0) {
+				removeDirectoryTree(child);
+			}
+			else if ((entry.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0) {
+				RemoveDirectoryA(child.c_str()); // A junction: drop the link, not what it points to
+			}
+			else {
+				DeleteFileA(child.c_str());
+			}
+		} while (FindNextFileA(search, &entry));
+		FindClose(search);
+	}
+
+	return RemoveDirectoryA(directory.c_str()) || GetFileAttributesA(directory.c_str()) == INVALID_FILE_ATTRIBUTES;
+}
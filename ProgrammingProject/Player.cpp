@@ -1,7 +1,7 @@
 #include "Player.h"
 
 // Constructor
-Player::Player() : Entity(), fLevel(1), fDamage(15), fHealth(100), fMaxHealth(100),
+Player::Player() : Entity(), fPlayerName(""), fLevel(1), fDamage(15), fHealth(100), fMaxHealth(100),
 fHunger(100), fMaxHunger(100), fExperience(0), fExperienceToNextLevel(100), fSkillPoints(0),
 fMaxInventorySpace(20), fCurrentInventorySpace(0), fEquippedWeapon("Knife"), fSkillTree(0),
 fBaseDamage(15), fBaseMaxHealth(100) {
@@ -10,13 +10,17 @@ fBaseDamage(15), fBaseMaxHealth(100) {
 
 // Parameterised constructor
 Player::Player(const std::string& aID, const std::string aName, int aLevel, int aDamage, int aHealth, int aMaxHealth)
-	: Entity(aName), fLevel(aLevel), fDamage(aDamage), fHealth(aHealth), fMaxHealth(aMaxHealth),
+	: Entity(), fPlayerName(aName), fLevel(aLevel), fDamage(aDamage), fHealth(aHealth), fMaxHealth(aMaxHealth),
 	fHunger(100), fMaxHunger(100), fExperience(0), fExperienceToNextLevel(100 * aLevel), fSkillPoints(0),
 	fMaxInventorySpace(20), fCurrentInventorySpace(0), fEquippedWeapon("Knife"), fSkillTree(0),
 	fBaseDamage(aDamage), fBaseMaxHealth(aMaxHealth) {
 	fSkillTree.initialiseDefaultTree();
 }
 
+const std::string& Player::getName() const {
+	return fPlayerName;
+}
+
 // Add item to inventory
 void Player::addItem(const Item& aItem) {
 	if (fCurrentInventorySpace + aItem.getInventorySpace() <= fMaxInventorySpace) {
@@ -25,10 +29,22 @@ void Player::addItem(const Item& aItem) {
 	}
 }
 
+void Player::addItem(Item&& aItem) {
+	int itemSpace = aItem.getInventorySpace();
+	if (fCurrentInventorySpace + itemSpace <= fMaxInventorySpace) {
+		fInventory.pushBack(std::move(aItem));
+		fCurrentInventorySpace += itemSpace;
+	}
+}
+
 // Remove item from inventory
 void Player::removeItem(const Item& aItem) {
-	fInventory.remove(aItem);
-	fCurrentInventorySpace -= aItem.getInventorySpace();
+	// Read the size first, aItem may refer to the node being removed
+	int itemSpace = aItem.getInventorySpace();
+	if (!fInventory.remove(aItem)) {
+		return;
+	}
+	fCurrentInventorySpace -= itemSpace;
 	if (fCurrentInventorySpace < 0) {
 		fCurrentInventorySpace = 0;
 	}
@@ -113,6 +129,14 @@ void Player::setHealth(int aHealth) {
 	}
 }
 
+// Setter for max health
+void Player::setMaxHealth(int aMaxHealth) {
+	fMaxHealth = aMaxHealth < 1 ? 1 : aMaxHealth;
+	if (fHealth > fMaxHealth) {
+		fHealth = fMaxHealth;
+	}
+}
+
 // Setter for damage
 void Player::setDamage(int aDamage) {
 	fDamage = aDamage;
@@ -200,7 +224,7 @@ void Player::takeDamage(int aDamage) {
 
 // Display player information
 void Player::displayInformation() {
-	std::cout << "Player: " << fName << "\n";
+	std::cout << "Player: " << fPlayerName << "\n";
 	std::cout << "Level: " << fLevel << "\n";
 	std::cout << "Health: " << fHealth << "/" << fMaxHealth << "\n";
 	std::cout << "Damage: " << fDamage << "\n";
@@ -7,6 +7,7 @@
 
 class Player : public Entity {
 private:
+	std::string fPlayerName; // Typed by the player, so kept as text rather than interned (see Symbol)
 	int fLevel;
 	int fDamage;
 	int fHealth;
@@ -33,8 +34,11 @@ public:
 	// Parameterised constructor
 	Player(const std::string& aID, const std::string aName, int aLevel, int aDamage, int aHealth, int aMaxHealth);
 
+	const std::string& getName() const override;
+
 	// Inventory management methods
 	void addItem(const Item& aItem);
+	void addItem(Item&& aItem);
 	void removeItem(const Item& aItem);
 	SinglyLinkedList<Item>& getInventory();
 	int getInventorySize() const;
@@ -69,6 +73,7 @@ public:
 
 	// Setter methods
 	void setHealth(int aHealth);
+	void setMaxHealth(int aMaxHealth); // Until skill bonuses are next applied
 	void setDamage(int aDamage);
 	void setHunger(int aHunger);
 	void setEquippedWeapon(const std::string& weaponName);
@@ -0,0 +1,162 @@
+#include "PlaythroughSimulator.h"
+#include "ClueJournal.h"
+#include "ExplorationRules.h"
+#include "GameEngine.h"
+#include "Location.h"
+#include "Player.h"
+#include <string>
+
+namespace {
+
+// The scripted survivor sweeps the compass, one direction per step
+const Direction EXPLORE_ORDER[4] = { Direction::UP, Direction::RIGHT, Direction::DOWN, Direction::LEFT };
+
+}
+
+// ============================================================================
+// REPORT
+// ============================================================================
+
+// Constructor
+PlaythroughSimulator::Report::Report(int aLocationCount)
+	: playthroughs(0), unfinished(0), deathsByLocation(aLocationCount, 0) {
+	for (int i = 0; i < ENDING_COUNT; ++i) {
+		endings[i] = 0;
+	}
+}
+
+void PlaythroughSimulator::Report::merge(const Report& aOther) {
+	playthroughs += aOther.playthroughs;
+	unfinished += aOther.unfinished;
+	for (int i = 0; i < ENDING_COUNT; ++i) {
+		endings[i] += aOther.endings[i];
+	}
+	if (aOther.deathsByLocation.size() > deathsByLocation.size()) {
+		deathsByLocation.resize(aOther.deathsByLocation.size(), 0);
+	}
+	for (size_t i = 0; i < aOther.deathsByLocation.size(); ++i) {
+		deathsByLocation[i] += aOther.deathsByLocation[i];
+	}
+	cluesCollected.merge(aOther.cluesCollected);
+	steps.merge(aOther.steps);
+	combat.merge(aOther.combat);
+}
+
+// ============================================================================
+// SIMULATOR
+// ============================================================================
+
+// Constructor
+PlaythroughSimulator::PlaythroughSimulator(const ContentPack& aContent, const Policy& aPolicy)
+	: fContent(aContent), fPolicy(aPolicy) {
+}
+
+int PlaythroughSimulator::getLocationCount() const {
+	return fContent.getLocationCount();
+}
+
+PlaythroughSimulator::Result PlaythroughSimulator::play(GameSession& aSession, std::uint64_t aSeed, Report& aReport) const {
+	Result result = {};
+	result.ending = EndingSystem::BAD_ENDING;
+	result.deathLocation = -1;
+
+	CombatSimulator::ScriptedPlayer survivor(aReport.combat, fPolicy.fleeBelowPercent);
+	Player* player = aSession.startScriptedGame(aSeed, survivor);
+	GameplayEngine& gameplay = aSession.getGameplayEngine();
+	ClueJournal* journal = aSession.getGameEngine().getJournal();
+
+	while (gameplay.getCurrentLocation() != nullptr && player->getHealth() > 0 && !result.finished
+		&& result.steps < fPolicy.maxSteps) {
+		upkeep(gameplay, *player);
+
+		if (!gameplay.canTravelToNewLocation()) {
+			result.steps++;
+			gameplay.moveInDirection(EXPLORE_ORDER[gameplay.getMovementSteps() % 4]);
+			continue;
+		}
+
+		Location* destination = chooseDestination(aSession);
+		if (destination == nullptr) {
+			break; // Dead end, counted as unfinished
+		}
+
+		// Arriving at the sanctuary starts the final fight, whichever way it goes the game ends
+		bool bossFight = ExplorationRules::isBossLocation(destination->getID());
+		gameplay.travelToLocation(destination->getID());
+		if (bossFight && player->getHealth() > 0) {
+			result.ending = EndingSystem::determineEnding(false, true, player, journal);
+			result.finished = true;
+		}
+	}
+
+	if (player->getHealth() <= 0) {
+		result.ending = EndingSystem::determineEnding(true, false, player, journal);
+		result.finished = true;
+		result.deathLocation = fContent.findLocation(gameplay.getCurrentLocation()->getID());
+	}
+	result.cluesCollected = journal->getTotalCollected();
+	result.fights = survivor.getFightCount();
+
+	// The session keeps pointing at the game, but the player is ours
+	gameplay.setAutopilot(nullptr);
+	gameplay.initialize(nullptr, nullptr, nullptr);
+	delete player;
+
+	aReport.playthroughs++;
+	if (result.finished) {
+		aReport.endings[result.ending]++;
+	}
+	else {
+		aReport.unfinished++;
+	}
+	if (result.deathLocation >= 0) {
+		aReport.deathsByLocation[result.deathLocation]++;
+	}
+	aReport.cluesCollected.record(result.cluesCollected);
+	aReport.steps.record(result.steps);
+	return result;
+}
+
+// Free actions between steps: eat when hungry, rest while hurt
+void PlaythroughSimulator::upkeep(GameplayEngine& aGameplay, Player& aPlayer) const {
+	if (aPlayer.getHunger() <= fPolicy.eatAtHunger) {
+		SinglyLinkedList<Item>& inventory = aPlayer.getInventory();
+		for (auto it = inventory.begin(); it != inventory.end(); ++it) {
+			const Item& item = *it;
+			if (item.getCategory() == Item::Category::FOOD && item.isConsumable() && item.isUsable()) {
+				aGameplay.useItem(item);
+				break;
+			}
+		}
+	}
+
+	if (fPolicy.restBelowPercent > 0) {
+		while (aPlayer.getHealth() * 100 < aPlayer.getMaxHealth() * fPolicy.restBelowPercent) {
+			aGameplay.rest();
+		}
+	}
+}
+
+// The first unvisited connection, otherwise a random one; nullptr if there is nowhere to go
+Location* PlaythroughSimulator::chooseDestination(GameSession& aSession) const {
+	GameEngine& engine = aSession.getGameEngine();
+	GameplayEngine& gameplay = aSession.getGameplayEngine();
+	SinglyLinkedList<Symbol>& connections = gameplay.getCurrentLocation()->getConnections();
+	if (connections.isEmpty()) {
+		return nullptr;
+	}
+
+	for (Symbol connection : connections) {
+		Location* location = engine.getLocationByID(connection.str());
+		if (location != nullptr && !location->isVisited()) {
+			return location;
+		}
+	}
+
+	int pick = gameplay.getRandomStreams().events().nextInt(connections.size());
+	auto it = connections.begin();
+	for (int i = 0; i < pick; ++i) {
+		++it;
+	}
+	return engine.getLocationByID(it->str());
+}
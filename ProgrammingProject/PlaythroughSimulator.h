@@ -0,0 +1,75 @@
+#ifndef PLAYTHROUGHSIMULATOR_H
+#define PLAYTHROUGHSIMULATOR_H
+#include "CombatSimulator.h"
+#include "ContentPack.h"
+#include "EndingSystem.h"
+#include "GameSession.h"
+#include "GameplayEngine.h"
+#include "Random.h"
+#include <cstdint>
+#include <vector>
+
+// Headless full playthroughs for balance sweeps.
+// A scripted survivor plays a new game on a GameSession: it explores with moveInDirection, eats and
+// rests between steps, and travels on once an area is explored (preferring unvisited locations),
+// until the sanctuary boss fight or death. Every rule is the engine's, drawn from the session's
+// random streams and storyteller; CombatSimulator::ScriptedPlayer answers the engine's prompts.
+// The simulator itself holds nothing a playthrough changes, so threads can share it as long as
+// each plays on a session of its own.
+class PlaythroughSimulator {
+public:
+	static const int ENDING_COUNT = EndingSystem::TRUE_ENDING + 1;
+
+	// How the scripted survivor behaves between steps
+	struct Policy {
+		int restBelowPercent; // Rest while HP is below this share of max (0 never rests)
+		int eatAtHunger; // Eat food at or below this hunger
+		int fleeBelowPercent; // Try to flee regular fights below this share of max HP (0 never flees)
+		int maxSteps; // A playthrough still going after this many steps is abandoned
+
+		Policy() : restBelowPercent(50), eatAtHunger(30), fleeBelowPercent(40), maxSteps(2000) {}
+	};
+
+	struct Result {
+		bool finished; // Reached an ending before maxSteps
+		EndingSystem::EndingType ending;
+		int cluesCollected;
+		int deathLocation; // Location index, -1 if the survivor lived
+		int steps;
+		int fights;
+	};
+
+	struct Report {
+		std::int64_t playthroughs;
+		std::int64_t unfinished;
+		std::int64_t endings[ENDING_COUNT];
+		std::vector<std::int64_t> deathsByLocation; // Indexed like the content pack's locations
+		CombatSimulator::Histogram cluesCollected;
+		CombatSimulator::Histogram steps;
+		CombatSimulator::Report combat; // Every fight of every playthrough
+
+		// Constructor
+		explicit Report(int aLocationCount = 0);
+
+		void merge(const Report& aOther);
+	};
+
+private:
+	const ContentPack& fContent;
+	Policy fPolicy;
+
+	void upkeep(GameplayEngine& aGameplay, Player& aPlayer) const;
+	Location* chooseDestination(GameSession& aSession) const;
+
+public:
+	// Constructor
+	PlaythroughSimulator(const ContentPack& aContent, const Policy& aPolicy = Policy());
+
+	// One playthrough of a new game seeded with aSeed, accumulated into aReport. aSession must be
+	// built on this simulator's content pack; it is left holding the finished game.
+	Result play(GameSession& aSession, std::uint64_t aSeed, Report& aReport) const;
+
+	int getLocationCount() const;
+};
+
+#endif /* PLAYTHROUGHSIMULATOR_H */
@@ -0,0 +1,160 @@
+#include "GameEngine.h"
+#include "Item.h"
+#include "NodePool.h"
+#include "Player.h"
+#include "SinglyLinkedList.h"
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <string>
+
+// Heap allocations per combat round, with list nodes from the pool and from new/delete.
+// A round makes the list traffic a wave fight does: the player uses a consumable (it
+// leaves the inventory) and picks up loot from the ground (it joins the inventory),
+// and the location's ground list is topped up so every round looks the same.
+
+namespace {
+
+long long gAllocations = 0;
+
+void* countedAllocate(std::size_t aSize) {
+	++gAllocations;
+	void* memory = std::malloc(aSize != 0 ? aSize : 1);
+	if (memory == nullptr) {
+		throw std::bad_alloc();
+	}
+	return memory;
+}
+
+void* countedAllocate(std::size_t aSize, std::align_val_t aAlignment) {
+	++gAllocations;
+	std::size_t alignment = static_cast<std::size_t>(aAlignment);
+	void* memory = std::aligned_alloc(alignment, (aSize + alignment - 1) / alignment * alignment);
+	if (memory == nullptr) {
+		throw std::bad_alloc();
+	}
+	return memory;
+}
+
+struct Result {
+	double allocationsPerRound;
+	double nanosecondsPerRound;
+};
+
+template <template <class> class Allocator>
+Result runRounds(long long aRounds, const SinglyLinkedList<Item>& aKit) {
+	SinglyLinkedList<Item, Allocator> inventory;
+	SinglyLinkedList<Item, Allocator> ground;
+	for (auto it = aKit.begin(); it != aKit.end(); ++it) {
+		inventory.pushBack(*it);
+		ground.pushBack(*it);
+	}
+
+	long long allocationsBefore = gAllocations;
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	for (long long round = 0; round < aRounds; ++round) {
+		// Use the first consumable, then pick the same kind up off the ground
+		Item used = std::move(*inventory.begin());
+		inventory.popFront();
+		ground.pushBack(std::move(used));
+		Item looted = std::move(*ground.begin());
+		ground.popFront();
+		inventory.pushBack(std::move(looted));
+	}
+	std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+
+	Result result;
+	result.allocationsPerRound = static_cast<double>(gAllocations - allocationsBefore) / aRounds;
+	result.nanosecondsPerRound = elapsed.count() / aRounds;
+	return result;
+}
+
+void printUsage() {
+	std::cerr << "Usage: pool_bench [options]\n"
+		<< "  --rounds N   Combat rounds to run (default 1000000)\n";
+}
+
+} // namespace
+
+void* operator new(std::size_t aSize) {
+	return countedAllocate(aSize);
+}
+
+void* operator new[](std::size_t aSize) {
+	return countedAllocate(aSize);
+}
+
+void* operator new(std::size_t aSize, std::align_val_t aAlignment) {
+	return countedAllocate(aSize, aAlignment);
+}
+
+void operator delete(void* aMemory) noexcept {
+	std::free(aMemory);
+}
+
+void operator delete[](void* aMemory) noexcept {
+	std::free(aMemory);
+}
+
+void operator delete(void* aMemory, std::size_t) noexcept {
+	std::free(aMemory);
+}
+
+void operator delete[](void* aMemory, std::size_t) noexcept {
+	std::free(aMemory);
+}
+
+void operator delete(void* aMemory, std::align_val_t) noexcept {
+	std::free(aMemory);
+}
+
+void operator delete(void* aMemory, std::size_t, std::align_val_t) noexcept {
+	std::free(aMemory);
+}
+
+int main(int argc, char* argv[]) {
+	long long rounds = 1000000;
+	for (int i = 1; i < argc; ++i) {
+		std::string option = argv[i];
+		if (option == "--help" || option == "-h") {
+			printUsage();
+			return 0;
+		}
+		char* end = nullptr;
+		if (option == "--rounds" && i + 1 < argc) {
+			rounds = std::strtoll(argv[++i], &end, 10);
+			if (end != argv[i] && *end == '\0' && rounds > 0) {
+				continue;
+			}
+		}
+		std::cerr << "Invalid option: " << option << "\n";
+		printUsage();
+		return 1;
+	}
+
+	// The starting kit a new game hands out
+	Player* player = GameEngine::createStartingPlayer("bench");
+	const SinglyLinkedList<Item>& kit = player->getInventory();
+
+	// Once each untimed first, so the pool's slabs are in place as they would be mid-game
+	runRounds<HeapAllocator>(1, kit);
+	runRounds<PoolAllocator>(1, kit);
+	int slabsBefore = NodePool<SinglyLinkedNode<Item> >::getSlabCount();
+
+	Result heap = runRounds<HeapAllocator>(rounds, kit);
+	Result pooled = runRounds<PoolAllocator>(rounds, kit);
+	int slabsAfter = NodePool<SinglyLinkedNode<Item> >::getSlabCount();
+
+	std::cout << rounds << " combat rounds, " << kit.size() << " items in play\n";
+	std::cout << std::fixed << std::setprecision(2);
+	std::cout << "  new/delete nodes: " << std::setw(6) << heap.allocationsPerRound << " heap allocations/round, "
+		<< std::setprecision(1) << heap.nanosecondsPerRound << " ns/round\n";
+	std::cout << std::setprecision(2);
+	std::cout << "  pooled nodes:     " << std::setw(6) << pooled.allocationsPerRound << " heap allocations/round, "
+		<< std::setprecision(1) << pooled.nanosecondsPerRound << " ns/round\n";
+	std::cout << "  (pool slabs added while timing: " << slabsAfter - slabsBefore << ")\n";
+	delete player;
+	return 0;
+}
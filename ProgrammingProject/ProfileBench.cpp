@@ -0,0 +1,187 @@
+#include "Platform.h"
+#include "ProfileStore.h"
+#include "Random.h"
+#include "SaveData.h"
+#include "SaveFile.h"
+#include "SaveIndex.h"
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+// A profile store filled with many players, each saving once and loading back: a save is what
+// GameEngine writes for a profile's first save (its directory, the slot snapshot and the slot
+// index), a load finds the profile by its ID, lists its slots from the index and reads the slot.
+// Loads visit the profiles in random order, so nothing is helped by having just been written.
+// A million profiles take a few GB of disk and tens of minutes; everything goes to a scratch
+// directory deleted afterwards.
+
+namespace {
+
+std::string profileId(long long aIndex) {
+	return "player_" + std::to_string(aIndex);
+}
+
+SaveData makeSave(long long aIndex) {
+	SaveData data;
+	data.player.name = "Survivor " + std::to_string(aIndex);
+	data.player.id = "player";
+	data.player.level = 1 + static_cast<int>(aIndex % 20);
+	data.player.damage = 10;
+	data.player.health = 100;
+	data.player.maxHealth = 125;
+	data.player.hunger = 80;
+	data.player.equippedWeapon = "Knife";
+	data.progress.locationID = "city";
+	data.progress.locationName = "Ruined City";
+	data.progress.chapter = 1 + static_cast<int>(aIndex % 5);
+	data.progress.playtimeSeconds = static_cast<int>(aIndex % 7200);
+	for (int i = 0; i < 6; ++i) {
+		SaveData::ItemRecord item;
+		item.id = "item_" + std::to_string(i);
+		item.name = "Supply " + std::to_string(i);
+		item.quantity = 1 + i % 3;
+		data.inventory.push_back(item);
+	}
+	for (int i = 0; i < 10; ++i) {
+		data.pickedUpLootIDs.push_back("loot_" + std::to_string(i));
+	}
+	return data;
+}
+
+struct Timer {
+	std::chrono::steady_clock::time_point start;
+
+	Timer() : start(std::chrono::steady_clock::now()) {
+	}
+
+	double seconds() const {
+		return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	}
+};
+
+void report(const char* aName, double aSeconds, long long aCount) {
+	std::cout << "  " << std::left << std::setw(28) << aName << std::right << std::fixed << std::setprecision(1)
+		<< std::setw(10) << aSeconds << " s" << std::setprecision(2) << std::setw(10) << aSeconds * 1e6 / aCount << " us"
+		<< std::setprecision(0) << std::setw(10) << aCount / aSeconds << " /s\n";
+}
+
+void printUsage() {
+	std::cerr << "Usage: profile_bench [options]\n"
+		<< "  --profiles N   Players, each saving once and loading once (default 1000000)\n"
+		<< "  --seed N       Seed of the load order (default 1)\n";
+}
+
+bool parseInteger(const char* aText, long long& aValue) {
+	char* end = nullptr;
+	aValue = std::strtoll(aText, &end, 10);
+	return end != aText && *end == '\0';
+}
+
+}
+
+int main(int argc, char* argv[]) {
+	long long profiles = 1000000;
+	long long seed = 1;
+
+	for (int i = 1; i < argc; ++i) {
+		std::string option = argv[i];
+		bool valid = true;
+
+		if (option == "--help" || option == "-h") {
+			printUsage();
+			return 0;
+		}
+		else if (option == "--profiles") {
+			valid = i + 1 < argc && parseInteger(argv[++i], profiles) && profiles > 0;
+		}
+		else if (option == "--seed") {
+			valid = i + 1 < argc && parseInteger(argv[++i], seed);
+		}
+		else {
+			valid = false;
+		}
+
+		if (!valid) {
+			std::cerr << "Invalid option: " << option << "\n";
+			printUsage();
+			return 1;
+		}
+	}
+
+	std::string directory = Platform::createTemporaryDirectory();
+	if (directory.empty()) {
+		std::cerr << "Cannot create a scratch directory\n";
+		return 1;
+	}
+	ProfileStore store(directory + "profiles");
+
+	// Each game claims its profile for as long as it runs; the store holds only those claims
+	long long failures = 0;
+	Timer saveTimer;
+	for (long long i = 0; i < profiles; ++i) {
+		std::string id = ProfileStore::normalizeId(profileId(i));
+		if (!store.claim(id) || !store.prepare(id)) {
+			failures++;
+			continue;
+		}
+		std::string profile = store.getDirectory(id);
+		SaveData data = makeSave(i);
+		std::vector<SaveIndex::Entry> entries(1, SaveIndex::describe(1, data, 0)); // A new profile's index holds just this slot
+		if (!SaveFile::write(profile + "save_slot_1.sav", data) || !SaveIndex::write(profile + "save_index.dat", entries)) {
+			failures++;
+		}
+		store.release(id);
+	}
+	double saveSeconds = saveTimer.seconds();
+
+	Random random(static_cast<std::uint64_t>(seed));
+	std::vector<long long> order(static_cast<std::size_t>(profiles));
+	for (long long i = 0; i < profiles; ++i) {
+		order[static_cast<std::size_t>(i)] = i;
+	}
+	for (std::size_t i = order.size() - 1; i > 0; --i) {
+		std::swap(order[i], order[static_cast<std::size_t>(random.nextInt(static_cast<int>(i + 1)))]);
+	}
+
+	Timer loadTimer;
+	for (long long index : order) {
+		std::string id = ProfileStore::normalizeId(profileId(index));
+		if (!store.claim(id)) {
+			failures++;
+			continue;
+		}
+		std::string profile = store.getDirectory(id);
+		std::vector<SaveIndex::Entry> entries;
+		SaveFile file;
+		SaveData loaded;
+		std::string error;
+		if (!SaveIndex::load(profile + "save_index.dat", entries) || entries.size() != 1
+			|| !file.open(profile + "save_slot_1.sav", error) || !file.read(loaded)
+			|| loaded.player.name != "Survivor " + std::to_string(index)) {
+			failures++;
+		}
+		store.release(id);
+	}
+	double loadSeconds = loadTimer.seconds();
+
+	Timer removeTimer;
+	Platform::removeDirectoryTree(directory);
+	double removeSeconds = removeTimer.seconds();
+
+	if (failures > 0) {
+		std::cerr << failures << " profiles failed to save or load back; no timings\n";
+		return 1;
+	}
+	std::cout << profiles << " profiles, one slot each\n";
+	std::cout << "  " << std::left << std::setw(28) << "operation" << std::right << std::setw(12) << "total"
+		<< std::setw(13) << "per profile" << std::setw(12) << "rate\n";
+	report("create + save", saveSeconds, profiles);
+	report("find + list + load", loadSeconds, profiles);
+	report("delete the store", removeSeconds, profiles);
+	return 0;
+}
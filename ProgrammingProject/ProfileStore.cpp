@@ -0,0 +1,77 @@
+#include "ProfileStore.h"
+#include "Platform.h"
+#include <cstdint>
+
+namespace {
+
+std::uint32_t hashId(const std::string& aId) {
+	std::uint32_t hash = 2166136261u;
+	for (char character : aId) {
+		hash = (hash ^ static_cast<unsigned char>(character)) * 16777619u;
+	}
+	return hash;
+}
+
+std::string toHex(std::uint32_t aByte) {
+	const char* digits = "0123456789abcdef";
+	std::string text;
+	text += digits[(aByte >> 4) & 0xF];
+	text += digits[aByte & 0xF];
+	return text;
+}
+
+}
+
+// Constructor
+ProfileStore::ProfileStore(const std::string& aRoot) : fRoot(aRoot) {
+	if (fRoot.empty()) {
+		fRoot = ".";
+	}
+	if (fRoot.size() > 1 && fRoot.back() == '/') {
+		fRoot.pop_back();
+	}
+}
+
+std::string ProfileStore::normalizeId(const std::string& aId) {
+	if (aId.empty() || aId.size() > MAX_ID_LENGTH) {
+		return std::string();
+	}
+
+	std::string id;
+	for (char character : aId) {
+		if (character >= 'A' && character <= 'Z') {
+			id += static_cast<char>(character - 'A' + 'a');
+		}
+		else if ((character >= 'a' && character <= 'z') || (character >= '0' && character <= '9')
+			|| character == '-' || character == '_') {
+			id += character;
+		}
+		else {
+			return std::string();
+		}
+	}
+	return id;
+}
+
+std::string ProfileStore::getDirectory(const std::string& aId) const {
+	std::uint32_t hash = hashId(aId);
+	return fRoot + "/" + toHex(hash & 0xFF) + "/" + toHex((hash >> 8) & 0xFF) + "/" + aId + "/";
+}
+
+bool ProfileStore::prepare(const std::string& aId) {
+	std::string directory = getDirectory(aId);
+	bool created = Platform::createDirectory(fRoot);
+	for (std::string::size_type slash = directory.find('/', fRoot.size() + 1);
+		created && slash != std::string::npos; slash = directory.find('/', slash + 1)) {
+		created = Platform::createDirectory(directory.substr(0, slash));
+	}
+	return created;
+}
+
+bool ProfileStore::claim(const std::string& aId) {
+	return fClaimed.insert(aId).second;
+}
+
+void ProfileStore::release(const std::string& aId) {
+	fClaimed.erase(aId);
+}
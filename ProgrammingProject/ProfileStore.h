@@ -0,0 +1,48 @@
+#ifndef PROFILESTORE_H
+#define PROFILESTORE_H
+#include <cstddef>
+#include <string>
+#include <unordered_set>
+
+// Save slots for any number of players, each set keyed by a player ID, for hosts with more
+// players than one shared set of ten slots can serve. A profile is not limited to ten slots
+// either: it belongs to one player, who can keep up to MAX_SLOTS saves in it. A profile is a
+// directory holding the usual slot files (snapshots, journals, index), placed by a hash of its ID:
+//   <root>/<h0>/<h1>/<id>/save_slot_N.sav     h0, h1: the low two bytes of FNV-1a(id), in hex
+// Finding a profile is a path computation, never a directory scan, and the 65536 shard
+// directories keep each one small even at millions of profiles. Nothing per profile is held in
+// memory beyond the IDs of games currently using one; each slot's journal compacts as usual.
+// Not thread-safe: claim and release from the thread that runs the games.
+//
+// A player ID is whatever the player types: nothing proves who typed it, so anyone who can reach
+// the host can load, overwrite or delete the saves of any ID they know or guess. Fine for a LAN
+// or trusted players; anything public needs accounts in front of this.
+class ProfileStore {
+private:
+	std::string fRoot;
+	std::unordered_set<std::string> fClaimed;
+
+public:
+	static const std::size_t MAX_ID_LENGTH = 32;
+	static const int MAX_SLOTS = 999; // Bounded so a lost index can be rebuilt by probing slot files
+
+	// Constructor
+	explicit ProfileStore(const std::string& aRoot);
+
+	// aId in lower case, or empty if it is not a usable ID (1 to MAX_ID_LENGTH letters, digits,
+	// '-' or '_'); IDs double as directory names, so nothing else gets through
+	static std::string normalizeId(const std::string& aId);
+
+	// The profile's directory, ending in '/'
+	std::string getDirectory(const std::string& aId) const;
+
+	// Create the profile's directory and the shards above it; false on failure
+	bool prepare(const std::string& aId);
+
+	// One game at a time per profile: a second game saving to the same slots would append its
+	// journal entries on top of changes it never saw. False if the profile is in use.
+	bool claim(const std::string& aId);
+	void release(const std::string& aId);
+};
+
+#endif /* PROFILESTORE_H */
@@ -1,47 +1,169 @@
 #ifndef QUEUE_H
 #define QUEUE_H
-#include "SinglyLinkedList.h"
+#include <cstddef>
+#include <new>
 #include <stdexcept>
+#include <utility>
 
+// FIFO queue over a contiguous circular buffer.
+// The buffer starts small and doubles on demand until it reaches maxSize,
+// so steady enqueue/dequeue traffic never allocates.
 template <class T>
 class Queue {
 private:
-	typedef SinglyLinkedList<T> List;
-	List fElements;
+	static const size_t INITIAL_CAPACITY = 8;
+
+	T* buffer; // Raw storage for capacity elements
+	size_t capacity; // Allocated slots
+	size_t head; // Index of the front element
+	size_t count; // Number of stored elements
 	size_t maxSize; // Maximum size of the queue
 
+	static T* allocateBuffer(size_t slots) {
+		return slots == 0 ? nullptr : static_cast<T*>(::operator new(slots * sizeof(T)));
+	}
+
+	size_t slotAt(size_t offset) const {
+		size_t index = head + offset;
+		return index >= capacity ? index - capacity : index;
+	}
+
+	void destroyAll() {
+		for (size_t i = 0; i < count; ++i) {
+			buffer[slotAt(i)].~T();
+		}
+		::operator delete(buffer);
+		buffer = nullptr;
+		capacity = 0;
+		head = 0;
+		count = 0;
+	}
+
+	// Double the buffer, up to maxSize
+	void grow() {
+		size_t newCapacity = capacity == 0 ? INITIAL_CAPACITY : capacity * 2;
+		reallocate(newCapacity > maxSize ? maxSize : newCapacity);
+	}
+
+	// Move the elements into a buffer of newCapacity slots, unwrapping them to start at index 0
+	void reallocate(size_t newCapacity) {
+		T* newBuffer = allocateBuffer(newCapacity);
+		for (size_t i = 0; i < count; ++i) {
+			T& element = buffer[slotAt(i)];
+			new (&newBuffer[i]) T(std::move(element));
+			element.~T();
+		}
+		::operator delete(buffer);
+
+		buffer = newBuffer;
+		capacity = newCapacity;
+		head = 0;
+	}
+
+	template <class... Args>
+	T& push(Args&&... args) {
+		if (isFull()) {
+			throw std::overflow_error("Queue overflow: cannot enqueue to a full queue.");
+		}
+		if (count == capacity) {
+			grow();
+		}
+		T* slot = new (&buffer[slotAt(count)]) T(std::forward<Args>(args)...);
+		++count;
+		return *slot;
+	}
+
 public:
 	// Constructor
-	Queue(size_t maxSize = 1000) : maxSize(maxSize) {}
+	Queue(size_t maxSize = 1000) : buffer(nullptr), capacity(0), head(0), count(0), maxSize(maxSize) {}
+
+	// Copy constructor
+	Queue(const Queue& other) : buffer(allocateBuffer(other.count)), capacity(other.count), head(0), count(0), maxSize(other.maxSize) {
+		for (size_t i = 0; i < other.count; ++i) {
+			new (&buffer[i]) T(other.buffer[other.slotAt(i)]);
+			++count;
+		}
+	}
+
+	// Move constructor
+	Queue(Queue&& other) noexcept : buffer(other.buffer), capacity(other.capacity), head(other.head), count(other.count), maxSize(other.maxSize) {
+		other.buffer = nullptr;
+		other.capacity = 0;
+		other.head = 0;
+		other.count = 0;
+	}
+
+	// Copy and move assignment
+	Queue& operator=(Queue other) {
+		std::swap(buffer, other.buffer);
+		std::swap(capacity, other.capacity);
+		std::swap(head, other.head);
+		std::swap(count, other.count);
+		std::swap(maxSize, other.maxSize);
+		return *this;
+	}
+
+	// Destructor
+	~Queue() {
+		destroyAll();
+	}
 
 	bool isEmpty() const {
-		return fElements.isEmpty();
+		return count == 0;
 	}
 
 	int size() const {
-		return fElements.size();
+		return static_cast<int>(count);
 	}
 
 	bool isFull() const {
-		return size() >= maxSize;
+		return count >= maxSize;
 	}
 
-	void enqueue(const T& value) {
-		if (isFull()) {
-			throw std::overflow_error("Queue overflow: cannot enqueue to a full queue.");
+	// Pre-allocate room for n elements (capped at maxSize)
+	void reserve(size_t n) {
+		if (n > maxSize) {
+			n = maxSize;
+		}
+		if (capacity < n) {
+			reallocate(n);
 		}
-		fElements.pushBack(value);
+	}
+
+	void enqueue(const T& value) {
+		push(value);
+	}
+
+	void enqueue(T&& value) {
+		push(std::move(value));
+	}
+
+	// Construct a new back element in place
+	template <class... Args>
+	T& emplace(Args&&... args) {
+		return push(std::forward<Args>(args)...);
 	}
 
 	T dequeue() {
 		if (isEmpty()) {
 			throw std::underflow_error("Queue underflow: cannot dequeue from an empty queue.");
 		}
-		// Get the front element before removing it
-		T frontElement = *fElements.begin();
-		fElements.popFront();
+		// Move the front element out before destroying its slot
+		T& front = buffer[head];
+		T frontElement(std::move(front));
+		front.~T();
+		head = slotAt(1);
+		--count;
 		return frontElement;
 	}
+
+	// Look at the front element without removing it
+	const T& peek() const {
+		if (isEmpty()) {
+			throw std::underflow_error("Queue underflow: cannot peek an empty queue.");
+		}
+		return buffer[head];
+	}
 };
 
-#endif /* QUEUE_H */
\ No newline at end of file
+#endif /* QUEUE_H */
@@ -0,0 +1,149 @@
+#ifndef RANDOM_H
+#define RANDOM_H
+#include <chrono>
+#include <cstdint>
+#include <random>
+
+// SplitMix64 step, used to expand a single seed into generator state
+inline std::uint64_t splitMix64(std::uint64_t& state) {
+	std::uint64_t z = (state += 0x9e3779b97f4a7c15ULL);
+	z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+	z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+	return z ^ (z >> 31);
+}
+
+// xoshiro256** generator. Each instance is an independent, explicitly seeded stream,
+// so separate sessions (or threads) never share state, and a seed replays bit-exactly.
+class Random {
+private:
+	std::uint64_t fState[4];
+
+	static std::uint64_t rotateLeft(std::uint64_t x, int k) {
+		return (x << k) | (x >> (64 - k));
+	}
+
+public:
+	// Constructor
+	explicit Random(std::uint64_t aSeed = 0) {
+		seed(aSeed);
+	}
+
+	void seed(std::uint64_t aSeed) {
+		std::uint64_t mix = aSeed;
+		for (int i = 0; i < 4; ++i) {
+			fState[i] = splitMix64(mix);
+		}
+	}
+
+	std::uint64_t next() {
+		std::uint64_t result = rotateLeft(fState[1] * 5, 7) * 9;
+		std::uint64_t t = fState[1] << 17;
+		fState[2] ^= fState[0];
+		fState[3] ^= fState[1];
+		fState[1] ^= fState[2];
+		fState[0] ^= fState[3];
+		fState[2] ^= t;
+		fState[3] = rotateLeft(fState[3], 45);
+		return result;
+	}
+
+	// Uniform in [0, aBound) without modulo bias (Lemire's multiply-and-reject)
+	int nextInt(int aBound) {
+		if (aBound <= 1) {
+			return 0;
+		}
+		std::uint32_t bound = static_cast<std::uint32_t>(aBound);
+		std::uint64_t product = (next() >> 32) * bound;
+		std::uint32_t low = static_cast<std::uint32_t>(product);
+		if (low < bound) {
+			std::uint32_t threshold = (0u - bound) % bound;
+			while (low < threshold) {
+				product = (next() >> 32) * bound;
+				low = static_cast<std::uint32_t>(product);
+			}
+		}
+		return static_cast<int>(product >> 32);
+	}
+
+	// Uniform in [aLow, aHigh]
+	int nextRange(int aLow, int aHigh) {
+		return aLow + nextInt(aHigh - aLow + 1);
+	}
+
+	// True with aPercent% probability
+	bool rollPercent(int aPercent) {
+		return nextInt(100) < aPercent;
+	}
+
+	// Uniform in [0, 1)
+	float nextFloat() {
+		return static_cast<float>(next() >> 40) * (1.0f / 16777216.0f);
+	}
+};
+
+// The per-session set of generators. Combat, loot and events each draw from their own
+// stream, so an extra loot roll never shifts a later combat outcome.
+class RandomStreams {
+public:
+	enum class Stream {
+		COMBAT,
+		LOOT,
+		EVENTS
+	};
+
+	static const int STREAM_COUNT = 3;
+
+private:
+	std::uint64_t fSeed;
+	Random fStreams[STREAM_COUNT];
+
+public:
+	// Constructor
+	explicit RandomStreams(std::uint64_t aSeed = generateSeed()) {
+		reseed(aSeed);
+	}
+
+	// A fresh non-deterministic seed, for sessions that are not being replayed
+	static std::uint64_t generateSeed() {
+		std::random_device device;
+		std::uint64_t seedValue = (static_cast<std::uint64_t>(device()) << 32) ^ device();
+		return seedValue ^ static_cast<std::uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+	}
+
+	// Seed for the aIndex-th of many sessions run from one base seed (independent of run order)
+	static std::uint64_t deriveSeed(std::uint64_t aSeed, std::uint64_t aIndex) {
+		std::uint64_t mix = aSeed ^ (aIndex * 0xd1b54a32d192ed03ULL);
+		return splitMix64(mix);
+	}
+
+	// Re-derive every stream from one session seed
+	void reseed(std::uint64_t aSeed) {
+		fSeed = aSeed;
+		std::uint64_t mix = aSeed;
+		for (int i = 0; i < STREAM_COUNT; ++i) {
+			fStreams[i].seed(splitMix64(mix));
+		}
+	}
+
+	std::uint64_t getSeed() const {
+		return fSeed;
+	}
+
+	Random& get(Stream aStream) {
+		return fStreams[static_cast<int>(aStream)];
+	}
+
+	Random& combat() {
+		return get(Stream::COMBAT);
+	}
+
+	Random& loot() {
+		return get(Stream::LOOT);
+	}
+
+	Random& events() {
+		return get(Stream::EVENTS);
+	}
+};
+
+#endif /* RANDOM_H */
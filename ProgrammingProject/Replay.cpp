@@ -0,0 +1,143 @@
+#include "ContentPack.h"
+#include "GameSession.h"
+#include "ReplayLog.h"
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Replays recorded games (outbreak --record, outbreak_server --record-dir) headlessly at full
+// speed and checks each one ends in the state hash it was recorded with. A mismatch means the
+// game no longer plays those inputs the same way: a balance change, or a regression.
+// Run from ProgrammingProject/ so Content/ resolves.
+
+namespace {
+
+void printUsage() {
+	std::cerr << "Usage: replay [options] FILE...\n"
+		<< "  --repeat N       Play each log N times, for timing (default 1)\n"
+		<< "  --show           Print the game's output (first play of each log only)\n";
+}
+
+bool parseInteger(const char* aText, long long& aValue) {
+	char* end = nullptr;
+	aValue = std::strtoll(aText, &end, 10);
+	return end != aText && *end == '\0';
+}
+
+std::string toHex(std::uint64_t aValue) {
+	static const char DIGITS[] = "0123456789abcdef";
+	std::string text(16, '0');
+	for (int i = 15; i >= 0; --i) {
+		text[i] = DIGITS[aValue & 0xf];
+		aValue >>= 4;
+	}
+	return text;
+}
+
+}
+
+int main(int argc, char* argv[]) {
+	long long repeat = 1;
+	bool show = false;
+	std::vector<std::string> paths;
+
+	for (int i = 1; i < argc; ++i) {
+		std::string option = argv[i];
+		bool valid = true;
+
+		if (option == "--help" || option == "-h") {
+			printUsage();
+			return 0;
+		}
+		else if (option == "--repeat") {
+			valid = i + 1 < argc && parseInteger(argv[++i], repeat) && repeat > 0;
+		}
+		else if (option == "--show") {
+			show = true;
+		}
+		else if (option.compare(0, 2, "--") == 0) {
+			valid = false;
+		}
+		else {
+			paths.push_back(option);
+		}
+
+		if (!valid) {
+			std::cerr << "Invalid option: " << option << "\n";
+			printUsage();
+			return 1;
+		}
+	}
+	if (paths.empty()) {
+		printUsage();
+		return 1;
+	}
+
+	ContentPack content;
+	if (!content.load()) {
+		std::cerr << "Failed to load content: " << content.getLastError() << "\n";
+		return 1;
+	}
+
+	GameSession session(nullptr, &content);
+	if (!session.initialize()) {
+		std::cerr << "Failed to build the world\n";
+		return 1;
+	}
+
+	std::streambuf* console = std::cout.rdbuf();
+	int mismatches = 0;
+	int failures = 0;
+	long long totalLines = 0;
+	double totalSeconds = 0.0;
+
+	for (const std::string& path : paths) {
+		ReplayLog log;
+		std::string error;
+		if (!log.load(path, error)) {
+			std::cerr << "  " << error << "\n";
+			failures++;
+			continue;
+		}
+
+		std::uint64_t hash = 0;
+		bool matched = true;
+		bool played = true;
+		auto start = std::chrono::steady_clock::now();
+		for (long long run = 0; run < repeat && played; ++run) {
+			played = log.replay(session, hash, show && run == 0 ? console : nullptr);
+			matched = matched && hash == log.getStateHash();
+		}
+		if (!played) {
+			std::cerr << "  " << path << ": cannot create a scratch directory for its saves\n";
+			failures++;
+			continue;
+		}
+		double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+		totalLines += log.getLineCount() * repeat;
+		totalSeconds += seconds;
+		if (!matched) {
+			mismatches++;
+		}
+
+		std::cout << "  " << (matched ? "OK      " : "MISMATCH") << "  " << path << "  "
+			<< log.getLineCount() << " lines, " << std::fixed << std::setprecision(3)
+			<< seconds * 1000.0 / repeat << " ms per play";
+		if (!matched) {
+			std::cout << "  (recorded " << toHex(log.getStateHash()) << ", replayed " << toHex(hash) << ")";
+		}
+		std::cout << std::endl;
+	}
+
+	std::cout << "\n  " << paths.size() - failures << " logs replayed, " << mismatches << " mismatched, "
+		<< failures << " unreadable\n";
+	if (totalSeconds > 0.0) {
+		std::cout << "  " << totalLines << " input lines in " << std::fixed << std::setprecision(3) << totalSeconds
+			<< " s, " << std::setprecision(0) << totalLines / totalSeconds << " lines per second\n";
+	}
+	return mismatches == 0 && failures == 0 ? 0 : 1;
+}
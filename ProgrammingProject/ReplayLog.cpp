@@ -0,0 +1,234 @@
+#include "ReplayLog.h"
+#include "GameEngine.h"
+#include "GameSession.h"
+#include "Platform.h"
+#include "ProfileStore.h"
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+namespace {
+
+const char HEADER[] = "OUTBREAK REPLAY";
+
+// The log's input, then EndOfInput (std::cin rethrows it while its exception mask includes badbit)
+class LogInput : public std::streambuf {
+public:
+	// Constructor
+	explicit LogInput(const std::string& aInput) {
+		char* data = const_cast<char*>(aInput.data());
+		setg(data, data, data + aInput.size());
+	}
+
+protected:
+	int_type underflow() override {
+		throw ReplayLog::EndOfInput();
+	}
+};
+
+// Swallows output, for replays nobody is watching
+class NullOutput : public std::streambuf {
+protected:
+	int_type overflow(int_type aCharacter) override {
+		return traits_type::not_eof(aCharacter);
+	}
+
+	std::streamsize xsputn(const char* /*aText*/, std::streamsize aCount) override {
+		return aCount;
+	}
+};
+
+}
+
+// Constructor
+ReplayLog::ReplayLog() : fSeed(0), fProfiles(false), fStateHash(0) {
+}
+
+void ReplayLog::setSeed(std::uint64_t aSeed) {
+	fSeed = aSeed;
+}
+
+std::uint64_t ReplayLog::getSeed() const {
+	return fSeed;
+}
+
+void ReplayLog::setProfiles(bool aProfiles) {
+	fProfiles = aProfiles;
+}
+
+bool ReplayLog::usesProfiles() const {
+	return fProfiles;
+}
+
+void ReplayLog::appendInput(const char* aData, std::size_t aLength) {
+	fInput.append(aData, aLength);
+}
+
+const std::string& ReplayLog::getInput() const {
+	return fInput;
+}
+
+int ReplayLog::getLineCount() const {
+	int lines = 0;
+	for (char c : fInput) {
+		if (c == '\n') lines++;
+	}
+	if (!fInput.empty() && fInput.back() != '\n') lines++;
+	return lines;
+}
+
+void ReplayLog::setStateHash(std::uint64_t aHash) {
+	fStateHash = aHash;
+}
+
+std::uint64_t ReplayLog::getStateHash() const {
+	return fStateHash;
+}
+
+bool ReplayLog::save(const std::string& aPath) const {
+	std::ofstream file(aPath, std::ios::binary | std::ios::trunc);
+	if (!file) {
+		return false;
+	}
+
+	file << HEADER << " " << VERSION << "\n";
+	file << "seed " << fSeed << "\n";
+	if (fProfiles) {
+		file << "profiles\n";
+	}
+
+	std::size_t start = 0;
+	while (start < fInput.size()) {
+		std::size_t end = fInput.find('\n', start);
+		if (end == std::string::npos) {
+			file << "> " << fInput.substr(start) << "\nnoeol\n";
+			break;
+		}
+		file << "> " << fInput.substr(start, end - start) << "\n";
+		start = end + 1;
+	}
+
+	file << "hash " << std::hex << std::setw(16) << std::setfill('0') << fStateHash << "\n";
+	return static_cast<bool>(file.flush());
+}
+
+bool ReplayLog::load(const std::string& aPath, std::string& aError) {
+	std::ifstream file(aPath, std::ios::binary);
+	if (!file) {
+		aError = "cannot open " + aPath;
+		return false;
+	}
+
+	std::string line;
+	std::string header = std::string(HEADER) + " ";
+	bool known = std::getline(file, line) && line.compare(0, header.size(), header) == 0;
+	int version = known ? std::atoi(line.c_str() + header.size()) : 0;
+	if (version < 1 || version > VERSION || line != header + std::to_string(version)) {
+		aError = aPath + ": not a version 1 to " + std::to_string(VERSION) + " replay";
+		return false;
+	}
+
+	fSeed = 0;
+	fProfiles = false;
+	fInput.clear();
+	fStateHash = 0;
+	bool hasSeed = false;
+	bool hasHash = false;
+	int lineNumber = 1;
+
+	while (std::getline(file, line)) {
+		lineNumber++;
+		if (line.compare(0, 2, "> ") == 0) {
+			fInput.append(line, 2, std::string::npos);
+			fInput.push_back('\n');
+		}
+		else if (line.compare(0, 5, "seed ") == 0) {
+			fSeed = std::strtoull(line.c_str() + 5, nullptr, 10);
+			hasSeed = true;
+		}
+		else if (line == "profiles" && version >= 2) {
+			fProfiles = true;
+		}
+		else if (line == "noeol" && !fInput.empty()) {
+			fInput.pop_back();
+		}
+		else if (line.compare(0, 5, "hash ") == 0) {
+			fStateHash = std::strtoull(line.c_str() + 5, nullptr, 16);
+			hasHash = true;
+		}
+		else if (!line.empty()) {
+			aError = aPath + ":" + std::to_string(lineNumber) + ": unrecognised line";
+			return false;
+		}
+	}
+
+	if (!hasSeed || !hasHash) {
+		aError = aPath + ": missing " + (hasSeed ? "hash" : "seed");
+		return false;
+	}
+	return true;
+}
+
+bool ReplayLog::replay(GameSession& aSession, std::uint64_t& aHash, std::streambuf* aOutput) const {
+	std::string saves = Platform::createTemporaryDirectory();
+	if (saves.empty()) {
+		return false;
+	}
+	GameEngine& engine = aSession.getGameEngine();
+	engine.setSaveDirectory(saves);
+	ProfileStore profiles(saves + "profiles");
+	if (fProfiles) {
+		engine.setProfileStore(&profiles);
+	}
+
+	LogInput input(fInput);
+	NullOutput discard;
+
+	std::streambuf* hostInput = std::cin.rdbuf(&input);
+	std::streambuf* hostOutput = std::cout.rdbuf(aOutput != nullptr ? aOutput : &discard);
+	std::ios_base::iostate hostExceptions = std::cin.exceptions();
+	std::cin.clear();
+	std::cin.exceptions(std::ios_base::badbit);
+
+	try {
+		aSession.playNewGame(fSeed);
+	}
+	catch (const EndOfInput&) {
+		// The recorded player stopped here; every frame of the game has unwound
+	}
+
+	std::cout.flush();
+	std::cin.exceptions(std::ios_base::goodbit);
+	std::cin.clear();
+	std::cin.rdbuf(hostInput);
+	std::cout.rdbuf(hostOutput);
+	std::cin.exceptions(hostExceptions);
+
+	aHash = aSession.getStateHash();
+	engine.setProfileStore(nullptr);
+	engine.setSaveDirectory(std::string());
+	Platform::removeDirectoryTree(saves);
+	return true;
+}
+
+// ============================================================================
+// RECORDING
+// ============================================================================
+
+// Constructor
+InputRecorder::InputRecorder(std::streambuf* aSource, ReplayLog& aLog) : fSource(aSource), fLog(aLog) {
+}
+
+InputRecorder::int_type InputRecorder::underflow() {
+	return fSource->sgetc();
+}
+
+InputRecorder::int_type InputRecorder::uflow() {
+	int_type character = fSource->sbumpc();
+	if (!traits_type::eq_int_type(character, traits_type::eof())) {
+		char value = traits_type::to_char_type(character);
+		fLog.appendInput(&value, 1);
+	}
+	return character;
+}
@@ -0,0 +1,80 @@
+#ifndef REPLAYLOG_H
+#define REPLAYLOG_H
+#include <cstddef>
+#include <cstdint>
+#include <streambuf>
+#include <string>
+
+class GameSession;
+
+// Input log of one new game: the seed its random streams started from, every line the player
+// typed and a hash of the state the game ended in. The game reads all of its input through
+// std::cin and draws all of its randomness from the session's streams, so feeding the same lines
+// to a fresh session on the same seed must end in the same state hash.
+//
+// File format (text, one entry per line):
+//   OUTBREAK REPLAY 2
+//   seed <decimal>
+//   profiles                only if saves went to a profile store (the game asked for a player ID)
+//   > <input line>          one per line of input, in order
+//   noeol                   only if the input did not end with a newline
+//   hash <16 hex digits>
+class ReplayLog {
+private:
+	std::uint64_t fSeed;
+	bool fProfiles;
+	std::string fInput;
+	std::uint64_t fStateHash;
+
+public:
+	static const int VERSION = 2; // Version 1 logs, from before the profiles line, still load
+
+	// Thrown through the game's frames when a replay reads past the end of the log (not a
+	// std::exception, so the game's own handlers let it pass)
+	struct EndOfInput {};
+
+	// Constructor
+	ReplayLog();
+
+	void setSeed(std::uint64_t aSeed);
+	std::uint64_t getSeed() const;
+
+	void setProfiles(bool aProfiles);
+	bool usesProfiles() const;
+
+	void appendInput(const char* aData, std::size_t aLength);
+	const std::string& getInput() const;
+	int getLineCount() const;
+
+	void setStateHash(std::uint64_t aHash);
+	std::uint64_t getStateHash() const;
+
+	bool save(const std::string& aPath) const;
+	bool load(const std::string& aPath, std::string& aError);
+
+	// Play the logged game on aSession, headless and as fast as it runs: std::cin reads the log
+	// (running past its end ends the game, as a dropped connection does) and std::cout goes to
+	// aOutput, or nowhere. Saves go to a scratch directory deleted afterwards, so every play starts
+	// from no saves and the working directory's slots are never touched; a game recorded with
+	// profiles gets a profile store of its own there, so it is asked for its player ID at the same
+	// point (a player turned away because the ID was in use is not reproduced). aHash is the session's
+	// state hash at the end; false if no scratch directory could be made (nothing was played).
+	bool replay(GameSession& aSession, std::uint64_t& aHash, std::streambuf* aOutput = nullptr) const;
+};
+
+// Passes another buffer's input through unchanged, copying every character read into a log
+class InputRecorder : public std::streambuf {
+private:
+	std::streambuf* fSource;
+	ReplayLog& fLog;
+
+protected:
+	int_type underflow() override;
+	int_type uflow() override;
+
+public:
+	// Constructor
+	InputRecorder(std::streambuf* aSource, ReplayLog& aLog);
+};
+
+#endif /* REPLAYLOG_H */
@@ -0,0 +1,291 @@
+#include "ContentPack.h"
+#include "Platform.h"
+#include "SaveData.h"
+#include "SaveDiff.h"
+#include "SaveFile.h"
+#include "SaveText.h"
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Save and load throughput of each format generated from SaveData's field lists, on a late-game
+// save: a full inventory, most skills, every clue and a long trail of picked-up loot. The items are
+// the content pack's, stored by reference as GameEngine stores them, and binary slots are timed
+// both plain and compressed. Disk writes are timed apart from encoding, since they wait on the
+// flush to disk that makes a slot crash-safe. Run from ProgrammingProject/ so Content/ resolves.
+
+namespace {
+
+// Every item the world's loot hands out, in content order
+std::vector<const Item*> contentItems(const ContentPack& aContent) {
+	std::vector<const Item*> items;
+	for (int location = 0; location < aContent.getLocationCount(); ++location) {
+		for (const ContentPack::LootEntry& loot : aContent.getLoot(location)) {
+			items.push_back(&loot.item);
+		}
+	}
+	return items;
+}
+
+SaveData makeSave(const ContentPack& aContent, int aItems) {
+	SaveData data;
+	data.player.name = "Benchmark Survivor";
+	data.player.id = "player";
+	data.player.level = 12;
+	data.player.damage = 34;
+	data.player.health = 140;
+	data.player.maxHealth = 180;
+	data.player.hunger = 62;
+	data.player.experience = 950;
+	data.player.skillPoints = 3;
+	data.player.equippedWeapon = "Fire Axe";
+
+	data.progress.locationID = "hospital";
+	data.progress.locationName = "St. Mary's Hospital";
+	data.progress.locationVisited = true;
+	data.progress.chapter = 5;
+	data.progress.explorationProgress = 7;
+	data.progress.movementSteps = 412;
+	data.progress.playtimeSeconds = 5400;
+
+	std::vector<const Item*> items = contentItems(aContent);
+	for (int i = 0; i < aItems && !items.empty(); ++i) {
+		SaveData::ItemRecord item;
+		item.capture(*items[i % items.size()]);
+		item.quantity = 1 + i % 4;
+		data.inventory.push_back(item);
+	}
+	for (int i = 0; i < 12; ++i) {
+		data.skills.push_back(SaveData::SkillRecord("skill_" + std::to_string(i), 1 + i % 3));
+	}
+	for (int i = 0; i < 40; ++i) {
+		data.clueIDs.push_back(i);
+	}
+	for (int i = 0; i < 150; ++i) {
+		data.pickedUpLootIDs.push_back("loot_" + std::to_string(i));
+	}
+	return data;
+}
+
+// The same game a few minutes on: hurt, hungrier, one item used up and one found
+SaveData advance(const SaveData& aData) {
+	SaveData data = aData;
+	data.player.health -= 25;
+	data.player.hunger -= 10;
+	data.player.experience += 40;
+	data.progress.movementSteps += 9;
+	if (!data.inventory.empty()) {
+		data.inventory.front().quantity++;
+		data.inventory.pop_back();
+	}
+	if (!data.inventory.empty()) {
+		data.inventory.insert(data.inventory.begin(), data.inventory.back());
+	}
+	data.pickedUpLootIDs.push_back("loot_new");
+	return data;
+}
+
+struct Timer {
+	std::chrono::steady_clock::time_point start;
+
+	Timer() : start(std::chrono::steady_clock::now()) {
+	}
+
+	double microseconds() const {
+		return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+	}
+};
+
+// Throughput counts the uncompressed save's bytes, so the formats compare on the same work
+void report(const char* aName, double aMicroseconds, long long aCount, std::size_t aBytes) {
+	double perOperation = aMicroseconds / aCount;
+	std::cout << "  " << std::left << std::setw(24) << aName << std::right << std::fixed << std::setprecision(2)
+		<< std::setw(10) << perOperation << " us" << std::setprecision(1) << std::setw(10)
+		<< aBytes / perOperation << " MB/s\n";
+}
+
+void printUsage() {
+	std::cerr << "Usage: save_bench [options]\n"
+		<< "  --iterations N   Times each in-memory operation runs (default 20000)\n"
+		<< "  --writes N       Slots written to disk, each flushed (default 200)\n"
+		<< "  --items N        Inventory items in the save (default 20)\n";
+}
+
+bool parseInteger(const char* aText, long long& aValue) {
+	char* end = nullptr;
+	aValue = std::strtoll(aText, &end, 10);
+	return end != aText && *end == '\0';
+}
+
+}
+
+int main(int argc, char* argv[]) {
+	long long iterations = 20000;
+	long long writes = 200;
+	long long items = 20;
+
+	for (int i = 1; i < argc; ++i) {
+		std::string option = argv[i];
+		bool valid = true;
+
+		if (option == "--help" || option == "-h") {
+			printUsage();
+			return 0;
+		}
+		else if (option == "--iterations") {
+			valid = i + 1 < argc && parseInteger(argv[++i], iterations) && iterations > 0;
+		}
+		else if (option == "--writes") {
+			valid = i + 1 < argc && parseInteger(argv[++i], writes) && writes > 0;
+		}
+		else if (option == "--items") {
+			valid = i + 1 < argc && parseInteger(argv[++i], items) && items >= 0 && items <= 100000;
+		}
+		else {
+			valid = false;
+		}
+
+		if (!valid) {
+			std::cerr << "Invalid option: " << option << "\n";
+			printUsage();
+			return 1;
+		}
+	}
+
+	ContentPack content;
+	if (!content.load()) {
+		std::cerr << "Failed to load content: " << content.getLastError() << "\n";
+		return 1;
+	}
+	std::string directory = Platform::createTemporaryDirectory();
+	if (directory.empty()) {
+		std::cerr << "Cannot create a scratch directory\n";
+		return 1;
+	}
+	std::string path = directory + "save_slot_1.sav";
+	std::string packedPath = directory + "save_slot_2.sav";
+
+	// What GameEngine::saveGame writes: items the content holds are stored by reference
+	SaveData full = makeSave(content, static_cast<int>(items));
+	SaveData data = full;
+	data.referenceContent(content);
+	SaveData later = advance(data);
+	std::string encoded = SaveFile::encode(data);
+	std::string packed = SaveFile::pack(encoded);
+	std::stringstream textForm;
+	SaveText::write(textForm, data);
+	std::string text = textForm.str();
+	SaveFile::write(path, data);
+	SaveFile::write(packedPath, data, nullptr, true);
+
+	std::cout << "Save with " << data.inventory.size() << " items, " << data.skills.size() << " skills, "
+		<< data.clueIDs.size() << " clues, " << data.pickedUpLootIDs.size() << " loot: "
+		<< SaveFile::encode(full).size() << " bytes with item text, " << encoded.size() << " by reference, "
+		<< packed.size() << " compressed, " << text.size() << " as text\n";
+	std::cout << "  " << std::left << std::setw(24) << "operation" << std::right << std::setw(13) << "per save"
+		<< std::setw(15) << "throughput\n";
+
+	std::size_t sink = 0; // Keeps the optimizer from dropping work whose result is unused
+	Timer encodeTimer;
+	for (long long i = 0; i < iterations; ++i) {
+		sink += SaveFile::encode(data).size();
+	}
+	report("binary encode", encodeTimer.microseconds(), iterations, encoded.size());
+
+	Timer packTimer;
+	for (long long i = 0; i < iterations; ++i) {
+		sink += SaveFile::pack(SaveFile::encode(data)).size();
+	}
+	report("compressed encode", packTimer.microseconds(), iterations, encoded.size());
+
+	// Loads as GameEngine::loadGame does them, item text filled back in from the content
+	Timer readTimer;
+	for (long long i = 0; i < iterations; ++i) {
+		SaveFile file;
+		SaveData loaded;
+		std::string error;
+		if (file.open(path, error) && file.read(loaded)) {
+			loaded.resolveContent(content);
+			sink += loaded.inventory.size();
+		}
+	}
+	report("binary load", readTimer.microseconds(), iterations, encoded.size());
+
+	Timer unpackTimer;
+	for (long long i = 0; i < iterations; ++i) {
+		SaveFile file;
+		SaveData loaded;
+		std::string error;
+		if (file.open(packedPath, error) && file.read(loaded)) {
+			loaded.resolveContent(content);
+			sink += loaded.inventory.size();
+		}
+	}
+	report("compressed load", unpackTimer.microseconds(), iterations, encoded.size());
+
+	Timer summaryTimer;
+	for (long long i = 0; i < iterations; ++i) {
+		SaveFile file;
+		SaveData loaded;
+		std::string error;
+		if (file.open(path, error) && file.readSummary(loaded)) {
+			sink += loaded.player.level;
+		}
+	}
+	report("binary open + summary", summaryTimer.microseconds(), iterations, encoded.size());
+
+	Timer textWriteTimer;
+	for (long long i = 0; i < iterations; ++i) {
+		std::ostringstream out;
+		SaveText::write(out, data);
+		sink += out.str().size();
+	}
+	report("text write", textWriteTimer.microseconds(), iterations, text.size());
+
+	Timer textReadTimer;
+	for (long long i = 0; i < iterations; ++i) {
+		std::istringstream in(text);
+		SaveData loaded;
+		std::string error;
+		if (SaveText::read(in, loaded, error)) {
+			sink += loaded.inventory.size();
+		}
+	}
+	report("text read", textReadTimer.microseconds(), iterations, text.size());
+
+	Timer diffTimer;
+	for (long long i = 0; i < iterations; ++i) {
+		SaveData patched = data;
+		if (SaveDiff::compute(data, later).apply(patched)) {
+			sink += patched.inventory.size();
+		}
+	}
+	report("diff compute + apply", diffTimer.microseconds(), iterations, encoded.size());
+
+	Timer writeTimer;
+	for (long long i = 0; i < writes; ++i) {
+		if (SaveFile::write(path, i % 2 == 0 ? later : data)) {
+			sink++;
+		}
+	}
+	report("binary write to disk", writeTimer.microseconds(), writes, encoded.size());
+
+	Timer packedWriteTimer;
+	for (long long i = 0; i < writes; ++i) {
+		if (SaveFile::write(packedPath, i % 2 == 0 ? later : data, nullptr, true)) {
+			sink++;
+		}
+	}
+	report("compressed write to disk", packedWriteTimer.microseconds(), writes, encoded.size());
+
+	Platform::removeDirectoryTree(directory);
+	if (sink == 0) {
+		std::cerr << "Nothing was read back; the timings above are not of real work\n";
+		return 1;
+	}
+	return 0;
+}
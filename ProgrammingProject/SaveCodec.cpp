@@ -0,0 +1,136 @@
+#include "SaveCodec.h"
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace {
+
+const int HASH_BITS = 12;
+const std::size_t LAST_LITERALS = 5; // Matches stop short of the end, so the stream ends in literals
+
+std::uint32_t readU32(const char* aData) {
+	std::uint32_t value;
+	std::memcpy(&value, aData, sizeof(value));
+	return value;
+}
+
+std::uint32_t hashSequence(std::uint32_t aSequence) {
+	return (aSequence * 2654435761u) >> (32 - HASH_BITS);
+}
+
+void appendLength(std::string& aOut, std::size_t aLength) {
+	while (aLength >= 255) {
+		aOut += static_cast<char>(255);
+		aLength -= 255;
+	}
+	aOut += static_cast<char>(aLength);
+}
+
+void appendSequence(std::string& aOut, const char* aLiterals, std::size_t aLiteralCount,
+	std::size_t aOffset, std::size_t aMatchLength) {
+	std::size_t matchCode = aMatchLength > 0 ? aMatchLength - SaveCodec::MIN_MATCH : 0;
+	unsigned char token = static_cast<unsigned char>(((aLiteralCount < 15 ? aLiteralCount : 15) << 4)
+		| (matchCode < 15 ? matchCode : 15));
+	aOut += static_cast<char>(token);
+	if (aLiteralCount >= 15) {
+		appendLength(aOut, aLiteralCount - 15);
+	}
+	aOut.append(aLiterals, aLiteralCount);
+	if (aMatchLength > 0) {
+		aOut += static_cast<char>(aOffset & 0xFF);
+		aOut += static_cast<char>((aOffset >> 8) & 0xFF);
+		if (matchCode >= 15) {
+			appendLength(aOut, matchCode - 15);
+		}
+	}
+}
+
+// Read a nibble's continuation bytes; false if the stream ends first
+bool readLength(const unsigned char*& aCursor, const unsigned char* aEnd, std::size_t& aLength) {
+	unsigned char next = 255;
+	while (next == 255) {
+		if (aCursor == aEnd) {
+			return false;
+		}
+		next = *aCursor++;
+		aLength += next;
+	}
+	return true;
+}
+
+}
+
+std::string SaveCodec::compress(const char* aData, std::size_t aSize) {
+	std::string out;
+	out.reserve(aSize / 2 + 16);
+	std::vector<std::int64_t> table(static_cast<std::size_t>(1) << HASH_BITS, -1); // Last position of each hashed sequence
+
+	std::size_t anchor = 0;
+	std::size_t position = 0;
+	while (aSize >= MIN_MATCH + LAST_LITERALS && position + MIN_MATCH + LAST_LITERALS <= aSize) {
+		std::uint32_t sequence = readU32(aData + position);
+		std::uint32_t slot = hashSequence(sequence);
+		std::int64_t candidate = table[slot];
+		table[slot] = static_cast<std::int64_t>(position);
+		if (candidate < 0 || position - static_cast<std::size_t>(candidate) > MAX_OFFSET
+			|| readU32(aData + candidate) != sequence) {
+			position++;
+			continue;
+		}
+
+		std::size_t length = MIN_MATCH;
+		std::size_t limit = aSize - LAST_LITERALS - position;
+		while (length < limit && aData[candidate + length] == aData[position + length]) {
+			length++;
+		}
+		appendSequence(out, aData + anchor, position - anchor, position - static_cast<std::size_t>(candidate), length);
+		position += length;
+		anchor = position;
+	}
+	appendSequence(out, aData + anchor, aSize - anchor, 0, 0);
+	return out;
+}
+
+bool SaveCodec::decompress(const char* aData, std::size_t aSize, std::size_t aExpectedSize, std::string& aOutput) {
+	aOutput.clear();
+	aOutput.reserve(aExpectedSize);
+	const unsigned char* cursor = reinterpret_cast<const unsigned char*>(aData);
+	const unsigned char* end = cursor + aSize;
+
+	while (cursor < end) {
+		unsigned char token = *cursor++;
+		std::size_t literals = token >> 4;
+		if (literals == 15 && !readLength(cursor, end, literals)) {
+			return false;
+		}
+		if (literals > static_cast<std::size_t>(end - cursor) || literals > aExpectedSize - aOutput.size()) {
+			return false;
+		}
+		aOutput.append(reinterpret_cast<const char*>(cursor), literals);
+		cursor += literals;
+		if (cursor == end) {
+			break; // The last sequence has no match
+		}
+
+		if (end - cursor < 2) {
+			return false;
+		}
+		std::size_t offset = cursor[0] | (static_cast<std::size_t>(cursor[1]) << 8);
+		cursor += 2;
+		std::size_t length = token & 0xF;
+		if (length == 15 && !readLength(cursor, end, length)) {
+			return false;
+		}
+		length += MIN_MATCH;
+		if (offset == 0 || offset > aOutput.size() || length > aExpectedSize - aOutput.size()) {
+			return false;
+		}
+
+		// Byte by byte: a match may overlap the bytes it produces (a run)
+		std::size_t from = aOutput.size() - offset;
+		for (std::size_t i = 0; i < length; i++) {
+			aOutput += aOutput[from + i];
+		}
+	}
+	return aOutput.size() == aExpectedSize;
+}
@@ -0,0 +1,26 @@
+#ifndef SAVECODEC_H
+#define SAVECODEC_H
+#include <cstddef>
+#include <string>
+
+// Small LZ77 codec for save files, in the spirit of LZ4: no entropy stage, so it costs little
+// more than a copy either way. Binary saves are mostly zero-padded integers and repeated records,
+// which back-references to the last 64 KiB shrink several times over.
+// A stream is a run of sequences:
+//   token      high nibble: literal count, low nibble: match length - MIN_MATCH
+//              (a nibble of 15 continues in the following bytes, each added, until one is < 255)
+//   literals   copied as they are
+//   offset     2 bytes, little-endian: how far back the match starts (absent after the last literals)
+class SaveCodec {
+public:
+	static const std::size_t MIN_MATCH = 4;
+	static const std::size_t MAX_OFFSET = 65535;
+
+	static std::string compress(const char* aData, std::size_t aSize);
+
+	// Exactly aExpectedSize bytes into aOutput; false if the stream is damaged or decodes to any
+	// other size
+	static bool decompress(const char* aData, std::size_t aSize, std::size_t aExpectedSize, std::string& aOutput);
+};
+
+#endif /* SAVECODEC_H */
@@ -0,0 +1,318 @@
+#include "SaveData.h"
+#include "ClueJournal.h"
+#include "ContentPack.h"
+#include "GameplayEngine.h"
+#include "Item.h"
+#include "Location.h"
+#include "Player.h"
+#include <cstdlib>
+
+// ============================================================================
+// RECORDS
+// ============================================================================
+
+// Constructor
+SaveData::PlayerRecord::PlayerRecord()
+	: level(1), damage(0), health(0), maxHealth(0), hunger(100), experience(0), skillPoints(0) {
+}
+
+void SaveData::PlayerRecord::capture(Player& aPlayer) {
+	name = aPlayer.getName();
+	id = aPlayer.getID();
+	level = aPlayer.getLevel();
+	damage = aPlayer.getDamage();
+	health = aPlayer.getHealth();
+	maxHealth = aPlayer.getMaxHealth();
+	hunger = aPlayer.getHunger();
+	experience = aPlayer.getExperience();
+	skillPoints = aPlayer.getSkillPoints();
+	equippedWeapon = aPlayer.getEquippedWeapon();
+}
+
+Player* SaveData::PlayerRecord::createPlayer() const {
+	Player* player = new Player(id, name, level, damage, health, maxHealth);
+	player->setHunger(hunger);
+	player->setEquippedWeapon(equippedWeapon);
+	player->setXP(experience);
+	player->setSkillPoints(skillPoints);
+	return player;
+}
+
+// Constructor
+SaveData::ItemRecord::ItemRecord()
+	: category(0), quantity(1), inventorySpace(1), consumable(false), usable(false),
+	healthRestore(0), hungerRestore(0), infectionCure(0), damageBoost(0),
+	effectType(0), effectTurns(0), effectPower(0), ammo(0), maxAmmo(0), durability(100), maxDurability(100), fromContent(false) {
+}
+
+void SaveData::ItemRecord::capture(const Item& aItem) {
+	id = aItem.getID();
+	name = aItem.getName();
+	description = aItem.getDescription();
+	category = static_cast<int>(aItem.getCategory());
+	quantity = aItem.getQuantity();
+	inventorySpace = aItem.getInventorySpace();
+	consumable = aItem.isConsumable();
+	usable = aItem.isUsable();
+	healthRestore = aItem.getHealthRestore();
+	hungerRestore = aItem.getHungerRestore();
+	infectionCure = aItem.getInfectionCure();
+	damageBoost = aItem.getDamageBoost();
+	effectType = static_cast<int>(aItem.getEffectType());
+	effectTurns = aItem.getEffectTurns();
+	effectPower = aItem.getEffectPower();
+	ammo = aItem.getAmmo();
+	maxAmmo = aItem.getMaxAmmo();
+	durability = aItem.getDurability();
+	maxDurability = aItem.getMaxDurability();
+	fromContent = false;
+}
+
+Item SaveData::ItemRecord::createItem() const {
+	Item item(id, name, static_cast<Item::Category>(category), description, quantity, inventorySpace,
+		consumable, usable, healthRestore, hungerRestore, infectionCure, damageBoost,
+		static_cast<Item::EffectType>(effectType), effectTurns, effectPower);
+	item.setMaxAmmo(maxAmmo); // Maximums first: the setters clamp against them
+	item.setAmmo(ammo);
+	item.setMaxDurability(maxDurability);
+	item.setDurability(durability);
+	return item;
+}
+
+// Constructor
+SaveData::SkillRecord::SkillRecord() : level(0) {
+}
+
+// Parameterised constructor
+SaveData::SkillRecord::SkillRecord(const std::string& aID, int aLevel) : id(aID), level(aLevel) {
+}
+
+// Constructor
+SaveData::ProgressRecord::ProgressRecord()
+	: locationVisited(false), chapter(1), explorationProgress(0), movementSteps(0), playtimeSeconds(0) {
+}
+
+void SaveData::capture(Player& aPlayer, GameplayEngine& aGameplay, ClueJournal& aJournal, Location* aLocation, int aChapter) {
+	player.capture(aPlayer);
+
+	// The gameplay engine is the authoritative source for the current location
+	Location* location = aGameplay.getCurrentLocation() != nullptr ? aGameplay.getCurrentLocation() : aLocation;
+	if (location != nullptr) {
+		progress.locationID = location->getID();
+		progress.locationName = location->getName();
+		progress.locationVisited = location->isVisited();
+	}
+	else {
+		progress.locationID = "loc_ruined_city";
+		progress.locationName = "Ruined City";
+		progress.locationVisited = false;
+	}
+	progress.chapter = aChapter;
+	progress.explorationProgress = aGameplay.getExplorationProgress();
+	progress.movementSteps = aGameplay.getMovementSteps();
+
+	inventory.clear();
+	for (const Item& item : aPlayer.getInventory()) {
+		inventory.emplace_back();
+		inventory.back().capture(item);
+	}
+
+	std::vector<std::string> skillIDs;
+	std::vector<int> skillLevels;
+	aPlayer.getSkillTree().getUnlockedSkillData(skillIDs, skillLevels);
+	skills.clear();
+	for (size_t i = 0; i < skillIDs.size(); i++) {
+		skills.emplace_back(skillIDs[i], skillLevels[i]);
+	}
+
+	clueIDs = aJournal.getCollectedClueIDs();
+	pickedUpLootIDs = aGameplay.getPickedUpLootIDs();
+}
+
+void SaveData::referenceContent(const ContentPack& aContent) {
+	for (ItemRecord& record : inventory) {
+		const Item* item = record.fromContent ? nullptr : aContent.findItem(record.id);
+		if (item != nullptr && item->getName() == record.name && item->getDescription() == record.description) {
+			record.name.clear();
+			record.description.clear();
+			record.fromContent = true;
+		}
+	}
+}
+
+void SaveData::resolveContent(const ContentPack& aContent) {
+	for (ItemRecord& record : inventory) {
+		if (!record.fromContent) {
+			continue;
+		}
+		const Item* item = aContent.findItem(record.id);
+		record.name = item != nullptr ? item->getName() : record.id;
+		record.description = item != nullptr ? item->getDescription() : std::string();
+		record.fromContent = false;
+	}
+}
+
+// ============================================================================
+// DOCUMENTS
+// ============================================================================
+
+namespace {
+
+// Archive: appends each visited field to a list
+class FieldWriter {
+private:
+	SaveFieldList& fFields;
+
+public:
+	explicit FieldWriter(SaveFieldList& aFields) : fFields(aFields) {}
+
+	void field(const char* aName, int& aValue, int /*aSince*/) {
+		fFields.emplace_back(aName, std::to_string(aValue));
+	}
+
+	void field(const char* aName, bool& aValue, int /*aSince*/) {
+		fFields.emplace_back(aName, aValue ? "1" : "0");
+	}
+
+	void field(const char* aName, std::string& aValue, int /*aSince*/) {
+		fFields.emplace_back(aName, aValue);
+	}
+};
+
+// Archive: fills each visited field from a list; absent fields keep their value
+class FieldReader {
+private:
+	const SaveFieldList& fFields;
+	bool& fValid;
+
+	const std::string* find(const char* aName) const {
+		for (const auto& field : fFields) {
+			if (field.first == aName) {
+				return &field.second;
+			}
+		}
+		return nullptr;
+	}
+
+public:
+	FieldReader(const SaveFieldList& aFields, bool& aValid) : fFields(aFields), fValid(aValid) {}
+
+	void field(const char* aName, int& aValue, int /*aSince*/) {
+		const std::string* text = find(aName);
+		if (text == nullptr) {
+			return;
+		}
+		char* end = nullptr;
+		long value = std::strtol(text->c_str(), &end, 10);
+		if (text->empty() || *end != '\0') {
+			fValid = false;
+			return;
+		}
+		aValue = static_cast<int>(value);
+	}
+
+	void field(const char* aName, bool& aValue, int /*aSince*/) {
+		const std::string* text = find(aName);
+		if (text == nullptr) {
+			return;
+		}
+		if (*text != "0" && *text != "1") {
+			fValid = false;
+			return;
+		}
+		aValue = *text == "1";
+	}
+
+	void field(const char* aName, std::string& aValue, int /*aSince*/) {
+		const std::string* text = find(aName);
+		if (text != nullptr) {
+			aValue = *text;
+		}
+	}
+};
+
+// Archive over SaveData::visit(): one section per object or list
+class DocumentWriter {
+private:
+	SaveDocument& fDocument;
+
+public:
+	explicit DocumentWriter(SaveDocument& aDocument) : fDocument(aDocument) {}
+
+	template <class Record>
+	void object(const char* aName, Record& aRecord) {
+		fDocument.push_back(SaveSection{ aName, false, std::vector<SaveFieldList>(1) });
+		FieldWriter writer(fDocument.back().records[0]);
+		aRecord.visit(writer);
+	}
+
+	template <class Element>
+	void list(const char* aName, std::vector<Element>& aElements) {
+		fDocument.push_back(SaveSection{ aName, true, std::vector<SaveFieldList>(aElements.size()) });
+		for (size_t i = 0; i < aElements.size(); i++) {
+			FieldWriter writer(fDocument.back().records[i]);
+			visitElement(writer, aElements[i]);
+		}
+	}
+};
+
+// Archive over SaveData::visit(): fills each object or list from its section, if present
+class DocumentReader {
+private:
+	const SaveDocument& fDocument;
+	bool fValid;
+
+	const SaveSection* find(const char* aName) const {
+		for (const SaveSection& section : fDocument) {
+			if (section.name == aName) {
+				return &section;
+			}
+		}
+		return nullptr;
+	}
+
+public:
+	explicit DocumentReader(const SaveDocument& aDocument) : fDocument(aDocument), fValid(true) {}
+
+	template <class Record>
+	void object(const char* aName, Record& aRecord) {
+		const SaveSection* section = find(aName);
+		if (section == nullptr || section->records.empty()) {
+			return;
+		}
+		FieldReader reader(section->records[0], fValid);
+		aRecord.visit(reader);
+	}
+
+	template <class Element>
+	void list(const char* aName, std::vector<Element>& aElements) {
+		const SaveSection* section = find(aName);
+		if (section == nullptr) {
+			return;
+		}
+		aElements.assign(section->records.size(), Element());
+		for (size_t i = 0; i < aElements.size(); i++) {
+			FieldReader reader(section->records[i], fValid);
+			visitElement(reader, aElements[i]);
+		}
+	}
+
+	bool isValid() const {
+		return fValid;
+	}
+};
+
+}
+
+SaveDocument SaveData::toDocument() const {
+	SaveDocument document;
+	DocumentWriter writer(document);
+	const_cast<SaveData*>(this)->visit(writer); // Writers only read the fields
+	return document;
+}
+
+bool SaveData::fromDocument(const SaveDocument& aDocument) {
+	DocumentReader reader(aDocument);
+	visit(reader);
+	return reader.isValid();
+}
@@ -0,0 +1,205 @@
+#ifndef SAVEDATA_H
+#define SAVEDATA_H
+#include <string>
+#include <utility>
+#include <vector>
+
+class ClueJournal;
+class ContentPack;
+class GameplayEngine;
+class Item;
+class Location;
+class Player;
+
+// A record's fields as name/value text, the common ground of the text and diff formats
+typedef std::vector<std::pair<std::string, std::string>> SaveFieldList;
+
+// One object or list of a save as field lists; an object has exactly one record
+struct SaveSection {
+	std::string name;
+	bool list;
+	std::vector<SaveFieldList> records;
+};
+
+typedef std::vector<SaveSection> SaveDocument;
+
+// Everything a save slot holds, independent of the file format.
+//
+// Each record lists its fields once, in visit(): the binary (SaveFile), text (SaveText) and diff
+// (SaveDiff) formats are all generated from those lists, so a field added here is saved, loaded
+// and diffed everywhere. An archive provides
+//   field(name, int&, since)  field(name, bool&, since)  field(name, std::string&, since)
+// where since is the binary format version that introduced the field. The document itself is
+// visited through object(name, record) and list(name, vector), with list elements either
+// records or plain ints/strings.
+struct SaveData {
+	struct PlayerRecord {
+		std::string name;
+		std::string id;
+		int level;
+		int damage;
+		int health;
+		int maxHealth;
+		int hunger;
+		int experience;
+		int skillPoints;
+		std::string equippedWeapon;
+
+		PlayerRecord();
+		void capture(Player& aPlayer);
+		Player* createPlayer() const; // Caller owns the player; inventory and skills are restored separately
+
+		template <class Archive>
+		void visit(Archive& ar) {
+			ar.field("name", name, 1);
+			ar.field("id", id, 1);
+			ar.field("level", level, 1);
+			ar.field("damage", damage, 1);
+			ar.field("health", health, 1);
+			ar.field("maxHealth", maxHealth, 1);
+			ar.field("hunger", hunger, 2);
+			ar.field("experience", experience, 1);
+			ar.field("skillPoints", skillPoints, 1);
+			ar.field("equippedWeapon", equippedWeapon, 1);
+		}
+	};
+
+	struct ItemRecord {
+		std::string id; // First field: the key the diff format matches items by
+		std::string name;
+		std::string description;
+		int category;
+		int quantity;
+		int inventorySpace;
+		bool consumable;
+		bool usable;
+		int healthRestore;
+		int hungerRestore;
+		int infectionCure;
+		int damageBoost;
+		int effectType;
+		int effectTurns;
+		int effectPower;
+		int ammo;
+		int maxAmmo;
+		int durability;
+		int maxDurability;
+		bool fromContent; // name and description are the content pack's for this id, not stored
+
+		ItemRecord();
+		void capture(const Item& aItem);
+		Item createItem() const;
+
+		template <class Archive>
+		void visit(Archive& ar) {
+			ar.field("id", id, 1);
+			ar.field("name", name, 1);
+			ar.field("description", description, 1);
+			ar.field("category", category, 1);
+			ar.field("quantity", quantity, 1);
+			ar.field("inventorySpace", inventorySpace, 1);
+			ar.field("consumable", consumable, 1);
+			ar.field("usable", usable, 1);
+			ar.field("healthRestore", healthRestore, 1);
+			ar.field("hungerRestore", hungerRestore, 1);
+			ar.field("infectionCure", infectionCure, 1);
+			ar.field("damageBoost", damageBoost, 1);
+			ar.field("effectType", effectType, 2);
+			ar.field("effectTurns", effectTurns, 2);
+			ar.field("effectPower", effectPower, 2);
+			ar.field("ammo", ammo, 2);
+			ar.field("maxAmmo", maxAmmo, 2);
+			ar.field("durability", durability, 2);
+			ar.field("maxDurability", maxDurability, 2);
+			ar.field("fromContent", fromContent, 4);
+		}
+	};
+
+	// An unlocked skill in the player's SkillTree
+	struct SkillRecord {
+		std::string id;
+		int level;
+
+		SkillRecord();
+		SkillRecord(const std::string& aID, int aLevel);
+
+		template <class Archive>
+		void visit(Archive& ar) {
+			ar.field("id", id, 1);
+			ar.field("level", level, 1);
+		}
+	};
+
+	// Where the GameplayEngine stands in the story and the current area
+	struct ProgressRecord {
+		std::string locationID;
+		std::string locationName;
+		bool locationVisited;
+		int chapter;
+		int explorationProgress;
+		int movementSteps;
+		int playtimeSeconds; // Time spent in this game across every session
+
+		ProgressRecord();
+
+		template <class Archive>
+		void visit(Archive& ar) {
+			ar.field("locationID", locationID, 1);
+			ar.field("locationName", locationName, 1);
+			ar.field("locationVisited", locationVisited, 1);
+			ar.field("chapter", chapter, 1);
+			ar.field("explorationProgress", explorationProgress, 1);
+			ar.field("movementSteps", movementSteps, 1);
+			ar.field("playtimeSeconds", playtimeSeconds, 3);
+		}
+	};
+
+	PlayerRecord player;
+	ProgressRecord progress;
+	std::vector<ItemRecord> inventory;
+	std::vector<SkillRecord> skills;
+	std::vector<int> clueIDs; // ClueJournal's collected clues, in collection order
+	std::vector<std::string> pickedUpLootIDs;
+
+	template <class Archive>
+	void visit(Archive& ar) {
+		ar.object("player", player);
+		ar.object("progress", progress);
+		ar.list("item", inventory);
+		ar.list("skill", skills);
+		ar.list("clue", clueIDs);
+		ar.list("loot", pickedUpLootIDs);
+	}
+
+	// Snapshot a game in progress; aLocation is used when the gameplay engine has none yet
+	void capture(Player& aPlayer, GameplayEngine& aGameplay, ClueJournal& aJournal, Location* aLocation, int aChapter);
+
+	// Item names and descriptions the content pack already holds are left out before saving and
+	// filled back in after loading, so a save stores only text of its own. An item the content no
+	// longer has comes back named by its id.
+	void referenceContent(const ContentPack& aContent);
+	void resolveContent(const ContentPack& aContent);
+
+	// The save as text fields, in visit order, and back. Sections or fields missing from the document
+	// keep their current values; false if a value does not parse.
+	SaveDocument toDocument() const;
+	bool fromDocument(const SaveDocument& aDocument);
+};
+
+// List elements: records visit their fields, plain values are a single field named "value"
+template <class Archive, class Record>
+void visitElement(Archive& ar, Record& aRecord) {
+	aRecord.visit(ar);
+}
+
+template <class Archive>
+void visitElement(Archive& ar, int& aValue) {
+	ar.field("value", aValue, 1);
+}
+
+template <class Archive>
+void visitElement(Archive& ar, std::string& aValue) {
+	ar.field("value", aValue, 1);
+}
+
+#endif /* SAVEDATA_H */
@@ -0,0 +1,311 @@
+#include "SaveDiff.h"
+#include "SaveText.h"
+#include <cstdlib>
+#include <map>
+#include <utility>
+
+namespace {
+
+const char* const DIFF_HEADER = "OUTBREAK SAVE DIFF 1";
+
+std::string keyOf(const SaveFieldList& aRecord) {
+	return aRecord.empty() ? std::string() : aRecord[0].second;
+}
+
+// For each element, how many earlier elements share its key
+std::vector<int> occurrences(const std::vector<SaveFieldList>& aRecords) {
+	std::map<std::string, int> seen;
+	std::vector<int> result;
+	result.reserve(aRecords.size());
+	for (const SaveFieldList& record : aRecords) {
+		result.push_back(seen[keyOf(record)]++);
+	}
+	return result;
+}
+
+// Fields of aNew that are missing from or differ in aOld
+SaveFieldList changedFields(const SaveFieldList& aOld, const SaveFieldList& aNew) {
+	SaveFieldList changed;
+	for (const auto& field : aNew) {
+		bool same = false;
+		for (const auto& old : aOld) {
+			if (old.first == field.first) {
+				same = old.second == field.second;
+				break;
+			}
+		}
+		if (!same) {
+			changed.push_back(field);
+		}
+	}
+	return changed;
+}
+
+void setFields(SaveFieldList& aRecord, const SaveFieldList& aFields) {
+	for (const auto& field : aFields) {
+		bool found = false;
+		for (auto& existing : aRecord) {
+			if (existing.first == field.first) {
+				existing.second = field.second;
+				found = true;
+				break;
+			}
+		}
+		if (!found) {
+			aRecord.push_back(field);
+		}
+	}
+}
+
+void diffList(const SaveSection& aOld, const SaveSection& aNew, std::vector<SaveDiff::Change>& aChanges) {
+	const std::vector<SaveFieldList>& oldRecords = aOld.records;
+	const std::vector<SaveFieldList>& newRecords = aNew.records;
+	std::vector<int> oldOccurrence = occurrences(oldRecords);
+	std::vector<int> newOccurrence = occurrences(newRecords);
+
+	std::map<std::pair<std::string, int>, int> oldIndex;
+	for (size_t i = 0; i < oldRecords.size(); i++) {
+		oldIndex[std::make_pair(keyOf(oldRecords[i]), oldOccurrence[i])] = static_cast<int>(i);
+	}
+
+	// Match in order: an element that moved back past a matched one is removed and re-added, so the
+	// kept elements never need reordering
+	std::vector<int> match(newRecords.size(), -1);
+	std::vector<bool> kept(oldRecords.size(), false);
+	int last = -1;
+	for (size_t j = 0; j < newRecords.size(); j++) {
+		auto found = oldIndex.find(std::make_pair(keyOf(newRecords[j]), newOccurrence[j]));
+		if (found != oldIndex.end() && found->second > last) {
+			match[j] = found->second;
+			kept[found->second] = true;
+			last = found->second;
+		}
+	}
+
+	for (size_t i = 0; i < oldRecords.size(); i++) {
+		if (!kept[i]) {
+			aChanges.push_back(SaveDiff::Change{ SaveDiff::Kind::REMOVE, aNew.name, oldOccurrence[i], keyOf(oldRecords[i]), SaveFieldList() });
+		}
+	}
+	for (size_t j = 0; j < newRecords.size(); j++) {
+		if (match[j] < 0) {
+			continue;
+		}
+		SaveFieldList changed = changedFields(oldRecords[match[j]], newRecords[j]);
+		if (!changed.empty()) {
+			aChanges.push_back(SaveDiff::Change{ SaveDiff::Kind::SET, aNew.name, oldOccurrence[match[j]], keyOf(newRecords[j]), changed });
+		}
+	}
+	for (size_t j = 0; j < newRecords.size(); j++) {
+		if (match[j] < 0) {
+			aChanges.push_back(SaveDiff::Change{ SaveDiff::Kind::ADD, aNew.name, static_cast<int>(j), std::string(), newRecords[j] });
+		}
+	}
+}
+
+// Apply the changes aimed at one list; REMOVE and SET name elements of the list as it was
+bool applyList(SaveSection& aSection, const std::vector<const SaveDiff::Change*>& aChanges) {
+	std::vector<SaveFieldList>& records = aSection.records;
+	std::vector<int> occurrence = occurrences(records);
+	std::vector<bool> removed(records.size(), false);
+	std::vector<const SaveDiff::Change*> additions;
+
+	for (const SaveDiff::Change* change : aChanges) {
+		if (change->kind == SaveDiff::Kind::ADD) {
+			additions.push_back(change);
+			continue;
+		}
+		size_t i = 0;
+		while (i < records.size() && (occurrence[i] != change->index || keyOf(records[i]) != change->key)) {
+			i++;
+		}
+		if (i == records.size() || removed[i]) {
+			return false;
+		}
+		if (change->kind == SaveDiff::Kind::REMOVE) {
+			removed[i] = true;
+		}
+		else {
+			setFields(records[i], change->fields);
+		}
+	}
+
+	std::vector<SaveFieldList> result;
+	result.reserve(records.size() + additions.size());
+	for (size_t i = 0; i < records.size(); i++) {
+		if (!removed[i]) {
+			result.push_back(std::move(records[i]));
+		}
+	}
+	for (const SaveDiff::Change* addition : additions) {
+		if (addition->index < 0 || static_cast<size_t>(addition->index) > result.size()) {
+			return false;
+		}
+		result.insert(result.begin() + addition->index, addition->fields);
+	}
+	records = std::move(result);
+	return true;
+}
+
+const char* kindName(SaveDiff::Kind aKind) {
+	switch (aKind) {
+	case SaveDiff::Kind::SET: return "set";
+	case SaveDiff::Kind::ADD: return "add";
+	default: return "remove";
+	}
+}
+
+}
+
+// Constructor
+SaveDiff::SaveDiff() {
+}
+
+SaveDiff SaveDiff::compute(const SaveData& aOld, const SaveData& aNew) {
+	SaveDocument oldDocument = aOld.toDocument();
+	SaveDocument newDocument = aNew.toDocument();
+	SaveDiff diff;
+	for (size_t s = 0; s < newDocument.size(); s++) {
+		const SaveSection& oldSection = oldDocument[s];
+		const SaveSection& newSection = newDocument[s];
+		if (newSection.list) {
+			diffList(oldSection, newSection, diff.fChanges);
+			continue;
+		}
+		SaveFieldList changed = changedFields(oldSection.records[0], newSection.records[0]);
+		if (!changed.empty()) {
+			diff.fChanges.push_back(Change{ Kind::SET, newSection.name, -1, std::string(), changed });
+		}
+	}
+	return diff;
+}
+
+bool SaveDiff::apply(SaveData& aData) const {
+	SaveDocument document = aData.toDocument();
+	size_t applied = 0;
+	for (SaveSection& section : document) {
+		std::vector<const Change*> changes;
+		for (const Change& change : fChanges) {
+			if (change.section == section.name) {
+				changes.push_back(&change);
+			}
+		}
+		applied += changes.size();
+		if (section.list) {
+			if (!applyList(section, changes)) {
+				return false;
+			}
+			continue;
+		}
+		for (const Change* change : changes) {
+			if (change->kind != Kind::SET || change->index >= 0) {
+				return false;
+			}
+			setFields(section.records[0], change->fields);
+		}
+	}
+	if (applied != fChanges.size()) {
+		return false; // A change names a section this save does not have
+	}
+	return aData.fromDocument(document);
+}
+
+const std::vector<SaveDiff::Change>& SaveDiff::getChanges() const {
+	return fChanges;
+}
+
+bool SaveDiff::isEmpty() const {
+	return fChanges.empty();
+}
+
+// ============================================================================
+// TEXT FORM
+// ============================================================================
+
+void SaveDiff::write(std::ostream& aOut) const {
+	aOut << DIFF_HEADER << '\n';
+	for (const Change& change : fChanges) {
+		aOut << '[' << kindName(change.kind) << ' ' << change.section;
+		if (change.index >= 0) {
+			aOut << ' ' << change.index;
+			if (change.kind != Kind::ADD) {
+				aOut << ' ' << SaveText::escape(change.key);
+			}
+		}
+		aOut << "]\n";
+		for (const auto& field : change.fields) {
+			aOut << field.first << '=' << SaveText::escape(field.second) << '\n';
+		}
+	}
+}
+
+bool SaveDiff::read(std::istream& aIn, std::string& aError) {
+	fChanges.clear();
+	std::string line;
+	if (!std::getline(aIn, line) || line != DIFF_HEADER) {
+		aError = "not a save diff (expected '" + std::string(DIFF_HEADER) + "').";
+		return false;
+	}
+
+	int lineNumber = 1;
+	while (std::getline(aIn, line)) {
+		lineNumber++;
+		if (!line.empty() && line.back() == '\r') {
+			line.pop_back();
+		}
+		if (line.empty()) {
+			continue;
+		}
+		std::string where = "line " + std::to_string(lineNumber) + ": ";
+		if (line.front() != '[' || line.back() != ']') {
+			std::size_t equals = line.find('=');
+			if (fChanges.empty() || equals == std::string::npos) {
+				aError = where + "expected [change] or name=value.";
+				return false;
+			}
+			fChanges.back().fields.emplace_back(line.substr(0, equals), SaveText::unescape(line.substr(equals + 1)));
+			continue;
+		}
+
+		// [kind section] or [kind section index] or [kind section index key]
+		std::string header = line.substr(1, line.size() - 2);
+		Change change{ Kind::SET, std::string(), -1, std::string(), SaveFieldList() };
+		std::size_t space = header.find(' ');
+		std::string kind = header.substr(0, space);
+		if (kind == "set") change.kind = Kind::SET;
+		else if (kind == "add") change.kind = Kind::ADD;
+		else if (kind == "remove") change.kind = Kind::REMOVE;
+		else {
+			aError = where + "unknown change '" + kind + "'.";
+			return false;
+		}
+		if (space == std::string::npos) {
+			aError = where + "missing section.";
+			return false;
+		}
+		std::size_t start = space + 1;
+		space = header.find(' ', start);
+		change.section = header.substr(start, space - start);
+		if (space != std::string::npos) {
+			start = space + 1;
+			space = header.find(' ', start);
+			std::string index = header.substr(start, space - start);
+			char* end = nullptr;
+			long value = std::strtol(index.c_str(), &end, 10);
+			if (index.empty() || *end != '\0' || value < 0) {
+				aError = where + "bad index '" + index + "'.";
+				return false;
+			}
+			change.index = static_cast<int>(value);
+			if (space != std::string::npos) {
+				change.key = SaveText::unescape(header.substr(space + 1));
+			}
+		}
+		if ((change.kind != Kind::SET && change.index < 0) || (change.kind != Kind::ADD && change.index >= 0 && space == std::string::npos)) {
+			aError = where + "incomplete change header.";
+			return false;
+		}
+		fChanges.push_back(change);
+	}
+	return true;
+}
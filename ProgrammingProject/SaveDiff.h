@@ -0,0 +1,59 @@
+#ifndef SAVEDIFF_H
+#define SAVEDIFF_H
+#include "SaveData.h"
+#include <istream>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// The changes between two saves, field by field. List elements are matched by their first field
+// (item and skill id, clue id, loot id) and its occurrence among equal keys, so a quantity change is
+// one SET rather than a remove and an add. apply() on the older save reproduces the newer one
+// exactly, element order included.
+//
+// Text form, one block per change:
+//   OUTBREAK SAVE DIFF 1
+//   [set player]             changed fields of an object follow
+//   health=40
+//   [set item 0 medkit]      changed fields of the first element keyed "medkit"
+//   quantity=2
+//   [remove clue 0 7]
+//   [add item 3]             a whole new element, inserted at index 3
+//   id=pipe
+//   ...
+class SaveDiff {
+public:
+	enum class Kind {
+		SET,
+		ADD,
+		REMOVE
+	};
+
+	struct Change {
+		Kind kind;
+		std::string section;
+		int index; // Lists: occurrence of key in the older save (SET, REMOVE) or position in the newer (ADD); objects: -1
+		std::string key;
+		SaveFieldList fields; // SET: the changed fields; ADD: the whole element
+	};
+
+private:
+	std::vector<Change> fChanges;
+
+public:
+	// Constructor
+	SaveDiff();
+
+	static SaveDiff compute(const SaveData& aOld, const SaveData& aNew);
+
+	// Turn aData, the older save, into the newer; false if a change does not match it
+	bool apply(SaveData& aData) const;
+
+	const std::vector<Change>& getChanges() const;
+	bool isEmpty() const;
+
+	void write(std::ostream& aOut) const;
+	bool read(std::istream& aIn, std::string& aError);
+};
+
+#endif /* SAVEDIFF_H */
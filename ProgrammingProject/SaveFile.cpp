@@ -0,0 +1,547 @@
+#include "SaveFile.h"
+#include "Platform.h"
+#include "SaveCodec.h"
+#include <cstring>
+
+namespace {
+
+const char SAVE_MAGIC[4] = { 'O', 'B', 'S', 'V' };
+const char PACKED_MAGIC[4] = { 'O', 'B', 'S', 'Z' };
+const std::uint32_t MAX_UNPACKED_SIZE = 64 * 1024 * 1024;
+const std::uint32_t MAX_SECTIONS = 64;
+const std::uint32_t STRINGS = 255; // Section type of the string pool
+const std::uint32_t VERSION_1_STRINGS = 6;
+
+struct Header {
+	char magic[4];
+	std::uint32_t version;
+	std::uint32_t fileSize;
+	std::uint32_t checksum;
+	std::uint32_t sectionCount;
+	std::uint32_t reserved;
+};
+
+// Compressed save: the header, then a whole binary save run through SaveCodec
+struct PackedHeader {
+	char magic[4];
+	std::uint32_t unpackedSize;
+	std::uint32_t checksum; // FNV-1a over the compressed bytes
+	std::uint32_t reserved;
+};
+
+// Header and section table are copied to and from the file as they sit in memory
+static_assert(sizeof(Header) == 24, "save header must have no padding");
+static_assert(sizeof(PackedHeader) == 16, "compressed save header must have no padding");
+static_assert(sizeof(SaveFile::Section) == 16, "section entry must have no padding");
+
+std::uint32_t checksum(const char* aData, std::size_t aLength) {
+	std::uint32_t hash = 2166136261u;
+	for (std::size_t i = 0; i < aLength; ++i) {
+		hash = (hash ^ static_cast<unsigned char>(aData[i])) * 16777619u;
+	}
+	return hash;
+}
+
+void appendU32(std::string& aOut, std::uint32_t aValue) {
+	for (int i = 0; i < 4; ++i) {
+		aOut += static_cast<char>((aValue >> (8 * i)) & 0xFF);
+	}
+}
+
+std::uint32_t readU32(const char* aData) {
+	std::uint32_t value = 0;
+	for (int i = 0; i < 4; ++i) {
+		value |= static_cast<std::uint32_t>(static_cast<unsigned char>(aData[i])) << (8 * i);
+	}
+	return value;
+}
+
+// ============================================================================
+// RECORD ARCHIVES
+// ============================================================================
+
+// Archive: bytes per record in a given version
+class RecordSize {
+private:
+	std::uint32_t fVersion;
+	std::uint32_t fSize;
+
+public:
+	explicit RecordSize(std::uint32_t aVersion) : fVersion(aVersion), fSize(0) {}
+
+	void field(const char* /*aName*/, int& /*aValue*/, int aSince) {
+		if (static_cast<std::uint32_t>(aSince) <= fVersion) fSize += 4;
+	}
+
+	void field(const char* /*aName*/, bool& /*aValue*/, int aSince) {
+		if (static_cast<std::uint32_t>(aSince) <= fVersion) fSize += 4;
+	}
+
+	void field(const char* /*aName*/, std::string& /*aValue*/, int aSince) {
+		if (static_cast<std::uint32_t>(aSince) <= fVersion) fSize += 8;
+	}
+
+	std::uint32_t get() const {
+		return fSize;
+	}
+};
+
+template <class Element>
+std::uint32_t getRecordSize(std::uint32_t aVersion) {
+	Element sample = Element();
+	RecordSize size(aVersion);
+	visitElement(size, sample);
+	return size.get();
+}
+
+// Archive: appends a record in the current version, its strings going to the pool
+class RecordWriter {
+private:
+	std::string& fOut;
+	std::string& fStrings;
+
+public:
+	RecordWriter(std::string& aOut, std::string& aStrings) : fOut(aOut), fStrings(aStrings) {}
+
+	void field(const char* /*aName*/, int& aValue, int /*aSince*/) {
+		appendU32(fOut, static_cast<std::uint32_t>(aValue));
+	}
+
+	void field(const char* /*aName*/, bool& aValue, int /*aSince*/) {
+		appendU32(fOut, aValue ? 1 : 0);
+	}
+
+	void field(const char* /*aName*/, std::string& aValue, int /*aSince*/) {
+		appendU32(fOut, static_cast<std::uint32_t>(fStrings.size()));
+		appendU32(fOut, static_cast<std::uint32_t>(aValue.size()));
+		fStrings += aValue;
+	}
+};
+
+// Archive: reads one record of a mapped section in place
+class RecordReader {
+private:
+	const char* fRecord;
+	std::uint32_t fVersion;
+	std::string_view fStrings;
+	bool& fValid;
+
+public:
+	RecordReader(const char* aRecord, std::uint32_t aVersion, std::string_view aStrings, bool& aValid)
+		: fRecord(aRecord), fVersion(aVersion), fStrings(aStrings), fValid(aValid) {}
+
+	void field(const char* /*aName*/, int& aValue, int aSince) {
+		if (static_cast<std::uint32_t>(aSince) > fVersion) return;
+		aValue = static_cast<int>(readU32(fRecord));
+		fRecord += 4;
+	}
+
+	void field(const char* /*aName*/, bool& aValue, int aSince) {
+		if (static_cast<std::uint32_t>(aSince) > fVersion) return;
+		aValue = readU32(fRecord) != 0;
+		fRecord += 4;
+	}
+
+	void field(const char* /*aName*/, std::string& aValue, int aSince) {
+		if (static_cast<std::uint32_t>(aSince) > fVersion) return;
+		std::uint32_t offset = readU32(fRecord);
+		std::uint32_t length = readU32(fRecord + 4);
+		fRecord += 8;
+		if (static_cast<std::uint64_t>(offset) + length > fStrings.size()) {
+			fValid = false;
+			return;
+		}
+		aValue.assign(fStrings.data() + offset, length);
+	}
+};
+
+// ============================================================================
+// DOCUMENT ARCHIVES
+// ============================================================================
+
+// Archive over SaveData::visit(): one section per object or list, numbered in visit order
+class FileWriter {
+private:
+	std::vector<SaveFile::Section> fSections;
+	std::string fBody;
+	std::string fStrings;
+
+	template <class Element>
+	void addSection(std::vector<Element>& aElements) {
+		fBody.append((4 - fBody.size() % 4) % 4, '\0');
+		std::uint32_t type = static_cast<std::uint32_t>(fSections.size()) + 1;
+		std::uint32_t offset = static_cast<std::uint32_t>(fBody.size());
+		for (Element& element : aElements) {
+			RecordWriter writer(fBody, fStrings);
+			visitElement(writer, element);
+		}
+		fSections.push_back(SaveFile::Section{ type, offset, static_cast<std::uint32_t>(aElements.size()),
+			getRecordSize<Element>(SaveFile::VERSION) });
+	}
+
+public:
+	template <class Record>
+	void object(const char* /*aName*/, Record& aRecord) {
+		std::vector<Record> single(1, aRecord);
+		addSection(single);
+	}
+
+	template <class Element>
+	void list(const char* /*aName*/, std::vector<Element>& aElements) {
+		addSection(aElements);
+	}
+
+	std::string build() {
+		fBody.append((4 - fBody.size() % 4) % 4, '\0');
+		fSections.push_back(SaveFile::Section{ STRINGS, static_cast<std::uint32_t>(fBody.size()),
+			static_cast<std::uint32_t>(fStrings.size()), 1 });
+		fBody += fStrings;
+
+		std::uint32_t bodyStart = static_cast<std::uint32_t>(sizeof(Header) + fSections.size() * sizeof(SaveFile::Section));
+		std::string file(sizeof(Header), '\0');
+		for (const SaveFile::Section& section : fSections) {
+			appendU32(file, section.type);
+			appendU32(file, section.offset + bodyStart);
+			appendU32(file, section.count);
+			appendU32(file, section.recordSize);
+		}
+		file += fBody;
+
+		Header header;
+		std::memcpy(header.magic, SAVE_MAGIC, sizeof(SAVE_MAGIC));
+		header.version = SaveFile::VERSION;
+		header.fileSize = static_cast<std::uint32_t>(file.size());
+		header.checksum = checksum(file.data() + sizeof(Header), file.size() - sizeof(Header));
+		header.sectionCount = static_cast<std::uint32_t>(fSections.size());
+		header.reserved = 0;
+		std::memcpy(&file[0], &header, sizeof(Header));
+		return file;
+	}
+};
+
+// Archive over SaveData::visit(): reads each object or list from its section in the mapping
+class FileReader {
+private:
+	const char* fData;
+	std::uint32_t fVersion;
+	const std::vector<SaveFile::Section>& fSections;
+	std::string_view fStrings;
+	bool fObjectsOnly;
+	std::uint32_t fNextType;
+	bool fValid;
+
+	const SaveFile::Section* next() {
+		std::uint32_t type = fNextType++;
+		for (const SaveFile::Section& section : fSections) {
+			if (section.type == type) return &section;
+		}
+		return nullptr;
+	}
+
+public:
+	FileReader(const char* aData, std::uint32_t aVersion, const std::vector<SaveFile::Section>& aSections,
+		std::string_view aStrings, bool aObjectsOnly)
+		: fData(aData), fVersion(aVersion), fSections(aSections), fStrings(aStrings), fObjectsOnly(aObjectsOnly),
+		fNextType(1), fValid(true) {}
+
+	template <class Record>
+	void object(const char* /*aName*/, Record& aRecord) {
+		const SaveFile::Section* section = next();
+		if (section == nullptr || section->count != 1 || section->recordSize != getRecordSize<Record>(fVersion)) {
+			fValid = false;
+			return;
+		}
+		RecordReader reader(fData + section->offset, fVersion, fStrings, fValid);
+		aRecord.visit(reader);
+	}
+
+	template <class Element>
+	void list(const char* /*aName*/, std::vector<Element>& aElements) {
+		const SaveFile::Section* section = next();
+		if (fObjectsOnly) {
+			return;
+		}
+		std::uint32_t recordSize = getRecordSize<Element>(fVersion);
+		if (section == nullptr || section->recordSize != recordSize) {
+			fValid = false;
+			return;
+		}
+		aElements.assign(section->count, Element());
+		for (std::uint32_t i = 0; i < section->count; ++i) {
+			RecordReader reader(fData + section->offset + i * recordSize, fVersion, fStrings, fValid);
+			visitElement(reader, aElements[i]);
+		}
+	}
+
+	bool isValid() const {
+		return fValid;
+	}
+};
+
+}
+
+// ============================================================================
+// WRITING
+// ============================================================================
+
+std::string SaveFile::encode(const SaveData& aData) {
+	FileWriter writer;
+	const_cast<SaveData&>(aData).visit(writer); // Writers only read the fields
+	return writer.build();
+}
+
+std::string SaveFile::pack(const std::string& aEncoded) {
+	std::string payload = SaveCodec::compress(aEncoded.data(), aEncoded.size());
+	PackedHeader header;
+	std::memcpy(header.magic, PACKED_MAGIC, sizeof(PACKED_MAGIC));
+	header.unpackedSize = static_cast<std::uint32_t>(aEncoded.size());
+	header.checksum = checksum(payload.data(), payload.size());
+	header.reserved = 0;
+
+	std::string packed(reinterpret_cast<const char*>(&header), sizeof(header));
+	packed += payload;
+	return packed;
+}
+
+bool SaveFile::write(const std::string& aPath, const SaveData& aData, std::uint32_t* aChecksum, bool aCompress) {
+	std::string buffer = encode(aData);
+	if (aChecksum != nullptr) {
+		Header header;
+		std::memcpy(&header, buffer.data(), sizeof(Header));
+		*aChecksum = header.checksum; // Of the save inside, so compressing does not change it
+	}
+	if (aCompress) {
+		buffer = pack(buffer);
+	}
+	return Platform::replaceFile(aPath, buffer.data(), buffer.size());
+}
+
+// ============================================================================
+// READING
+// ============================================================================
+
+// Constructor
+SaveFile::SaveFile() : fData(nullptr), fSize(0), fVersion(0), fChecksum(0) {
+}
+
+bool SaveFile::open(const std::string& aPath, std::string& aError) {
+	close();
+	fData = Platform::mapFile(aPath, fSize);
+	if (fData == nullptr) {
+		fSize = 0;
+		aError = "Save '" + aPath + "' not found.";
+		return false;
+	}
+	if (fSize >= sizeof(PackedHeader) && std::memcmp(fData, PACKED_MAGIC, sizeof(PACKED_MAGIC)) == 0 && !unpack(aError)) {
+		aError = "Save '" + aPath + "' " + aError;
+		close();
+		return false;
+	}
+	if (!validate(aError)) {
+		aError = "Save '" + aPath + "' " + aError;
+		close();
+		return false;
+	}
+	return true;
+}
+
+bool SaveFile::unpack(std::string& aError) {
+	PackedHeader header;
+	std::memcpy(&header, fData, sizeof(PackedHeader));
+	const char* payload = fData + sizeof(PackedHeader);
+	std::size_t payloadSize = fSize - sizeof(PackedHeader);
+	if (checksum(payload, payloadSize) != header.checksum) {
+		aError = "is damaged (checksum mismatch).";
+		return false;
+	}
+	if (header.unpackedSize > MAX_UNPACKED_SIZE
+		|| !SaveCodec::decompress(payload, payloadSize, header.unpackedSize, fUnpacked)) {
+		aError = "is damaged (bad compressed data).";
+		return false;
+	}
+
+	// Reads work on the decompressed copy from here on
+	Platform::unmapFile(fData, fSize);
+	fData = fUnpacked.data();
+	fSize = fUnpacked.size();
+	return true;
+}
+
+bool SaveFile::validate(std::string& aError) {
+	Header header;
+	if (fSize < sizeof(Header)) {
+		aError = "is truncated.";
+		return false;
+	}
+	std::memcpy(&header, fData, sizeof(Header));
+	if (std::memcmp(header.magic, SAVE_MAGIC, sizeof(SAVE_MAGIC)) != 0) {
+		aError = "is not a binary save.";
+		return false;
+	}
+	if (header.version < 1 || header.version > VERSION) {
+		aError = "has unsupported version " + std::to_string(header.version) + ".";
+		return false;
+	}
+	if (header.fileSize != fSize || header.sectionCount > MAX_SECTIONS
+		|| sizeof(Header) + header.sectionCount * sizeof(Section) > fSize) {
+		aError = "is truncated.";
+		return false;
+	}
+	if (checksum(fData + sizeof(Header), fSize - sizeof(Header)) != header.checksum) {
+		aError = "is damaged (checksum mismatch).";
+		return false;
+	}
+
+	fVersion = header.version;
+	fChecksum = header.checksum;
+	fSections.resize(header.sectionCount);
+	std::memcpy(fSections.data(), fData + sizeof(Header), header.sectionCount * sizeof(Section));
+	for (const Section& section : fSections) {
+		if (section.offset % 4 != 0 || section.offset + static_cast<std::uint64_t>(section.count) * section.recordSize > fSize) {
+			aError = "has a bad section table.";
+			return false;
+		}
+	}
+	return true;
+}
+
+void SaveFile::close() {
+	if (fData != nullptr && fData != fUnpacked.data()) {
+		Platform::unmapFile(fData, fSize);
+	}
+	fUnpacked.clear();
+	fData = nullptr;
+	fSize = 0;
+	fVersion = 0;
+	fChecksum = 0;
+	fSections.clear();
+}
+
+bool SaveFile::isOpen() const {
+	return fData != nullptr;
+}
+
+std::uint32_t SaveFile::getVersion() const {
+	return fVersion;
+}
+
+std::uint32_t SaveFile::getChecksum() const {
+	return fChecksum;
+}
+
+const SaveFile::Section* SaveFile::findSection(std::uint32_t aType) const {
+	for (const Section& section : fSections) {
+		if (section.type == aType) return &section;
+	}
+	return nullptr;
+}
+
+bool SaveFile::read(SaveData& aData) const {
+	if (fData == nullptr) {
+		return false;
+	}
+	if (fVersion == 1) {
+		return readVersion1(aData);
+	}
+	const Section* strings = findSection(STRINGS);
+	if (strings == nullptr || strings->recordSize != 1) {
+		return false;
+	}
+	FileReader reader(fData, fVersion, fSections, std::string_view(fData + strings->offset, strings->count), false);
+	aData.visit(reader);
+	return reader.isValid();
+}
+
+bool SaveFile::readSummary(SaveData& aData) const {
+	if (fData == nullptr) {
+		return false;
+	}
+	if (fVersion == 1) {
+		return readVersion1(aData);
+	}
+	const Section* strings = findSection(STRINGS);
+	if (strings == nullptr || strings->recordSize != 1) {
+		return false;
+	}
+	FileReader reader(fData, fVersion, fSections, std::string_view(fData + strings->offset, strings->count), true);
+	aData.visit(reader);
+	return reader.isValid();
+}
+
+// Version 1 predates the field lists: player and progress shared one record (strings first) and
+// the item flags were packed, so it is read field by field here
+bool SaveFile::readVersion1(SaveData& aData) const {
+	const Section* player = findSection(1);
+	const Section* items = findSection(2);
+	const Section* loot = findSection(3);
+	const Section* clues = findSection(4);
+	const Section* skills = findSection(5);
+	const Section* strings = findSection(VERSION_1_STRINGS);
+	if (player == nullptr || player->count != 1 || player->recordSize != 80 || items == nullptr || items->recordSize != 56
+		|| loot == nullptr || loot->recordSize != 8 || clues == nullptr || clues->recordSize != 4
+		|| skills == nullptr || skills->recordSize != 12 || strings == nullptr) {
+		return false;
+	}
+
+	bool valid = true;
+	std::string_view pool(fData + strings->offset, strings->count);
+	RecordReader reader(fData + player->offset, 1, pool, valid);
+	reader.field("name", aData.player.name, 1);
+	reader.field("id", aData.player.id, 1);
+	reader.field("locationID", aData.progress.locationID, 1);
+	reader.field("locationName", aData.progress.locationName, 1);
+	reader.field("equippedWeapon", aData.player.equippedWeapon, 1);
+	reader.field("level", aData.player.level, 1);
+	reader.field("damage", aData.player.damage, 1);
+	reader.field("health", aData.player.health, 1);
+	reader.field("maxHealth", aData.player.maxHealth, 1);
+	reader.field("locationVisited", aData.progress.locationVisited, 1);
+	reader.field("chapter", aData.progress.chapter, 1);
+	reader.field("explorationProgress", aData.progress.explorationProgress, 1);
+	reader.field("movementSteps", aData.progress.movementSteps, 1);
+	reader.field("experience", aData.player.experience, 1);
+	reader.field("skillPoints", aData.player.skillPoints, 1);
+
+	aData.inventory.assign(items->count, SaveData::ItemRecord());
+	for (std::uint32_t i = 0; i < items->count; ++i) {
+		SaveData::ItemRecord& item = aData.inventory[i];
+		RecordReader itemReader(fData + items->offset + i * 56, 1, pool, valid);
+		int flags = 0;
+		itemReader.field("id", item.id, 1);
+		itemReader.field("name", item.name, 1);
+		itemReader.field("description", item.description, 1);
+		itemReader.field("category", item.category, 1);
+		itemReader.field("quantity", item.quantity, 1);
+		itemReader.field("inventorySpace", item.inventorySpace, 1);
+		itemReader.field("flags", flags, 1);
+		itemReader.field("healthRestore", item.healthRestore, 1);
+		itemReader.field("hungerRestore", item.hungerRestore, 1);
+		itemReader.field("infectionCure", item.infectionCure, 1);
+		itemReader.field("damageBoost", item.damageBoost, 1);
+		item.consumable = (flags & 1) != 0;
+		item.usable = (flags & 2) != 0;
+	}
+
+	// The remaining lists kept their layout
+	aData.pickedUpLootIDs.assign(loot->count, std::string());
+	for (std::uint32_t i = 0; i < loot->count; ++i) {
+		RecordReader lootReader(fData + loot->offset + i * 8, 1, pool, valid);
+		visitElement(lootReader, aData.pickedUpLootIDs[i]);
+	}
+	aData.clueIDs.assign(clues->count, 0);
+	for (std::uint32_t i = 0; i < clues->count; ++i) {
+		RecordReader clueReader(fData + clues->offset + i * 4, 1, pool, valid);
+		visitElement(clueReader, aData.clueIDs[i]);
+	}
+	aData.skills.assign(skills->count, SaveData::SkillRecord());
+	for (std::uint32_t i = 0; i < skills->count; ++i) {
+		RecordReader skillReader(fData + skills->offset + i * 12, 1, pool, valid);
+		visitElement(skillReader, aData.skills[i]);
+	}
+	return valid;
+}
+
+// Destructor
+SaveFile::~SaveFile() {
+	close();
+}
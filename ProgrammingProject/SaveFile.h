@@ -0,0 +1,77 @@
+#ifndef SAVEFILE_H
+#define SAVEFILE_H
+#include "SaveData.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Binary save slot, mapped read-only. Little-endian, every field 4-byte aligned:
+//   Header   magic "OBSV", version, file size, checksum (FNV-1a over everything after the header),
+//            section count
+//   Sections table of { type, offset, count, record size }, then the sections: one per object or
+//            list that SaveData::visit() names, in that order, plus the string pool. Records are
+//            the visited fields back to back: ints and bools as 4 bytes, strings as
+//            { offset, length } references into the pool.
+// open() checks the header, checksum and section table once. Reads then take each field from its
+// fixed offset in the mapping, with no parsing; readSummary() touches only the player and
+// progress records. Fields a version introduced (their `since`) are skipped in older files.
+// A save may also be written compressed: magic "OBSZ", the decompressed size, a checksum of the
+// compressed bytes, reserved, then the whole file above run through SaveCodec. open() tells the
+// two apart and decompresses such a file once, into memory; reads are the same after that.
+class SaveFile {
+public:
+	static const std::uint32_t VERSION = 4;
+
+	struct Section {
+		std::uint32_t type;
+		std::uint32_t offset;
+		std::uint32_t count;
+		std::uint32_t recordSize;
+	};
+
+private:
+	const char* fData;
+	std::size_t fSize;
+	std::uint32_t fVersion;
+	std::uint32_t fChecksum;
+	std::vector<Section> fSections;
+	std::string fUnpacked; // What fData points into for a compressed save
+
+	bool unpack(std::string& aError);
+	bool validate(std::string& aError);
+	const Section* findSection(std::uint32_t aType) const;
+	bool readVersion1(SaveData& aData) const;
+
+public:
+	// Constructor
+	SaveFile();
+
+	SaveFile(const SaveFile&) = delete;
+	SaveFile& operator=(const SaveFile&) = delete;
+
+	// Write aData to aPath in the current binary format, compressed if aCompress; a crash mid-save
+	// leaves the old slot intact. aChecksum, if given, receives the new save's checksum.
+	static bool write(const std::string& aPath, const SaveData& aData, std::uint32_t* aChecksum = nullptr, bool aCompress = false);
+	static std::string encode(const SaveData& aData);
+	static std::string pack(const std::string& aEncoded); // encode()'s output as a compressed save
+
+	// Map and verify a binary save; false with aError set if it is missing, foreign or damaged
+	bool open(const std::string& aPath, std::string& aError);
+	void close();
+	bool isOpen() const;
+	std::uint32_t getVersion() const;
+	std::uint32_t getChecksum() const; // Identifies this exact file, e.g. for the journal built on it
+
+	// The whole save; false if a section is missing or a field is out of bounds
+	bool read(SaveData& aData) const;
+
+	// Only the player and progress records, for listing slots
+	bool readSummary(SaveData& aData) const;
+
+	// Destructor
+	~SaveFile();
+};
+
+#endif /* SAVEFILE_H */
@@ -0,0 +1,347 @@
+#include "Platform.h"
+#include "Random.h"
+#include "SaveData.h"
+#include "SaveDiff.h"
+#include "SaveFile.h"
+#include "SaveText.h"
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+// Round trips random saves through every format generated from SaveData's field lists: binary
+// (plain and compressed), text, and a diff against a changed copy, applied again. Damaged binary
+// files must be rejected or read in bounds, never crash. Stops at the first save that does not
+// come back as it went in, printing the seed that reproduces it.
+
+namespace {
+
+// Awkward bytes for the text formats: separators, escapes, line breaks and UTF-8
+const char STRING_CHARACTERS[] = "abcXYZ019 _-=[]#\\\n\r\t\"'\xc3\xa9";
+
+std::string randomString(Random& aRandom) {
+	std::string text;
+	int length = aRandom.rollPercent(10) ? 0 : aRandom.nextRange(1, 24);
+	for (int i = 0; i < length; ++i) {
+		text.push_back(STRING_CHARACTERS[aRandom.nextInt(sizeof(STRING_CHARACTERS) - 1)]);
+	}
+	return text;
+}
+
+int randomInt(Random& aRandom) {
+	switch (aRandom.nextInt(4)) {
+	case 0: return aRandom.nextRange(-1, 1);
+	case 1: return aRandom.nextRange(0, 200);
+	case 2: return static_cast<int>(static_cast<std::uint32_t>(aRandom.next())); // Anywhere in int
+	default: return aRandom.nextInt(6) == 0 ? 2147483647 : aRandom.nextRange(-1000, 1000);
+	}
+}
+
+// Fills every field a record visits, whatever its type
+class Randomizer {
+private:
+	Random& fRandom;
+
+public:
+	// Constructor
+	explicit Randomizer(Random& aRandom) : fRandom(aRandom) {
+	}
+
+	void field(const char* /*aName*/, int& aValue, int /*aSince*/) {
+		aValue = randomInt(fRandom);
+	}
+
+	void field(const char* /*aName*/, bool& aValue, int /*aSince*/) {
+		aValue = fRandom.rollPercent(50);
+	}
+
+	void field(const char* /*aName*/, std::string& aValue, int /*aSince*/) {
+		aValue = randomString(fRandom);
+	}
+};
+
+template <class Record>
+Record randomRecord(Random& aRandom) {
+	Record record;
+	Randomizer randomizer(aRandom);
+	visitElement(randomizer, record);
+	return record;
+}
+
+template <>
+int randomRecord<int>(Random& aRandom) {
+	return randomInt(aRandom);
+}
+
+template <>
+std::string randomRecord<std::string>(Random& aRandom) {
+	return randomString(aRandom);
+}
+
+template <class Record>
+void randomList(Random& aRandom, std::vector<Record>& aList) {
+	int count = aRandom.nextInt(4) == 0 ? 0 : aRandom.nextRange(1, 30);
+	aList.clear();
+	for (int i = 0; i < count; ++i) {
+		aList.push_back(randomRecord<Record>(aRandom));
+	}
+}
+
+SaveData randomSave(Random& aRandom) {
+	SaveData data;
+	Randomizer randomizer(aRandom);
+	data.player.visit(randomizer);
+	data.progress.visit(randomizer);
+	randomList(aRandom, data.inventory);
+	randomList(aRandom, data.skills);
+	randomList(aRandom, data.clueIDs);
+	randomList(aRandom, data.pickedUpLootIDs);
+	return data;
+}
+
+// Some elements edited, removed, duplicated or added, as a save made later in the same game
+template <class Record>
+void changeList(Random& aRandom, std::vector<Record>& aList) {
+	for (std::size_t i = 0; i < aList.size(); ++i) {
+		int roll = aRandom.nextInt(10);
+		if (roll == 0) {
+			aList.erase(aList.begin() + i--);
+		}
+		else if (roll == 1) {
+			aList[i] = randomRecord<Record>(aRandom);
+		}
+		else if (roll == 2) {
+			aList.insert(aList.begin() + i, aList[i]); // Same key twice
+			++i;
+		}
+	}
+	int added = aRandom.nextInt(4);
+	for (int i = 0; i < added; ++i) {
+		aList.insert(aList.begin() + aRandom.nextInt(static_cast<int>(aList.size()) + 1), randomRecord<Record>(aRandom));
+	}
+}
+
+SaveData changedSave(Random& aRandom, const SaveData& aOld) {
+	SaveData data = aOld;
+	Randomizer randomizer(aRandom);
+	if (aRandom.rollPercent(50)) data.player.visit(randomizer);
+	if (aRandom.rollPercent(50)) data.progress.visit(randomizer);
+	for (SaveData::ItemRecord& item : data.inventory) {
+		if (aRandom.rollPercent(20)) item.quantity = randomInt(aRandom);
+	}
+	changeList(aRandom, data.inventory);
+	changeList(aRandom, data.skills);
+	changeList(aRandom, data.clueIDs);
+	changeList(aRandom, data.pickedUpLootIDs);
+	return data;
+}
+
+bool sameSave(const SaveData& aExpected, const SaveData& aActual, std::string& aDifference) {
+	SaveDocument expected = aExpected.toDocument();
+	SaveDocument actual = aActual.toDocument();
+	for (std::size_t i = 0; i < expected.size() && i < actual.size(); ++i) {
+		if (expected[i].name != actual[i].name || expected[i].records.size() != actual[i].records.size()) {
+			aDifference = "section " + expected[i].name + " has " + std::to_string(actual[i].records.size())
+				+ " records, expected " + std::to_string(expected[i].records.size());
+			return false;
+		}
+		for (std::size_t j = 0; j < expected[i].records.size(); ++j) {
+			const SaveFieldList& expectedFields = expected[i].records[j];
+			const SaveFieldList& actualFields = actual[i].records[j];
+			for (std::size_t k = 0; k < expectedFields.size(); ++k) {
+				if (k >= actualFields.size() || actualFields[k] != expectedFields[k]) {
+					aDifference = expected[i].name + "[" + std::to_string(j) + "]." + expectedFields[k].first + " is '"
+						+ SaveText::escape(k < actualFields.size() ? actualFields[k].second : std::string()) + "', expected '"
+						+ SaveText::escape(expectedFields[k].second) + "'";
+					return false;
+				}
+			}
+		}
+	}
+	if (expected.size() != actual.size()) {
+		aDifference = "different section count";
+		return false;
+	}
+	return true;
+}
+
+bool writeBytes(const std::string& aPath, const std::string& aBytes) {
+	std::ofstream file(aPath, std::ios::binary | std::ios::trunc);
+	file.write(aBytes.data(), static_cast<std::streamsize>(aBytes.size()));
+	return static_cast<bool>(file.flush());
+}
+
+// One failure description per format, empty when the save survived it
+std::string checkBinary(const SaveData& aData, const std::string& aPath, bool aCompress) {
+	if (!SaveFile::write(aPath, aData, nullptr, aCompress)) {
+		return "cannot write " + aPath;
+	}
+	SaveFile file;
+	std::string error;
+	SaveData loaded;
+	if (!file.open(aPath, error)) {
+		return error;
+	}
+	if (!file.read(loaded)) {
+		return "read failed";
+	}
+	std::string difference;
+	return sameSave(aData, loaded, difference) ? std::string() : difference;
+}
+
+std::string checkText(const SaveData& aData) {
+	std::stringstream text;
+	SaveText::write(text, aData);
+	SaveData loaded;
+	std::string error;
+	if (!SaveText::read(text, loaded, error)) {
+		return error;
+	}
+	std::string difference;
+	return sameSave(aData, loaded, difference) ? std::string() : difference;
+}
+
+std::string checkDiff(const SaveData& aOld, const SaveData& aNew) {
+	std::stringstream text;
+	SaveDiff::compute(aOld, aNew).write(text);
+	SaveDiff diff;
+	std::string error;
+	if (!diff.read(text, error)) {
+		return error;
+	}
+	SaveData patched = aOld;
+	if (!diff.apply(patched)) {
+		return "the diff does not apply to the save it was computed from";
+	}
+	std::string difference;
+	return sameSave(aNew, patched, difference) ? std::string() : difference;
+}
+
+// Binary save header: magic, version, file size, checksum (FNV-1a over the rest), section count, reserved
+const std::size_t HEADER_SIZE = 24;
+const std::size_t CHECKSUM_OFFSET = 12;
+
+// Give damaged records a checksum that matches, so they get past it to the bounds checks
+void resealChecksum(std::string& aBytes) {
+	std::uint32_t hash = 2166136261u;
+	for (std::size_t i = HEADER_SIZE; i < aBytes.size(); ++i) {
+		hash = (hash ^ static_cast<unsigned char>(aBytes[i])) * 16777619u;
+	}
+	for (int i = 0; i < 4; ++i) {
+		aBytes[CHECKSUM_OFFSET + i] = static_cast<char>((hash >> (8 * i)) & 0xFF);
+	}
+}
+
+// A damaged copy must fail to open or read, or read without running out of bounds
+void checkDamaged(Random& aRandom, const std::string& aBytes, bool aPacked, const std::string& aPath, int& aRejected) {
+	std::string damaged = aBytes;
+	if (aRandom.rollPercent(25)) {
+		damaged.resize(aRandom.nextInt(static_cast<int>(damaged.size())));
+	}
+	else {
+		int flips = aRandom.nextRange(1, 8);
+		for (int i = 0; i < flips && !damaged.empty(); ++i) {
+			damaged[aRandom.nextInt(static_cast<int>(damaged.size()))] ^= static_cast<char>(1 << aRandom.nextInt(8));
+		}
+		if (!aPacked && damaged.size() >= HEADER_SIZE && aRandom.rollPercent(75)) {
+			resealChecksum(damaged);
+		}
+	}
+	writeBytes(aPath, damaged);
+
+	SaveFile file;
+	std::string error;
+	SaveData loaded;
+	if (!file.open(aPath, error) || !file.read(loaded)) {
+		aRejected++;
+	}
+}
+
+void printUsage() {
+	std::cerr << "Usage: save_fuzz [options]\n"
+		<< "  --iterations N   Random saves to round trip (default 10000)\n"
+		<< "  --seed N         First save's seed; save i uses seed + i (default 1)\n";
+}
+
+bool parseInteger(const char* aText, long long& aValue) {
+	char* end = nullptr;
+	aValue = std::strtoll(aText, &end, 10);
+	return end != aText && *end == '\0';
+}
+
+}
+
+int main(int argc, char* argv[]) {
+	long long iterations = 10000;
+	long long seed = 1;
+
+	for (int i = 1; i < argc; ++i) {
+		std::string option = argv[i];
+		bool valid = true;
+
+		if (option == "--help" || option == "-h") {
+			printUsage();
+			return 0;
+		}
+		else if (option == "--iterations") {
+			valid = i + 1 < argc && parseInteger(argv[++i], iterations) && iterations > 0;
+		}
+		else if (option == "--seed") {
+			valid = i + 1 < argc && parseInteger(argv[++i], seed);
+		}
+		else {
+			valid = false;
+		}
+
+		if (!valid) {
+			std::cerr << "Invalid option: " << option << "\n";
+			printUsage();
+			return 1;
+		}
+	}
+
+	std::string directory = Platform::createTemporaryDirectory();
+	if (directory.empty()) {
+		std::cerr << "Cannot create a scratch directory\n";
+		return 1;
+	}
+	std::string savePath = directory + "fuzz.sav";
+	std::string damagedPath = directory + "damaged.sav";
+
+	int rejected = 0;
+	long long failures = 0;
+	for (long long i = 0; i < iterations && failures == 0; ++i) {
+		Random random(static_cast<std::uint64_t>(seed + i));
+		SaveData data = randomSave(random);
+		SaveData later = changedSave(random, data);
+
+		const char* formats[] = { "binary", "compressed binary", "text", "diff" };
+		std::string problems[] = {
+			checkBinary(data, savePath, false),
+			checkBinary(data, savePath, true),
+			checkText(data),
+			checkDiff(data, later)
+		};
+		for (int format = 0; format < 4; ++format) {
+			if (!problems[format].empty()) {
+				std::cout << "  FAIL  seed " << seed + i << ", " << formats[format] << ": " << problems[format] << "\n";
+				failures++;
+			}
+		}
+
+		std::string encoded = SaveFile::encode(data);
+		bool packed = random.rollPercent(25);
+		checkDamaged(random, packed ? SaveFile::pack(encoded) : encoded, packed, damagedPath, rejected);
+	}
+
+	Platform::removeDirectoryTree(directory);
+	if (failures > 0) {
+		std::cout << "  Reproduce with: save_fuzz --seed <seed> --iterations 1\n";
+		return 1;
+	}
+	std::cout << "  " << iterations << " saves round tripped through binary, compressed binary, text and diff\n"
+		<< "  " << iterations << " damaged saves opened, " << rejected << " rejected, none crashed\n";
+	return 0;
+}
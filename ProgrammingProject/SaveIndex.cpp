@@ -0,0 +1,195 @@
+#include "SaveIndex.h"
+#include "Platform.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+namespace {
+
+const char INDEX_MAGIC[4] = { 'O', 'B', 'S', 'I' };
+const std::uint32_t INDEX_VERSION = 1;
+const std::size_t HEADER_SIZE = 16;
+const std::uint32_t MAX_ENTRIES = 4096;
+
+std::uint32_t checksum(const char* aData, std::size_t aLength) {
+	std::uint32_t hash = 2166136261u;
+	for (std::size_t i = 0; i < aLength; ++i) {
+		hash = (hash ^ static_cast<unsigned char>(aData[i])) * 16777619u;
+	}
+	return hash;
+}
+
+void appendU32(std::string& aOut, std::uint32_t aValue) {
+	for (int i = 0; i < 4; ++i) {
+		aOut += static_cast<char>((aValue >> (8 * i)) & 0xFF);
+	}
+}
+
+void appendString(std::string& aOut, const std::string& aText) {
+	appendU32(aOut, static_cast<std::uint32_t>(aText.size()));
+	aOut += aText;
+}
+
+// Bounds-checked reads over the mapped entries
+class Reader {
+private:
+	const char* fData;
+	std::size_t fSize;
+	std::size_t fOffset;
+	bool fValid;
+
+public:
+	Reader(const char* aData, std::size_t aSize) : fData(aData), fSize(aSize), fOffset(0), fValid(true) {}
+
+	std::uint32_t readU32() {
+		if (fSize - fOffset < 4) {
+			fValid = false;
+			return 0;
+		}
+		std::uint32_t value = 0;
+		for (int i = 0; i < 4; ++i) {
+			value |= static_cast<std::uint32_t>(static_cast<unsigned char>(fData[fOffset + i])) << (8 * i);
+		}
+		fOffset += 4;
+		return value;
+	}
+
+	std::string readString() {
+		std::uint32_t length = readU32();
+		if (!fValid || fSize - fOffset < length) {
+			fValid = false;
+			return std::string();
+		}
+		std::string text(fData + fOffset, length);
+		fOffset += length;
+		return text;
+	}
+
+	bool isValid() const {
+		return fValid;
+	}
+};
+
+}
+
+// Constructor
+SaveIndex::Entry::Entry() : slot(0), level(1), chapter(1), playtimeSeconds(0), savedAt(0) {
+}
+
+SaveIndex::Entry SaveIndex::describe(int aSlot, const SaveData& aData, std::int64_t aSavedAt) {
+	Entry entry;
+	entry.slot = aSlot;
+	entry.playerName = aData.player.name;
+	entry.level = aData.player.level;
+	entry.chapter = aData.progress.chapter;
+	entry.locationName = aData.progress.locationName;
+	entry.playtimeSeconds = aData.progress.playtimeSeconds;
+	entry.savedAt = aSavedAt;
+	return entry;
+}
+
+bool SaveIndex::load(const std::string& aPath, std::vector<Entry>& aEntries) {
+	aEntries.clear();
+	std::size_t size = 0;
+	const char* data = Platform::mapFile(aPath, size);
+	if (data == nullptr) {
+		return false;
+	}
+
+	Reader header(data, std::min(size, HEADER_SIZE));
+	char magic[4];
+	std::memcpy(magic, data, std::min(size, sizeof(magic)));
+	header.readU32();
+	std::uint32_t version = header.readU32();
+	std::uint32_t count = header.readU32();
+	std::uint32_t expected = header.readU32();
+	bool valid = header.isValid() && std::memcmp(magic, INDEX_MAGIC, sizeof(INDEX_MAGIC)) == 0
+		&& version == INDEX_VERSION && count <= MAX_ENTRIES
+		&& checksum(data + HEADER_SIZE, size - HEADER_SIZE) == expected;
+
+	Reader reader(data + HEADER_SIZE, valid ? size - HEADER_SIZE : 0);
+	for (std::uint32_t i = 0; valid && i < count; i++) {
+		Entry entry;
+		entry.slot = static_cast<int>(reader.readU32());
+		entry.level = static_cast<int>(reader.readU32());
+		entry.chapter = static_cast<int>(reader.readU32());
+		entry.playtimeSeconds = static_cast<int>(reader.readU32());
+		std::uint64_t low = reader.readU32();
+		std::uint64_t high = reader.readU32();
+		entry.savedAt = static_cast<std::int64_t>(low | (high << 32));
+		entry.playerName = reader.readString();
+		entry.locationName = reader.readString();
+		valid = reader.isValid();
+		aEntries.push_back(entry);
+	}
+	Platform::unmapFile(data, size);
+	if (!valid) {
+		aEntries.clear();
+	}
+	return valid;
+}
+
+bool SaveIndex::write(const std::string& aPath, const std::vector<Entry>& aEntries) {
+	std::string body;
+	for (const Entry& entry : aEntries) {
+		appendU32(body, static_cast<std::uint32_t>(entry.slot));
+		appendU32(body, static_cast<std::uint32_t>(entry.level));
+		appendU32(body, static_cast<std::uint32_t>(entry.chapter));
+		appendU32(body, static_cast<std::uint32_t>(entry.playtimeSeconds));
+		appendU32(body, static_cast<std::uint32_t>(static_cast<std::uint64_t>(entry.savedAt) & 0xFFFFFFFFu));
+		appendU32(body, static_cast<std::uint32_t>(static_cast<std::uint64_t>(entry.savedAt) >> 32));
+		appendString(body, entry.playerName);
+		appendString(body, entry.locationName);
+	}
+
+	std::string file(INDEX_MAGIC, sizeof(INDEX_MAGIC));
+	appendU32(file, INDEX_VERSION);
+	appendU32(file, static_cast<std::uint32_t>(aEntries.size()));
+	appendU32(file, checksum(body.data(), body.size()));
+	file += body;
+	return Platform::replaceFile(aPath, file.data(), file.size(), false); // Rebuilt from the slots if a crash damages it
+}
+
+bool SaveIndex::update(const std::string& aPath, const Entry& aEntry) {
+	return update(aPath, std::vector<Entry>(1, aEntry));
+}
+
+bool SaveIndex::update(const std::string& aPath, const std::vector<Entry>& aEntries) {
+	std::vector<Entry> entries;
+	if (!load(aPath, entries)) {
+		std::remove(aPath.c_str());
+		return false;
+	}
+
+	for (const Entry& entry : aEntries) {
+		auto position = std::lower_bound(entries.begin(), entries.end(), entry.slot,
+			[](const Entry& aExisting, int aSlot) { return aExisting.slot < aSlot; });
+		if (position != entries.end() && position->slot == entry.slot) {
+			*position = entry;
+		}
+		else {
+			entries.insert(position, entry);
+		}
+	}
+	if (!write(aPath, entries)) {
+		std::remove(aPath.c_str());
+		return false;
+	}
+	return true;
+}
+
+bool SaveIndex::remove(const std::string& aPath, int aSlot) {
+	std::vector<Entry> entries;
+	if (!load(aPath, entries)) {
+		std::remove(aPath.c_str());
+		return false;
+	}
+
+	entries.erase(std::remove_if(entries.begin(), entries.end(),
+		[aSlot](const Entry& aEntry) { return aEntry.slot == aSlot; }), entries.end());
+	if (!write(aPath, entries)) {
+		std::remove(aPath.c_str());
+		return false;
+	}
+	return true;
+}
@@ -0,0 +1,46 @@
+#ifndef SAVEINDEX_H
+#define SAVEINDEX_H
+#include "SaveData.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// What the load screen shows for every occupied slot, in one small file beside them
+// (save_index.dat), so listing slots is a single read instead of opening each save.
+// Rewritten whole after saves and deletes, through a temp file but without flushing it to disk:
+// it is only a cache of the slots. A power cut may leave it a save behind, until the slot's next
+// save, or damaged, and then it is rebuilt from the slots. Little-endian:
+//   Header  magic "OBSI", version, entry count, checksum (FNV-1a over the entries)
+//   Entry   slot, level, chapter, playtime in seconds, save time (Unix seconds, 64-bit),
+//           then the player name and location name as { length, bytes }
+// A missing or damaged index is rebuilt from the slots themselves (see GameEngine).
+class SaveIndex {
+public:
+	struct Entry {
+		int slot;
+		std::string playerName;
+		int level;
+		int chapter;
+		std::string locationName;
+		int playtimeSeconds;
+		std::int64_t savedAt; // 0 if unknown (a slot the index was rebuilt from)
+
+		// Constructor
+		Entry();
+	};
+
+	// The entry for a slot holding aData, saved at aSavedAt
+	static Entry describe(int aSlot, const SaveData& aData, std::int64_t aSavedAt);
+
+	// Every entry, by slot; false if the index is missing or damaged
+	static bool load(const std::string& aPath, std::vector<Entry>& aEntries);
+	static bool write(const std::string& aPath, const std::vector<Entry>& aEntries);
+
+	// Replace or drop one slot's entry. Without a readable index there is nothing to update, so
+	// the file is removed instead and the next listing rebuilds it.
+	static bool update(const std::string& aPath, const Entry& aEntry);
+	static bool update(const std::string& aPath, const std::vector<Entry>& aEntries); // Several slots, one rewrite
+	static bool remove(const std::string& aPath, int aSlot);
+};
+
+#endif /* SAVEINDEX_H */
@@ -0,0 +1,156 @@
+#include "SaveJournal.h"
+#include "Platform.h"
+#include "SaveDiff.h"
+#include "SaveFile.h"
+#include "SaveIndex.h"
+#include <cstdio>
+#include <ctime>
+#include <sstream>
+
+namespace {
+
+const char JOURNAL_MAGIC[4] = { 'O', 'B', 'J', 'L' };
+const std::uint32_t JOURNAL_VERSION = 1;
+const std::size_t HEADER_SIZE = 16;
+const std::size_t ENTRY_HEADER_SIZE = 8;
+
+std::uint32_t checksum(const char* aData, std::size_t aLength) {
+	std::uint32_t hash = 2166136261u;
+	for (std::size_t i = 0; i < aLength; ++i) {
+		hash = (hash ^ static_cast<unsigned char>(aData[i])) * 16777619u;
+	}
+	return hash;
+}
+
+void appendU32(std::string& aOut, std::uint32_t aValue) {
+	for (int i = 0; i < 4; ++i) {
+		aOut += static_cast<char>((aValue >> (8 * i)) & 0xFF);
+	}
+}
+
+std::uint32_t readU32(const char* aData) {
+	std::uint32_t value = 0;
+	for (int i = 0; i < 4; ++i) {
+		value |= static_cast<std::uint32_t>(static_cast<unsigned char>(aData[i])) << (8 * i);
+	}
+	return value;
+}
+
+}
+
+bool SaveJournal::writeSnapshot(const std::string& aPath, const std::string& aJournalPath, const SaveData& aData, bool aCompress) {
+	std::uint32_t snapshotChecksum = 0;
+	if (!SaveFile::write(aPath, aData, &snapshotChecksum, aCompress)) {
+		return false;
+	}
+
+	// A crash before this point leaves the old journal, which no longer matches and is skipped
+	std::string header(JOURNAL_MAGIC, sizeof(JOURNAL_MAGIC));
+	appendU32(header, JOURNAL_VERSION);
+	appendU32(header, snapshotChecksum);
+	appendU32(header, 0);
+	return Platform::replaceFile(aJournalPath, header.data(), header.size());
+}
+
+bool SaveJournal::appendDelta(const std::string& aJournalPath, const SaveData& aBase, const SaveData& aData) {
+	SaveDiff diff = SaveDiff::compute(aBase, aData);
+	if (diff.isEmpty()) {
+		return true;
+	}
+
+	std::ostringstream text;
+	diff.write(text);
+	std::string payload = text.str();
+	std::string entry;
+	entry.reserve(ENTRY_HEADER_SIZE + payload.size());
+	appendU32(entry, static_cast<std::uint32_t>(payload.size()));
+	appendU32(entry, checksum(payload.data(), payload.size()));
+	entry += payload;
+	return Platform::appendFile(aJournalPath, entry.data(), entry.size());
+}
+
+int SaveJournal::replay(const std::string& aJournalPath, std::uint32_t aSnapshotChecksum, SaveData& aData, bool& aIntact) {
+	aIntact = true;
+	std::size_t size = 0;
+	const char* data = Platform::mapFile(aJournalPath, size);
+	if (data == nullptr) {
+		return 0; // No journal (a slot from before journaling, or an empty file)
+	}
+	if (size < HEADER_SIZE || std::string(data, sizeof(JOURNAL_MAGIC)) != std::string(JOURNAL_MAGIC, sizeof(JOURNAL_MAGIC))
+		|| readU32(data + 4) != JOURNAL_VERSION) {
+		aIntact = false;
+		Platform::unmapFile(data, size);
+		return 0;
+	}
+	if (readU32(data + 8) != aSnapshotChecksum) {
+		Platform::unmapFile(data, size);
+		return 0; // Left over from before the last compaction
+	}
+
+	int applied = 0;
+	std::size_t offset = HEADER_SIZE;
+	while (offset < size) {
+		if (size - offset < ENTRY_HEADER_SIZE) {
+			aIntact = false;
+			break;
+		}
+		std::uint32_t length = readU32(data + offset);
+		std::uint32_t expected = readU32(data + offset + 4);
+		offset += ENTRY_HEADER_SIZE;
+		if (length > size - offset || checksum(data + offset, length) != expected) {
+			aIntact = false;
+			break;
+		}
+
+		std::istringstream text(std::string(data + offset, length));
+		offset += length;
+		SaveDiff diff;
+		std::string error;
+		SaveData next = aData;
+		if (!diff.read(text, error) || !diff.apply(next)) {
+			aIntact = false;
+			break;
+		}
+		aData = std::move(next);
+		applied++;
+	}
+	Platform::unmapFile(data, size);
+	return applied;
+}
+
+bool SaveJournal::hasEntries(const std::string& aJournalPath, std::uint32_t aSnapshotChecksum) {
+	std::size_t size = 0;
+	const char* data = Platform::mapFile(aJournalPath, size);
+	if (data == nullptr) {
+		return false;
+	}
+	bool entries = size > HEADER_SIZE && readU32(data + 8) == aSnapshotChecksum;
+	Platform::unmapFile(data, size);
+	return entries;
+}
+
+// Constructor
+SaveSlotWrite::SaveSlotWrite() : slot(0), delta(false), compress(false) {
+}
+
+bool SaveSlotWrite::perform() const {
+	if (delta) {
+		if (!SaveJournal::appendDelta(journalPath, base, data)) {
+			return false;
+		}
+	}
+	else {
+		if (!SaveJournal::writeSnapshot(path, journalPath, data, compress)) {
+			return false;
+		}
+		if (!supersededPath.empty()) {
+			std::remove(supersededPath.c_str());
+		}
+	}
+
+	// The slot is safe either way; an index that cannot be updated is dropped and rebuilt later
+	if (!indexPath.empty()) {
+		SaveIndex::update(indexPath, SaveIndex::describe(slot, data, static_cast<std::int64_t>(std::time(nullptr))));
+	}
+	return true;
+}
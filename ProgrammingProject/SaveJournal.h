@@ -0,0 +1,55 @@
+#ifndef SAVEJOURNAL_H
+#define SAVEJOURNAL_H
+#include "SaveData.h"
+#include <cstdint>
+#include <string>
+
+// Append-only log of what changed between saves of one slot (save_slot_N.journal), on top of
+// the slot's last full snapshot (save_slot_N.sav). Each entry is a SaveDiff: items added or
+// removed, clues collected, skills levelled, the location changed. A save then writes only what
+// changed since the previous one, and a save cut short by a crash loses only its own entry.
+//
+// Layout, little-endian:
+//   Header  magic "OBJL", version, checksum of the snapshot the journal extends, reserved
+//   Entry   payload length, FNV-1a of the payload, payload (SaveDiff text form)
+// Compaction writes a fresh snapshot and then starts an empty journal for it. A journal whose
+// snapshot checksum no longer matches was already folded into the snapshot and is ignored.
+class SaveJournal {
+public:
+	static const int COMPACT_AFTER = 32; // Entries before the next save is a full snapshot
+
+	// Full save: aData as a new snapshot (compressed if aCompress), then an empty journal bound to it
+	static bool writeSnapshot(const std::string& aPath, const std::string& aJournalPath, const SaveData& aData, bool aCompress = false);
+
+	// Delta save: the changes from aBase (what the slot holds) to aData appended to the journal;
+	// false if there is no journal to append to. Nothing is written if nothing changed.
+	static bool appendDelta(const std::string& aJournalPath, const SaveData& aBase, const SaveData& aData);
+
+	// Bring aData, read from the snapshot with aSnapshotChecksum, up to date. Returns the number of
+	// entries applied; aIntact is false if the journal ends in a torn or damaged entry (a crash
+	// mid-append), which is dropped along with anything after it.
+	static int replay(const std::string& aJournalPath, std::uint32_t aSnapshotChecksum, SaveData& aData, bool& aIntact);
+
+	// Whether the journal holds changes on top of the snapshot with aSnapshotChecksum
+	static bool hasEntries(const std::string& aJournalPath, std::uint32_t aSnapshotChecksum);
+};
+
+// One write to a save slot, made on the spot or handed to a SaveWriter
+struct SaveSlotWrite {
+	std::string path; // Snapshot, save_slot_N.sav
+	std::string journalPath;
+	std::string supersededPath; // Removed once a snapshot lands (a legacy text slot)
+	std::string indexPath; // Slot listing to update once the write lands, if any
+	int slot;
+	bool delta; // Append base -> data to the journal rather than write a snapshot
+	bool compress; // Write a snapshot compressed
+	SaveData base;
+	SaveData data;
+
+	// Constructor
+	SaveSlotWrite();
+
+	bool perform() const;
+};
+
+#endif /* SAVEJOURNAL_H */
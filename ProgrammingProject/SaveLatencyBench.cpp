@@ -0,0 +1,174 @@
+#include "ContentPack.h"
+#include "GameEngine.h"
+#include "GameSession.h"
+#include "GameplayEngine.h"
+#include "Platform.h"
+#include "Player.h"
+#include "SaveWriter.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <streambuf>
+#include <string>
+#include <thread>
+#include <vector>
+
+// How long a save holds up the game thread: GameEngine::saveGame timed from the caller's side,
+// writing the slot itself and handing it to a SaveWriter. Each save changes the player a little,
+// as play between saves would, so most are journal appends and every so often a compaction.
+// Run from ProgrammingProject/ so Content/ resolves; slots go to a scratch directory.
+
+namespace {
+
+// Swallows the game's output while it is being timed
+class NullOutput : public std::streambuf {
+protected:
+	int_type overflow(int_type aCharacter) override {
+		return traits_type::not_eof(aCharacter);
+	}
+};
+
+struct Latencies {
+	std::vector<double> microseconds; // One per save, as the game thread saw it
+	double drainMicroseconds; // Waiting for the writer to finish after the last save
+	bool failed;
+};
+
+Latencies runSaves(GameSession& aSession, SaveWriter* aWriter, long long aSaves, int aIntervalMs) {
+	Latencies result;
+	result.drainMicroseconds = 0.0;
+	result.failed = false;
+
+	GameEngine& engine = aSession.getGameEngine();
+	std::string directory = Platform::createTemporaryDirectory();
+	if (directory.empty()) {
+		result.failed = true;
+		return result;
+	}
+	engine.setSaveDirectory(directory);
+	engine.setSaveWriter(aWriter);
+	Player* player = engine.startScriptedGame("Benchmark");
+
+	for (long long i = 0; i < aSaves; ++i) {
+		player->setHunger(static_cast<int>(100 - i % 100));
+		player->setXP(static_cast<int>(i % 100));
+
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		bool saved = engine.saveGame(player, 1);
+		result.microseconds.push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count());
+		result.failed = result.failed || !saved;
+
+		if (aIntervalMs > 0) {
+			std::this_thread::sleep_for(std::chrono::milliseconds(aIntervalMs));
+		}
+	}
+
+	if (aWriter != nullptr) {
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		aWriter->flush();
+		result.drainMicroseconds = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+		result.failed = result.failed || aWriter->getFailedCount() > 0;
+	}
+
+	// The session keeps pointing at the game, but the player is ours
+	aSession.getGameplayEngine().initialize(nullptr, nullptr, nullptr);
+	delete player;
+	engine.setSaveWriter(nullptr);
+	engine.setSaveDirectory(std::string());
+	Platform::removeDirectoryTree(directory);
+	return result;
+}
+
+void report(const char* aName, Latencies& aLatencies) {
+	std::vector<double>& samples = aLatencies.microseconds;
+	std::sort(samples.begin(), samples.end());
+	double total = 0.0;
+	for (double sample : samples) {
+		total += sample;
+	}
+	std::size_t count = samples.size();
+	std::cout << "  " << std::left << std::setw(20) << aName << std::right << std::fixed << std::setprecision(1)
+		<< std::setw(10) << total / count
+		<< std::setw(10) << samples[count / 2]
+		<< std::setw(10) << samples[std::min(count - 1, count * 99 / 100)]
+		<< std::setw(10) << samples.back()
+		<< std::setw(12) << aLatencies.drainMicroseconds / 1000.0 << "\n";
+}
+
+void printUsage() {
+	std::cerr << "Usage: save_latency_bench [options]\n"
+		<< "  --saves N      Saves per mode, all to one slot (default 500)\n"
+		<< "  --interval N   Milliseconds of play between saves (default 0)\n";
+}
+
+bool parseInteger(const char* aText, long long& aValue) {
+	char* end = nullptr;
+	aValue = std::strtoll(aText, &end, 10);
+	return end != aText && *end == '\0';
+}
+
+}
+
+int main(int argc, char* argv[]) {
+	long long saves = 500;
+	long long interval = 0;
+
+	for (int i = 1; i < argc; ++i) {
+		std::string option = argv[i];
+		bool valid = true;
+
+		if (option == "--help" || option == "-h") {
+			printUsage();
+			return 0;
+		}
+		else if (option == "--saves") {
+			valid = i + 1 < argc && parseInteger(argv[++i], saves) && saves > 0;
+		}
+		else if (option == "--interval") {
+			valid = i + 1 < argc && parseInteger(argv[++i], interval) && interval >= 0 && interval <= 10000;
+		}
+		else {
+			valid = false;
+		}
+
+		if (!valid) {
+			std::cerr << "Invalid option: " << option << "\n";
+			printUsage();
+			return 1;
+		}
+	}
+
+	ContentPack content;
+	if (!content.load()) {
+		std::cerr << "Failed to load content: " << content.getLastError() << "\n";
+		return 1;
+	}
+	GameSession session(nullptr, &content);
+	if (!session.initialize()) {
+		std::cerr << "Failed to build the world\n";
+		return 1;
+	}
+
+	NullOutput discard;
+	std::streambuf* console = std::cout.rdbuf(&discard);
+	Latencies direct = runSaves(session, nullptr, saves, static_cast<int>(interval));
+	Latencies background;
+	{
+		SaveWriter writer;
+		background = runSaves(session, &writer, saves, static_cast<int>(interval));
+	}
+	std::cout.rdbuf(console);
+
+	if (direct.failed || background.failed) {
+		std::cerr << "A save failed; no timings\n";
+		return 1;
+	}
+
+	std::cout << saves << " saves per mode, " << interval << " ms of play between saves\n";
+	std::cout << "  game thread, us            mean       p50       p99       max    drain ms\n";
+	report("written in place", direct);
+	report("background writer", background);
+	return 0;
+}
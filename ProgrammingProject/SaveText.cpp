@@ -0,0 +1,201 @@
+#include "SaveText.h"
+#include <cstdlib>
+#include <fstream>
+#include <limits>
+
+namespace {
+
+const char* const TEXT_HEADER = "OUTBREAK SAVE 2";
+
+// Split a legacy record on '|' in one pass
+std::vector<std::string> splitFields(const std::string& aLine) {
+	std::vector<std::string> fields;
+	std::size_t start = 0;
+	std::size_t pipe;
+	while ((pipe = aLine.find('|', start)) != std::string::npos) {
+		fields.push_back(aLine.substr(start, pipe - start));
+		start = pipe + 1;
+	}
+	fields.push_back(aLine.substr(start));
+	return fields;
+}
+
+}
+
+// ============================================================================
+// TEXT FORMAT
+// ============================================================================
+
+std::string SaveText::escape(const std::string& aValue) {
+	std::string result;
+	result.reserve(aValue.size());
+	for (char c : aValue) {
+		if (c == '\\') result += "\\\\";
+		else if (c == '\n') result += "\\n";
+		else if (c == '\r') result += "\\r";
+		else result += c;
+	}
+	return result;
+}
+
+std::string SaveText::unescape(const std::string& aValue) {
+	std::string result;
+	result.reserve(aValue.size());
+	for (size_t i = 0; i < aValue.size(); i++) {
+		if (aValue[i] != '\\' || i + 1 == aValue.size()) {
+			result += aValue[i];
+			continue;
+		}
+		char next = aValue[++i];
+		result += next == 'n' ? '\n' : next == 'r' ? '\r' : next;
+	}
+	return result;
+}
+
+void SaveText::write(std::ostream& aOut, const SaveData& aData) {
+	aOut << TEXT_HEADER << '\n';
+	for (const SaveSection& section : aData.toDocument()) {
+		for (const SaveFieldList& record : section.records) {
+			aOut << '[' << section.name << "]\n";
+			for (const auto& field : record) {
+				aOut << field.first << '=' << escape(field.second) << '\n';
+			}
+		}
+	}
+}
+
+bool SaveText::read(std::istream& aIn, SaveData& aData, std::string& aError) {
+	std::string line;
+	if (!std::getline(aIn, line) || line != TEXT_HEADER) {
+		aError = "not a text save (expected '" + std::string(TEXT_HEADER) + "').";
+		return false;
+	}
+
+	// Rebuild the document: repeated section headers are elements of the same list
+	SaveDocument document;
+	SaveFieldList* record = nullptr;
+	int lineNumber = 1;
+	while (std::getline(aIn, line)) {
+		lineNumber++;
+		if (!line.empty() && line.back() == '\r') {
+			line.pop_back();
+		}
+		if (line.empty()) {
+			continue;
+		}
+		if (line.front() == '[' && line.back() == ']') {
+			std::string name = line.substr(1, line.size() - 2);
+			SaveSection* section = nullptr;
+			for (SaveSection& existing : document) {
+				if (existing.name == name) section = &existing;
+			}
+			if (section == nullptr) {
+				document.push_back(SaveSection{ name, true, std::vector<SaveFieldList>() });
+				section = &document.back();
+			}
+			section->records.emplace_back();
+			record = &section->records.back();
+			continue;
+		}
+		std::size_t equals = line.find('=');
+		if (record == nullptr || equals == std::string::npos) {
+			aError = "line " + std::to_string(lineNumber) + ": expected [section] or name=value.";
+			return false;
+		}
+		record->emplace_back(line.substr(0, equals), unescape(line.substr(equals + 1)));
+	}
+
+	if (!aData.fromDocument(document)) {
+		aError = "a field value does not parse.";
+		return false;
+	}
+	return true;
+}
+
+// ============================================================================
+// LEGACY TEXT SAVES
+// ============================================================================
+
+bool SaveText::readLegacy(const std::string& aPath, SaveData& aData) {
+	std::ifstream file(aPath);
+	if (!file.is_open()) {
+		return false;
+	}
+	const std::streamsize rest = std::numeric_limits<std::streamsize>::max();
+
+	int locationVisited = 0;
+	int inventorySize = 0;
+	std::getline(file, aData.player.name);
+	std::getline(file, aData.player.id);
+	file >> aData.player.level >> aData.player.damage >> aData.player.health >> aData.player.maxHealth;
+	file.ignore(rest, '\n');
+	std::getline(file, aData.progress.locationID);
+	std::getline(file, aData.progress.locationName);
+	file >> locationVisited >> aData.progress.chapter >> aData.progress.explorationProgress >> aData.progress.movementSteps;
+	file.ignore(rest, '\n');
+	std::getline(file, aData.player.equippedWeapon);
+	file >> aData.player.experience >> aData.player.skillPoints >> inventorySize;
+	file.ignore(rest, '\n');
+	aData.progress.locationVisited = locationVisited != 0;
+	if (!file || inventorySize < 0) {
+		return false;
+	}
+
+	aData.inventory.clear();
+	for (int i = 0; i < inventorySize; i++) {
+		std::string line;
+		std::getline(file, line);
+		std::vector<std::string> fields = splitFields(line);
+		if (fields.size() != 12) {
+			continue; // The old loader skipped malformed items too
+		}
+		SaveData::ItemRecord item;
+		item.id = fields[0];
+		item.name = fields[1];
+		item.category = std::atoi(fields[2].c_str());
+		item.description = fields[3];
+		item.quantity = std::atoi(fields[4].c_str());
+		item.inventorySpace = std::atoi(fields[5].c_str());
+		item.consumable = std::atoi(fields[6].c_str()) != 0;
+		item.usable = std::atoi(fields[7].c_str()) != 0;
+		item.healthRestore = std::atoi(fields[8].c_str());
+		item.hungerRestore = std::atoi(fields[9].c_str());
+		item.infectionCure = std::atoi(fields[10].c_str());
+		item.damageBoost = std::atoi(fields[11].c_str());
+		aData.inventory.push_back(item);
+	}
+
+	int count = 0;
+	file >> count;
+	file.ignore(rest, '\n');
+	aData.pickedUpLootIDs.clear();
+	for (int i = 0; i < count && file; i++) {
+		std::string lootID;
+		std::getline(file, lootID);
+		aData.pickedUpLootIDs.push_back(lootID);
+	}
+
+	count = 0;
+	file >> count;
+	aData.clueIDs.clear();
+	for (int i = 0; i < count && file; i++) {
+		int clueID;
+		if (file >> clueID) {
+			aData.clueIDs.push_back(clueID);
+		}
+	}
+
+	count = 0;
+	file >> count;
+	file.ignore(rest, '\n');
+	aData.skills.clear();
+	for (int i = 0; i < count && file; i++) {
+		std::string line;
+		std::getline(file, line);
+		std::size_t pipe = line.find('|');
+		if (pipe != std::string::npos) {
+			aData.skills.emplace_back(line.substr(0, pipe), std::atoi(line.c_str() + pipe + 1));
+		}
+	}
+	return true;
+}
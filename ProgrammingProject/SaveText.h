@@ -0,0 +1,29 @@
+#ifndef SAVETEXT_H
+#define SAVETEXT_H
+#include "SaveData.h"
+#include <istream>
+#include <ostream>
+#include <string>
+
+// Text form of a save, for inspecting and hand-editing slots:
+//   OUTBREAK SAVE 2
+//   [player]
+//   name=Alex
+//   ...
+//   [item]        one section per list element, in list order
+//   id=medkit
+// Values escape '\' as "\\" and line breaks as "\n". Also reads the line-oriented
+// save_slot_N.txt files written before the binary format.
+class SaveText {
+public:
+	static void write(std::ostream& aOut, const SaveData& aData);
+	static bool read(std::istream& aIn, SaveData& aData, std::string& aError);
+
+	// Read a save from before the binary format (save_slot_N.txt)
+	static bool readLegacy(const std::string& aPath, SaveData& aData);
+
+	static std::string escape(const std::string& aValue);
+	static std::string unescape(const std::string& aValue);
+};
+
+#endif /* SAVETEXT_H */
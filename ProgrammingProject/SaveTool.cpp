@@ -0,0 +1,169 @@
+#include "ContentPack.h"
+#include "SaveData.h"
+#include "SaveDiff.h"
+#include "SaveFile.h"
+#include "SaveJournal.h"
+#include "SaveText.h"
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+// Converts and compares save slots through the shared serializer: binary slots (.sav, with their
+// journal applied), the text form, and saves from before the binary format (.txt) are all read
+// into the same SaveData. Export fills in the item text a slot stores by reference from the
+// content pack, so run it from ProgrammingProject/ where Content/ resolves.
+
+namespace {
+
+void printUsage() {
+	std::cerr << "Usage: save_tool COMMAND ...\n"
+		<< "  export SAVE [OUT]        Write a save as text (to stdout without OUT)\n"
+		<< "  import TEXT SAVE         Write a text save as a binary slot\n"
+		<< "  compress SAVE OUT        Write a save as a compressed binary slot\n"
+		<< "  diff OLD NEW [OUT]       Write the changes between two saves\n"
+		<< "  patch SAVE DIFF OUT      Apply a diff to a save, writing a binary slot\n"
+		<< "SAVE may be a binary slot (its .journal applied), a text save or a legacy save_slot_N.txt.\n"
+		<< "export reads item names and descriptions from Content/, so run it from the game's directory.\n";
+}
+
+// Any of the three forms, told apart by their first bytes
+bool readAny(const std::string& aPath, SaveData& aData, std::string& aError) {
+	SaveFile saveFile;
+	if (saveFile.open(aPath, aError)) {
+		if (!saveFile.read(aData)) {
+			aError = "Save '" + aPath + "' has records out of bounds.";
+			return false;
+		}
+
+		// A slot's journal sits beside it: save_slot_N.sav, save_slot_N.journal
+		std::string::size_type extension = aPath.rfind(".sav");
+		if (extension != std::string::npos && extension + 4 == aPath.size()) {
+			bool intact = true;
+			std::string journalPath = aPath.substr(0, extension) + ".journal";
+			SaveJournal::replay(journalPath, saveFile.getChecksum(), aData, intact);
+			if (!intact) {
+				std::cerr << "Warning: " << journalPath << " ends in a damaged entry; it was dropped.\n";
+			}
+		}
+		return true;
+	}
+	std::ifstream file(aPath);
+	if (!file.is_open()) {
+		return false; // aError already says not found
+	}
+	std::string first;
+	std::getline(file, first);
+	file.seekg(0);
+	if (first.compare(0, 13, "OUTBREAK SAVE") == 0) {
+		std::string error;
+		if (!SaveText::read(file, aData, error)) {
+			aError = "Save '" + aPath + "': " + error;
+			return false;
+		}
+		return true;
+	}
+	if (!SaveText::readLegacy(aPath, aData)) {
+		aError = "Save '" + aPath + "' is not a save.";
+		return false;
+	}
+	return true;
+}
+
+bool writeOutput(const std::string& aPath, const std::string& aText) {
+	if (aPath.empty()) {
+		std::cout << aText;
+		return static_cast<bool>(std::cout);
+	}
+	std::ofstream file(aPath, std::ios::binary | std::ios::trunc);
+	file << aText;
+	return static_cast<bool>(file.flush());
+}
+
+}
+
+int main(int argc, char* argv[]) {
+	std::string command = argc > 1 ? argv[1] : "";
+	if (command == "--help" || command == "-h") {
+		printUsage();
+		return 0;
+	}
+
+	std::string error;
+	if (command == "export" && (argc == 3 || argc == 4)) {
+		SaveData data;
+		if (!readAny(argv[2], data, error)) {
+			std::cerr << error << "\n";
+			return 1;
+		}
+		ContentPack content;
+		if (!content.load()) {
+			std::cerr << "Failed to load content: " << content.getLastError() << "\n";
+			return 1;
+		}
+		data.resolveContent(content);
+		std::ostringstream text;
+		SaveText::write(text, data);
+		return writeOutput(argc == 4 ? argv[3] : "", text.str()) ? 0 : 1;
+	}
+	if (command == "import" && argc == 4) {
+		SaveData data;
+		if (!readAny(argv[2], data, error)) {
+			std::cerr << error << "\n";
+			return 1;
+		}
+		if (!SaveFile::write(argv[3], data)) {
+			std::cerr << "Failed to write " << argv[3] << "\n";
+			return 1;
+		}
+		return 0;
+	}
+	if (command == "compress" && argc == 4) {
+		SaveData data;
+		if (!readAny(argv[2], data, error)) {
+			std::cerr << error << "\n";
+			return 1;
+		}
+		if (!SaveFile::write(argv[3], data, nullptr, true)) {
+			std::cerr << "Failed to write " << argv[3] << "\n";
+			return 1;
+		}
+		return 0;
+	}
+	if (command == "diff" && (argc == 4 || argc == 5)) {
+		SaveData before;
+		SaveData after;
+		if (!readAny(argv[2], before, error) || !readAny(argv[3], after, error)) {
+			std::cerr << error << "\n";
+			return 1;
+		}
+		std::ostringstream text;
+		SaveDiff::compute(before, after).write(text);
+		return writeOutput(argc == 5 ? argv[4] : "", text.str()) ? 0 : 1;
+	}
+	if (command == "patch" && argc == 5) {
+		SaveData data;
+		SaveDiff diff;
+		std::ifstream diffFile(argv[3]);
+		if (!readAny(argv[2], data, error)) {
+			std::cerr << error << "\n";
+			return 1;
+		}
+		if (!diffFile.is_open() || !diff.read(diffFile, error)) {
+			std::cerr << "Diff '" << argv[3] << "': " << (error.empty() ? "not found." : error) << "\n";
+			return 1;
+		}
+		if (!diff.apply(data)) {
+			std::cerr << "Diff '" << argv[3] << "' does not apply to " << argv[2] << "\n";
+			return 1;
+		}
+		if (!SaveFile::write(argv[4], data)) {
+			std::cerr << "Failed to write " << argv[4] << "\n";
+			return 1;
+		}
+		return 0;
+	}
+
+	printUsage();
+	return 1;
+}
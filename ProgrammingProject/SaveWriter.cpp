@@ -0,0 +1,143 @@
+#include "SaveWriter.h"
+#include <ctime>
+#include <utility>
+#include <vector>
+
+// Constructor
+SaveWriter::SaveWriter()
+	: fWriting(false), fStopping(false), fWritten(0), fCoalesced(0), fFailed(0) {
+	fThread = std::thread(&SaveWriter::writerLoop, this);
+}
+
+void SaveWriter::submit(SaveSlotWrite aWrite) {
+	std::lock_guard<std::mutex> guard(fLock);
+	if (!aWrite.delta) {
+		// A snapshot holds everything queued before it for the slot
+		for (auto it = fPending.begin(); it != fPending.end();) {
+			if (it->path == aWrite.path) {
+				it = fPending.erase(it);
+				fCoalesced++;
+			}
+			else {
+				++it;
+			}
+		}
+	}
+	fPending.push_back(std::move(aWrite));
+	fWorkAvailable.notify_one();
+}
+
+bool SaveWriter::takeFailure(const std::string& aPath) {
+	std::lock_guard<std::mutex> guard(fLock);
+	return fFailedPaths.erase(aPath) > 0;
+}
+
+void SaveWriter::writerLoop() {
+	std::unique_lock<std::mutex> lock(fLock);
+	while (true) {
+		fWorkAvailable.wait(lock, [this] { return fStopping || !fPending.empty(); });
+		if (fPending.empty()) {
+			return; // Stopping, with everything written
+		}
+
+		SaveSlotWrite write = std::move(fPending.front());
+		fPending.pop_front();
+		fWriting = true;
+		fWritingPath = write.path;
+		std::string indexPath;
+		indexPath.swap(write.indexPath); // Updated below, batched with the writes queued behind
+		fWritingIndexPath = indexPath;
+
+		// A delta submitted after its slot's write failed (before the game heard of the failure)
+		// builds on changes the slot does not have: it never reaches the journal either
+		bool dropped = write.delta && fFailedPaths.count(write.path) > 0;
+		lock.unlock();
+
+		bool written = !dropped && write.perform();
+
+		lock.lock();
+		if (written) {
+			fWritten++;
+			if (!indexPath.empty()) {
+				fIndexUpdates[indexPath][write.slot] = SaveIndex::describe(write.slot, write.data, static_cast<std::int64_t>(std::time(nullptr)));
+			}
+		}
+		else {
+			// Journal entries behind a failed write would build on changes the slot does not have
+			fFailedPaths.insert(write.path);
+			fFailed++;
+			for (auto it = fPending.begin(); it != fPending.end();) {
+				it = it->path == write.path && it->delta ? fPending.erase(it) : it + 1;
+			}
+		}
+
+		// A burst of saves to one index (autosaves queued while the disk is busy) rewrites it once
+		auto updates = fIndexUpdates.find(indexPath);
+		bool queued = false;
+		for (const SaveSlotWrite& pending : fPending) {
+			queued = queued || pending.indexPath == indexPath;
+		}
+		if (updates != fIndexUpdates.end() && !queued) {
+			std::vector<SaveIndex::Entry> entries;
+			for (const auto& update : updates->second) {
+				entries.push_back(update.second);
+			}
+			fIndexUpdates.erase(updates);
+			lock.unlock();
+			SaveIndex::update(indexPath, entries);
+			lock.lock();
+		}
+
+		fWriting = false;
+		fWritingPath.clear();
+		fWritingIndexPath.clear();
+		fIdle.notify_all();
+	}
+}
+
+bool SaveWriter::isWriting(const std::string& aPath) const {
+	if (fWriting && (fWritingPath == aPath || fWritingIndexPath == aPath)) {
+		return true;
+	}
+	for (const SaveSlotWrite& pending : fPending) {
+		if (pending.path == aPath || pending.indexPath == aPath) {
+			return true;
+		}
+	}
+	return fIndexUpdates.count(aPath) > 0;
+}
+
+void SaveWriter::flush() {
+	std::unique_lock<std::mutex> lock(fLock);
+	fIdle.wait(lock, [this] { return fPending.empty() && !fWriting; });
+}
+
+void SaveWriter::flush(const std::string& aPath) {
+	std::unique_lock<std::mutex> lock(fLock);
+	fIdle.wait(lock, [this, &aPath] { return !isWriting(aPath); });
+}
+
+std::int64_t SaveWriter::getWrittenCount() {
+	std::lock_guard<std::mutex> guard(fLock);
+	return fWritten;
+}
+
+std::int64_t SaveWriter::getCoalescedCount() {
+	std::lock_guard<std::mutex> guard(fLock);
+	return fCoalesced;
+}
+
+std::int64_t SaveWriter::getFailedCount() {
+	std::lock_guard<std::mutex> guard(fLock);
+	return fFailed;
+}
+
+// Destructor
+SaveWriter::~SaveWriter() {
+	{
+		std::lock_guard<std::mutex> guard(fLock);
+		fStopping = true;
+	}
+	fWorkAvailable.notify_one();
+	fThread.join();
+}
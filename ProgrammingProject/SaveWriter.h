@@ -0,0 +1,68 @@
+#ifndef SAVEWRITER_H
+#define SAVEWRITER_H
+#include "SaveIndex.h"
+#include "SaveJournal.h"
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_set>
+
+// Background thread that encodes and writes save slots, so the game never waits on the disk:
+// the game thread captures a SaveData snapshot, hands it over and carries on. Writes are
+// SaveSlotWrites (a snapshot through temp file, flush and rename, or a journal append), made one
+// at a time in submission order. A new snapshot replaces whatever is still queued for its slot,
+// and the slot index is rewritten once the queue holds no more writes for it, not after each one.
+class SaveWriter {
+private:
+	std::deque<SaveSlotWrite> fPending;
+	std::mutex fLock;
+	std::condition_variable fWorkAvailable;
+	std::condition_variable fIdle;
+	bool fWriting;
+	std::string fWritingPath; // The slot being written, and the index it updates, while fWriting
+	std::string fWritingIndexPath;
+	bool fStopping;
+	std::map<std::string, std::map<int, SaveIndex::Entry>> fIndexUpdates; // By index path, then slot
+	std::unordered_set<std::string> fFailedPaths; // Slots whose write failed since their last takeFailure()
+	std::int64_t fWritten;
+	std::int64_t fCoalesced;
+	std::int64_t fFailed;
+	std::thread fThread;
+
+	void writerLoop();
+	bool isWriting(const std::string& aPath) const; // A slot or index path with writes queued or under way; fLock held
+
+public:
+	// Constructor (starts the writer thread)
+	SaveWriter();
+
+	SaveWriter(const SaveWriter&) = delete;
+	SaveWriter& operator=(const SaveWriter&) = delete;
+
+	void submit(SaveSlotWrite aWrite);
+
+	// Whether a write to the slot at aPath failed since the last call for it. A failed write drops
+	// the journal entries queued behind it, so the next save of that slot must be a snapshot.
+	// Failures are kept per slot: games sharing the writer only hear about their own.
+	bool takeFailure(const std::string& aPath);
+
+	// Block until everything submitted so far is on disk (before reading slots back)
+	void flush();
+
+	// Block only until the writes submitted so far for one slot, or for every slot one index
+	// covers, are on disk: a game reading its own slots back never waits on other games' saves
+	void flush(const std::string& aPath);
+
+	std::int64_t getWrittenCount();
+	std::int64_t getCoalescedCount();
+	std::int64_t getFailedCount();
+
+	// Destructor (writes what is still queued, then joins the thread)
+	~SaveWriter();
+};
+
+#endif /* SAVEWRITER_H */
@@ -0,0 +1,134 @@
+#include "ContentPack.h"
+#include "GameServer.h"
+#include <csignal>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <sys/resource.h>
+
+// Multi-session server: every TCP connection plays its own game of OUTBREAK.
+// Run from ProgrammingProject/ so Content/ resolves, then e.g. `telnet 127.0.0.1 4000`.
+
+namespace {
+
+volatile std::sig_atomic_t gStop = 0;
+
+void requestStop(int /*aSignal*/) {
+	gStop = 1;
+}
+
+void printUsage() {
+	std::cerr << "Usage: outbreak_server [options]\n"
+		<< "  --port N              TCP port (default 4000)\n"
+		<< "  --bind ADDRESS        IPv4 address to listen on (default 127.0.0.1)\n"
+		<< "  --max-connections N   Concurrent games (default 20000)\n"
+		<< "  --stats N             Print a status line every N seconds, 0 never (default 10)\n"
+		<< "  --record-dir DIR      Write each game's replay log to DIR/session_<n>.replay\n"
+		<< "  --profile-dir DIR     Keep each player's save slots under DIR (default profiles); player IDs\n"
+		<< "                        are not authenticated, anyone who connects can use any profile\n"
+		<< "  --shared-slots        One set of save slots in the working directory for every game\n"
+		<< "  --compress-saves      Write save slots compressed\n";
+}
+
+bool parseInteger(const char* aText, long long& aValue) {
+	char* end = nullptr;
+	aValue = std::strtoll(aText, &end, 10);
+	return end != aText && *end == '\0';
+}
+
+// Every connection is a descriptor, so lift the soft limit as far as the hard one allows
+void raiseDescriptorLimit() {
+	rlimit limit;
+	if (getrlimit(RLIMIT_NOFILE, &limit) == 0 && limit.rlim_cur < limit.rlim_max) {
+		limit.rlim_cur = limit.rlim_max;
+		setrlimit(RLIMIT_NOFILE, &limit);
+	}
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+	GameServer::Options options;
+	long long statsSeconds = 10;
+
+	for (int i = 1; i < argc; ++i) {
+		std::string option = argv[i];
+		bool hasValue = i + 1 < argc;
+		bool valid = true;
+		long long value = 0;
+
+		if (option == "--help" || option == "-h") {
+			printUsage();
+			return 0;
+		}
+		else if (option == "--shared-slots") {
+			options.profileDirectory.clear();
+		}
+		else if (option == "--compress-saves") {
+			options.compressSaves = true;
+		}
+		else if (!hasValue) {
+			valid = false;
+		}
+		else if (option == "--port") {
+			valid = parseInteger(argv[++i], value) && value > 0 && value < 65536;
+			options.port = static_cast<int>(value);
+		}
+		else if (option == "--bind") {
+			options.bindAddress = argv[++i];
+		}
+		else if (option == "--max-connections") {
+			valid = parseInteger(argv[++i], value) && value > 0;
+			options.maxConnections = static_cast<int>(value);
+		}
+		else if (option == "--stats") {
+			valid = parseInteger(argv[++i], statsSeconds) && statsSeconds >= 0;
+		}
+		else if (option == "--record-dir") {
+			options.recordDirectory = argv[++i];
+		}
+		else if (option == "--profile-dir") {
+			options.profileDirectory = argv[++i];
+			valid = !options.profileDirectory.empty();
+		}
+		else {
+			valid = false;
+		}
+
+		if (!valid) {
+			std::cerr << "Invalid option: " << option << "\n";
+			printUsage();
+			return 1;
+		}
+	}
+
+	ContentPack content;
+	if (!content.load()) {
+		std::cerr << "Failed to load content: " << content.getLastError() << "\n";
+		return 1;
+	}
+
+	raiseDescriptorLimit();
+	std::signal(SIGPIPE, SIG_IGN);
+	std::signal(SIGINT, requestStop);
+	std::signal(SIGTERM, requestStop);
+
+	GameServer server(content, options);
+	std::string error;
+	if (!server.start(error)) {
+		std::cerr << "Failed to start server: " << error << "\n";
+		return 1;
+	}
+
+	std::cout << "[SERVER] Listening on " << options.bindAddress << ":" << options.port << std::endl;
+	if (!options.profileDirectory.empty() && options.bindAddress.compare(0, 4, "127.") != 0) {
+		std::cout << "[SERVER] Warning: player IDs are not authenticated; anyone who can connect can load or overwrite any profile's saves" << std::endl;
+	}
+	server.run(gStop, static_cast<int>(statsSeconds));
+
+	const GameServer::Stats& stats = server.getStats();
+	std::cout << "[SERVER] Shutting down: " << stats.accepted << " accepted, " << stats.rejected << " rejected, "
+		<< stats.gamesFinished << " games finished, " << stats.bytesIn << " bytes in, "
+		<< stats.bytesOut << " bytes out" << std::endl;
+	return 0;
+}
@@ -2,27 +2,72 @@
 #define SINGLYLINKEDLIST_H
 #include "SinglyLinkedNode.h"
 #include "SinglyLinkedNodeIterator.h"
+#include "NodePool.h"
 
-template <class T>
+// Allocator supplies create/destroy for nodes (PoolAllocator or HeapAllocator from NodePool.h)
+template <class T, template <class> class Allocator = PoolAllocator>
 class SinglyLinkedList {
 private:
 	typedef SinglyLinkedNode<T> Node;
+	typedef Allocator<Node> NodeAllocator;
 	Node* head; // Track the first node
 	Node* last; // Track the last node
 	int count;
 
+	void linkBack(Node* newNode) {
+		if (!isEmpty()) { // List is not empty
+			last->next = newNode;
+			last = newNode;
+		}
+		else {
+			head = newNode;
+			last = newNode;
+		}
+		++count;
+	}
+
 public:
 	typedef SinglyLinkedNodeIterator<T> Iterator;
+	typedef SinglyLinkedNodeIterator<T, const T> ConstIterator;
+	typedef Iterator iterator;
+	typedef ConstIterator const_iterator;
 
 	// Constructor
 	SinglyLinkedList() : head(&Node::NIL), last(&Node::NIL), count(0) {}
 
+	// Copy constructor
+	SinglyLinkedList(const SinglyLinkedList& other) : head(&Node::NIL), last(&Node::NIL), count(0) {
+		for (Node* current = other.head; current != &Node::NIL; current = current->next) {
+			pushBack(current->value);
+		}
+	}
+
+	// Move constructor
+	SinglyLinkedList(SinglyLinkedList&& other) noexcept : head(other.head), last(other.last), count(other.count) {
+		other.head = &Node::NIL;
+		other.last = &Node::NIL;
+		other.count = 0;
+	}
+
+	// Copy and move assignment
+	SinglyLinkedList& operator=(SinglyLinkedList other) {
+		std::swap(head, other.head);
+		std::swap(last, other.last);
+		std::swap(count, other.count);
+		return *this;
+	}
+
 	// Destructor
 	~SinglyLinkedList() {
+		clear();
+	}
+
+	// Remove all nodes
+	void clear() {
 		Node* current = head;
 		while (current != &Node::NIL) {
 			Node* next = current->next;
-			delete current;
+			NodeAllocator::destroy(current);
 			current = next;
 		}
 		// Reset list
@@ -43,16 +88,19 @@ public:
 
 	// Insert at last
 	void pushBack(const T& value) {
-		Node* newNode = new Node(value);
-		if (!isEmpty()) { // List is not empty
-			last->next = newNode;
-			last = newNode;
-		}
-		else {
-			head = newNode;
-			last = newNode;
-		}
-		++count;
+		linkBack(NodeAllocator::create(value));
+	}
+
+	void pushBack(T&& value) {
+		linkBack(NodeAllocator::create(std::move(value)));
+	}
+
+	// Construct a new last element in place
+	template <class... Args>
+	T& emplaceBack(Args&&... args) {
+		Node* newNode = NodeAllocator::create(std::in_place, std::forward<Args>(args)...);
+		linkBack(newNode);
+		return newNode->value;
 	}
 
 	// Remove from back
@@ -62,7 +110,7 @@ public:
 		}
 
 		if (head == last) { // Only one element
-			delete head;
+			NodeAllocator::destroy(head);
 			head = &Node::NIL;
 			last = &Node::NIL;
 		}
@@ -73,7 +121,7 @@ public:
 				current = current->next;
 			}
 
-			delete last;
+			NodeAllocator::destroy(last);
 			last = current;
 			last->next = &Node::NIL;
 		}
@@ -102,7 +150,7 @@ public:
 						last = previous;
 					}
 				}
-				delete current;
+				NodeAllocator::destroy(current);
 				--count;
 				return true;
 			}
@@ -119,7 +167,7 @@ public:
 
 		Node* toDelete = head;
 		head = head->next;
-		delete toDelete;
+		NodeAllocator::destroy(toDelete);
 
 		if (head == &Node::NIL) { // List became empty
 			last = &Node::NIL;
@@ -136,12 +184,12 @@ public:
 	}
 
 	// Const versions for const iterators
-	Iterator begin() const {
-		return Iterator(head);
+	ConstIterator begin() const {
+		return ConstIterator(head);
 	}
 
-	Iterator end() const {
-		return Iterator(&Node::NIL);
+	ConstIterator end() const {
+		return ConstIterator(&Node::NIL);
 	}
 
 };
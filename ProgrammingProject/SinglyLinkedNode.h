@@ -1,5 +1,6 @@
 #ifndef SINGLYLINKEDNODE_H
 #define SINGLYLINKEDNODE_H
+#include <utility>
 
 template <class T>
 class SinglyLinkedNode { // Singly linked node
@@ -13,8 +14,13 @@ public:
 	// Constructor
 	SinglyLinkedNode() : value(T()), next(&NIL) {}
 
-	// Parameterised constructor
-	SinglyLinkedNode(T val) : value(val), next(&NIL) {}
+	// Parameterised constructors
+	SinglyLinkedNode(const T& val) : value(val), next(&NIL) {}
+	SinglyLinkedNode(T&& val) : value(std::move(val)), next(&NIL) {}
+
+	// Construct the value in place from its constructor arguments
+	template <class... Args>
+	SinglyLinkedNode(std::in_place_t, Args&&... args) : value(std::forward<Args>(args)...), next(&NIL) {}
 };
 
 template <class T>
@@ -1,14 +1,26 @@
 #ifndef SINGLYLINKEDNODEITERATOR_H
 #define SINGLYLINKEDNODEITERATOR_H
 #include "SinglyLinkedNode.h"
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
 
-template <class T>
+// ValueType is T for a mutable iterator and const T for a const iterator
+template <class T, class ValueType = T>
 class SinglyLinkedNodeIterator {
 private:
 	typedef SinglyLinkedNode<T> Node;
 	Node* current;
 
+	template <class, class> friend class SinglyLinkedNodeIterator;
+
 public:
+	typedef std::forward_iterator_tag iterator_category;
+	typedef T value_type;
+	typedef std::ptrdiff_t difference_type;
+	typedef ValueType* pointer;
+	typedef ValueType& reference;
+
 	// Constructor
 	SinglyLinkedNodeIterator(Node* startNode) : current(startNode) {}
 
@@ -17,6 +29,14 @@ public:
 		current = &node;
 	}
 
+	// Copy constructor and assignment
+	SinglyLinkedNodeIterator(const SinglyLinkedNodeIterator&) = default;
+	SinglyLinkedNodeIterator& operator=(const SinglyLinkedNodeIterator&) = default;
+
+	// Mutable iterators convert to const iterators
+	template <class OtherValue, class = typename std::enable_if<std::is_same<OtherValue, T>::value && !std::is_same<ValueType, T>::value>::type>
+	SinglyLinkedNodeIterator(const SinglyLinkedNodeIterator<T, OtherValue>& other) : current(other.current) {}
+
 	// Pre-increment operator
 	SinglyLinkedNodeIterator& operator++() {
 		current = current->next;
@@ -31,10 +51,14 @@ public:
 	}
 
 	// Dereference operator
-	T operator*() const {
+	reference operator*() const {
 		return current->value;
 	}
 
+	pointer operator->() const {
+		return &current->value;
+	}
+
 	// Equality operator
 	bool operator==(const SinglyLinkedNodeIterator& other) const {
 		return current == other.current;
@@ -46,9 +70,9 @@ public:
 	}
 
 	// Get current node
-	Node* getCurrent() {
+	Node* getCurrent() const {
 		return current;
 	}
 };
 
-#endif /* SINGLYLINKEDNODEITERATOR_H */
\ No newline at end of file
+#endif /* SINGLYLINKEDNODEITERATOR_H */
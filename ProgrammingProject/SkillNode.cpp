@@ -12,10 +12,10 @@ SkillNode::SkillNode()
 // Parameterised constructor
 SkillNode::SkillNode(const std::string& aID, const std::string& aName, const std::string& aDescription, SkillType aType, int aCost, int aMaxLevel)
 	: fSkillName(aName), fSkillDescription(aDescription), fType(aType),
-	  fCost(aCost), fLevel(0), fMaxLevel(aMaxLevel), fUnlocked(false),
+	  fCost(aCost), fLevel(0), fMaxLevel(aMaxLevel), fUnlocked(false), fSkillID(aID),
 	  fDamageBonus(0), fHealthBonus(0), fStaminaBonus(0),
 	  fInfectionResistance(0), fCraftingSpeedBonus(0.0f), fScavengeBonus(0.0f),
-	  fParent(nullptr), fSkillID(aID) {
+	  fParent(nullptr) {
 }
 
 // Destructor
@@ -53,7 +53,11 @@ std::string SkillNode::getSkillName() const {
 	return fSkillName;
 }
 
-std::string SkillNode::getSkillID() const {
+const std::string& SkillNode::getSkillID() const {
+	return fSkillID.str();
+}
+
+Symbol SkillNode::getSkillSymbol() const {
 	return fSkillID;
 }
 
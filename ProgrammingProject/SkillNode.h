@@ -3,6 +3,7 @@
 #include <iostream>
 #include <string>
 #include "SinglyLinkedList.h"
+#include "Symbol.h"
 
 class SkillNode {
 public:
@@ -25,7 +26,7 @@ private:
 	bool fUnlocked; // Is the skill unlocked?
 
 	// Store the skill ID for lookup
-	std::string fSkillID;
+	Symbol fSkillID;
 
 	// Stat bonuses provided by this skill
 	int fDamageBonus;
@@ -57,7 +58,8 @@ public:
 	const SinglyLinkedList<SkillNode*>& getChildren() const;
 
 	// Getter methods
-	std::string getSkillID() const;
+	const std::string& getSkillID() const;
+	Symbol getSkillSymbol() const;
 	std::string getSkillName() const;
 	std::string getSkillDescription() const;
 	SkillType getSkillType() const;
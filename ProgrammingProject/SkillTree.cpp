@@ -20,45 +20,52 @@ void SkillTree::initialiseDefaultTree() {
 	SkillNode* meleeBasics = new SkillNode("combat_melee_1", "Melee Combat", "Increases melee damage. +5 melee damage", SkillNode::SkillType::COMBAT, 1);
 	meleeBasics->setDamageBonus(5);
 	addRootSkill(meleeBasics);
-	fSkillLookup.insert("combat_melee_1", meleeBasics);
+	fSkillLookup.insert(meleeBasics->getSkillSymbol(), meleeBasics);
 
 	SkillNode* heavyHitter = new SkillNode("combat_melee_2", "Heavy Hitter", "Devastating strikes. +10 melee damage", SkillNode::SkillType::COMBAT, 2);
 	heavyHitter->setDamageBonus(10);
 	meleeBasics->addChild(heavyHitter);
-	fSkillLookup.insert("combat_melee_2", heavyHitter);
+	fSkillLookup.insert(heavyHitter->getSkillSymbol(), heavyHitter);
 
 	// Survival skill tree
 	SkillNode* resilience = new SkillNode("survival_health_1", "Resilience", "Tougher constitution. +20 max health", SkillNode::SkillType::SURVIVAL, 1);
 	resilience->setHealthBonus(20);
 	addRootSkill(resilience);
-	fSkillLookup.insert("survival_health_1", resilience);
+	fSkillLookup.insert(resilience->getSkillSymbol(), resilience);
 
 	SkillNode* ironBody = new SkillNode("survival_health_2", "Iron Body", "Infection resistance. +30% infection resistance", SkillNode::SkillType::SURVIVAL, 2);
 	ironBody->setInfectionResistance(30);
 	resilience->addChild(ironBody);
-	fSkillLookup.insert("survival_health_2", ironBody);
+	fSkillLookup.insert(ironBody->getSkillSymbol(), ironBody);
 
 	// Medical skill tree
 	SkillNode* firstAid = new SkillNode("medical_heal_1", "First Aid", "Better healing. +50% medkit effectiveness", SkillNode::SkillType::MEDICAL, 1);
 	addRootSkill(firstAid);
-	fSkillLookup.insert("medical_heal_1", firstAid);
+	fSkillLookup.insert(firstAid->getSkillSymbol(), firstAid);
 
 	// Scavenging skill tree
 	SkillNode* scavenger = new SkillNode("scavenge_loot_1", "Scavenger", "Find more items. +25% loot quality", SkillNode::SkillType::SCAVENGING, 1);
 	scavenger->setScavengeBonus(0.25f);
 	addRootSkill(scavenger);
-	fSkillLookup.insert("scavenge_loot_1", scavenger);
+	fSkillLookup.insert(scavenger->getSkillSymbol(), scavenger);
 
 	// Crafting skill tree
 	SkillNode* resourceful = new SkillNode("craft_efficiency_1", "Resourceful", "Efficient crafting. -25% material cost", SkillNode::SkillType::CRAFTING, 1);
 	resourceful->setCraftingSpeedBonus(0.25f);
 	addRootSkill(resourceful);
-	fSkillLookup.insert("craft_efficiency_1", resourceful);
+	fSkillLookup.insert(resourceful->getSkillSymbol(), resourceful);
 }
 
 // Skill management
-bool SkillTree::unlockSkill(const std::string& skillName) {
-	SkillNode* skill = getSkill(skillName);
+bool SkillTree::unlockSkill(std::string_view skillName) {
+	return unlockSkill(getSkill(skillName));
+}
+
+bool SkillTree::unlockSkill(const SkillKey& skillKey) {
+	return unlockSkill(getSkill(skillKey));
+}
+
+bool SkillTree::unlockSkill(SkillNode* skill) {
 	if (skill == nullptr) {
 		return false; // Skill not found
 	}
@@ -76,8 +83,15 @@ bool SkillTree::unlockSkill(const std::string& skillName) {
 	return true;
 }
 
-bool SkillTree::levelUpSkill(const std::string& skillName) {
-	SkillNode* skill = getSkill(skillName);
+bool SkillTree::levelUpSkill(std::string_view skillName) {
+	return levelUpSkill(getSkill(skillName));
+}
+
+bool SkillTree::levelUpSkill(const SkillKey& skillKey) {
+	return levelUpSkill(getSkill(skillKey));
+}
+
+bool SkillTree::levelUpSkill(SkillNode* skill) {
 	if (skill == nullptr) {
 		return false; // Skill not found
 	}
@@ -95,14 +109,26 @@ bool SkillTree::levelUpSkill(const std::string& skillName) {
 	return true;
 }
 
-SkillNode* SkillTree::getSkill(const std::string& skillName) const {
-	SkillNode** result = fSkillLookup.search(skillName);
+SkillNode* SkillTree::getSkill(std::string_view skillName) const {
+	SkillNode** result = fSkillLookup.search(Symbol::find(skillName));
+	if (result != nullptr) {
+		return *result;
+	}
+	return nullptr;
+}
+
+SkillNode* SkillTree::getSkill(const SkillKey& skillKey) const {
+	SkillNode** result = fSkillLookup.search(skillKey);
 	if (result != nullptr) {
 		return *result;
 	}
 	return nullptr;
 }
 
+SkillTree::SkillKey SkillTree::makeSkillKey(std::string_view skillName) {
+	return Symbol::find(skillName);
+}
+
 // Skill point management
 void SkillTree::addSkillPoints(int aPoints) {
 	fAvailablePoints += aPoints;
@@ -243,7 +269,7 @@ void SkillTree::countUnlockedRecursive(SkillNode* aNode, int& count) const {
 	}
 }
 
-bool SkillTree::hasUnlockedSkill(const std::string& skillName) const {
+bool SkillTree::hasUnlockedSkill(std::string_view skillName) const {
 	SkillNode* skill = getSkill(skillName);
 	if (skill != nullptr) {
 		return skill->isUnlocked();
@@ -251,6 +277,14 @@ bool SkillTree::hasUnlockedSkill(const std::string& skillName) const {
 	return false;
 }
 
+bool SkillTree::hasUnlockedSkill(const SkillKey& skillKey) const {
+	SkillNode* skill = getSkill(skillKey);
+	if (skill != nullptr) {
+		return skill->isUnlocked();
+	}
+	return false;
+}
+
 // Helper function to traverse tree and collect unlocked skills
 void getUnlockedSkillsRecursive(SkillNode* node, std::vector<std::string>& skillIDs, std::vector<int>& levels) {
 	if (node == nullptr) {
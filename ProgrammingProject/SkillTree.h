@@ -3,13 +3,18 @@
 #include "SkillNode.h"
 #include "HashTable.h"
 #include "SinglyLinkedList.h"
+#include "Symbol.h"
 #include <string>
+#include <string_view>
 #include <vector>
 
 class SkillTree {
+public:
+	typedef Symbol SkillKey; // Interned skill ID, compared without touching the text
+
 private:
 	SinglyLinkedList<SkillNode*> fRootSkills; // Top-level skills
-	HashTable<std::string, SkillNode*> fSkillLookup; // Map skill names to nodes for quick lookup
+	HashTable<Symbol, SkillNode*> fSkillLookup; // Map skill IDs to nodes for quick lookup
 	int fAvailablePoints; // Points available to spend
 
 	// Helper for tree traversal
@@ -18,6 +23,8 @@ private:
 		int& totalStamina, int& totalInfection, int& totalCrafting,
 		float& totalCraftingFloat, float& totalScavenge) const;
 	void countUnlockedRecursive(SkillNode* aNode, int& count) const;
+	bool unlockSkill(SkillNode* skill);
+	bool levelUpSkill(SkillNode* skill);
 
 public:
 	// Constructor
@@ -33,9 +40,15 @@ public:
 	void initialiseDefaultTree();
 
 	// Skill management
-	bool unlockSkill(const std::string& skillName);
-	bool levelUpSkill(const std::string& skillName);
-	SkillNode* getSkill(const std::string& skillName) const;
+	bool unlockSkill(std::string_view skillName);
+	bool unlockSkill(const SkillKey& skillKey);
+	bool levelUpSkill(std::string_view skillName);
+	bool levelUpSkill(const SkillKey& skillKey);
+	SkillNode* getSkill(std::string_view skillName) const;
+	SkillNode* getSkill(const SkillKey& skillKey) const;
+
+	// Resolve a skill ID once so repeated lookups skip hashing the text
+	static SkillKey makeSkillKey(std::string_view skillName);
 
 	// Skill point management
 	void addSkillPoints(int aPoints);
@@ -56,7 +69,8 @@ public:
 
 	// Utility
 	int getTotalUnlockedSkills() const;
-	bool hasUnlockedSkill(const std::string& skillName) const;
+	bool hasUnlockedSkill(std::string_view skillName) const;
+	bool hasUnlockedSkill(const SkillKey& skillKey) const;
 
 	// Save/Load support
 	void getUnlockedSkillData(std::vector<std::string>& skillIDs, std::vector<int>& levels) const;
@@ -1,13 +1,14 @@
 #ifndef STACK_H
 #define STACK_H
-#include "SinglyLinkedList.h"
+#include <vector>
 #include <stdexcept>
+#include <utility>
 
+// LIFO stack over a contiguous vector; push, pop and top are all O(1)
 template <class T>
 class Stack {
 private:
-	typedef DoublyLinkedList<T> List;
-	List fElements;
+	std::vector<T> fElements; // Bottom of the stack at index 0
 	size_t maxSize; // Maximum size of the stack
 
 public:
@@ -15,45 +16,68 @@ public:
 	Stack(size_t maxSize = 1000) : maxSize(maxSize) {}
 
 	bool isEmpty() const {
-		return fElements.isEmpty();
+		return fElements.empty();
 	}
 
 	int size() const {
-		return fElements.size();
+		return static_cast<int>(fElements.size());
 	}
 
 	bool isFull() const {
-		return size() >= maxSize;
+		return fElements.size() >= maxSize;
 	}
 
 	void push(const T& value) {
 		if (isFull()) {
 			throw std::overflow_error("Stack overflow: cannot push to a full stack.");
 		}
-		fElements.pushBack(value);
+		fElements.push_back(value);
+	}
+
+	void push(T&& value) {
+		if (isFull()) {
+			throw std::overflow_error("Stack overflow: cannot push to a full stack.");
+		}
+		fElements.push_back(std::move(value));
+	}
+
+	// Construct a new top element in place
+	template <class... Args>
+	T& emplace(Args&&... args) {
+		if (isFull()) {
+			throw std::overflow_error("Stack overflow: cannot push to a full stack.");
+		}
+		fElements.emplace_back(std::forward<Args>(args)...);
+		return fElements.back();
 	}
 
 	T pop() {
 		if (isEmpty()) {
 			throw std::underflow_error("Stack underflow: cannot pop from an empty stack.");
 		}
-		// Get the last element using iterator
-		auto it = fElements.begin();
-		T value;
-		int currentIndex = 0;
-		int lastIndex = size() - 1;
-		
-		// Iterate to the last element
-		while (currentIndex < lastIndex) {
-			++it;
-			++currentIndex;
-		}
-		value = *it;
-		
-		// Remove the last element
-		fElements.popBack();
+		T value = std::move(fElements.back());
+		fElements.pop_back();
 		return value;
 	}
+
+	const T& top() const {
+		if (isEmpty()) {
+			throw std::underflow_error("Stack underflow: cannot read the top of an empty stack.");
+		}
+		return fElements.back();
+	}
+
+	// Read an element without popping (depth 0 is the top)
+	const T& peek(int depth) const {
+		if (depth < 0 || depth >= size()) {
+			throw std::out_of_range("Stack peek depth out of range.");
+		}
+		return fElements[fElements.size() - 1 - depth];
+	}
+
+	void clear() {
+		fElements.clear();
+	}
 };
 
-#endif /* STACK_H */
\ No newline at end of file
+#endif /* STACK_H */
@@ -0,0 +1,108 @@
+#include "Symbol.h"
+#include "HashTable.h"
+#include <atomic>
+#include <mutex>
+#include <ostream>
+
+namespace {
+
+const std::uint32_t CHUNK_BITS = 12;
+const std::uint32_t CHUNK_SIZE = 1u << CHUNK_BITS;
+const std::uint32_t MAX_CHUNKS = 4096; // 16M distinct strings
+
+// Strings live in fixed-size chunks that never move once allocated, so a reader can follow an
+// index to its text while another thread interns more
+struct SymbolTable {
+	std::mutex lock; // Held to intern; reads go straight to the chunks
+	HashTable<std::string, std::uint32_t> indices;
+	std::atomic<std::string*> chunks[MAX_CHUNKS];
+	std::uint32_t count;
+
+	SymbolTable() : indices(1024), count(0) {
+		for (std::atomic<std::string*>& chunk : chunks) {
+			chunk.store(nullptr, std::memory_order_relaxed);
+		}
+		add(std::string_view()); // Index 0
+	}
+
+	std::uint32_t add(std::string_view aText) {
+		std::uint32_t index = count;
+		std::string* chunk = chunks[index >> CHUNK_BITS].load(std::memory_order_relaxed);
+		if (chunk == nullptr) {
+			chunk = new std::string[CHUNK_SIZE];
+			chunks[index >> CHUNK_BITS].store(chunk, std::memory_order_release);
+		}
+		chunk[index & (CHUNK_SIZE - 1)] = std::string(aText);
+		indices.insert(std::string(aText), index);
+		count++;
+		return index;
+	}
+};
+
+// Never destroyed: objects torn down at exit may still hold symbols and read them
+SymbolTable& getTable() {
+	static SymbolTable* table = new SymbolTable();
+	return *table;
+}
+
+const std::string& getNoText() {
+	static const std::string* text = new std::string();
+	return *text;
+}
+
+}
+
+// Constructor
+Symbol::Symbol() : fIndex(0) {
+}
+
+// Parameterised constructor
+Symbol::Symbol(std::string_view aText) : fIndex(0) {
+	if (aText.empty()) {
+		return;
+	}
+	SymbolTable& table = getTable();
+	std::lock_guard<std::mutex> guard(table.lock);
+	std::uint32_t* index = table.indices.search(aText);
+	if (index != nullptr) {
+		fIndex = *index;
+	}
+	else if (table.count < MAX_CHUNKS * CHUNK_SIZE) {
+		fIndex = table.add(aText);
+	}
+	else {
+		fIndex = NONE; // Table full: equal to nothing, rather than to some other string
+	}
+}
+
+Symbol Symbol::find(std::string_view aText) {
+	Symbol symbol;
+	if (aText.empty()) {
+		return symbol;
+	}
+	SymbolTable& table = getTable();
+	std::lock_guard<std::mutex> guard(table.lock);
+	std::uint32_t* index = table.indices.search(aText);
+	symbol.fIndex = index != nullptr ? *index : NONE;
+	return symbol;
+}
+
+const std::string& Symbol::str() const {
+	if (fIndex == NONE) {
+		return getNoText();
+	}
+	std::string* chunk = getTable().chunks[fIndex >> CHUNK_BITS].load(std::memory_order_acquire);
+	return chunk[fIndex & (CHUNK_SIZE - 1)];
+}
+
+std::uint32_t Symbol::getIndex() const {
+	return fIndex;
+}
+
+bool Symbol::isEmpty() const {
+	return fIndex == 0 || fIndex == NONE;
+}
+
+std::ostream& operator<<(std::ostream& aOut, Symbol aSymbol) {
+	return aOut << aSymbol.str();
+}
@@ -0,0 +1,49 @@
+#ifndef SYMBOL_H
+#define SYMBOL_H
+#include "KeyHash.h"
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <string_view>
+
+// Interned string: a 32-bit handle into one process-wide table of distinct strings, so two symbols
+// are equal exactly when their handles are, and comparing or hashing one never reads characters.
+// Item, location, skill and crafting IDs and names are held as symbols; str() gives the text back
+// for display and saving. Entries live until the process ends, so intern only names the content
+// defines (and the item IDs saves refer back to it with). Text a player typed stays a string, as
+// Player's name does; look typed input up with find(), which adds nothing.
+// Interning takes a lock. str() and comparisons do not, and are safe from any thread.
+class Symbol {
+private:
+	std::uint32_t fIndex; // Into the table; 0 is the empty string
+
+	static const std::uint32_t NONE = 0xFFFFFFFFu; // What find() returns for text never interned
+
+public:
+	// Constructor (the empty string)
+	Symbol();
+
+	// Parameterised constructor: the symbol for aText, interning it if it is new
+	explicit Symbol(std::string_view aText);
+
+	// The symbol for aText if it has been interned; otherwise one equal to no interned symbol
+	static Symbol find(std::string_view aText);
+
+	const std::string& str() const;
+	std::uint32_t getIndex() const;
+	bool isEmpty() const; // The empty string (or a failed find)
+
+	bool operator==(Symbol aOther) const { return fIndex == aOther.fIndex; }
+	bool operator!=(Symbol aOther) const { return fIndex != aOther.fIndex; }
+};
+
+std::ostream& operator<<(std::ostream& aOut, Symbol aSymbol);
+
+template <>
+struct KeyHash<Symbol> {
+	static unsigned int hash(Symbol key) {
+		return mixHash(key.getIndex());
+	}
+};
+
+#endif /* SYMBOL_H */
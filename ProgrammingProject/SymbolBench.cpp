@@ -0,0 +1,204 @@
+#include "ContentPack.h"
+#include "HashTable.h"
+#include "Random.h"
+#include "Symbol.h"
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Symbols against the strings they replaced, on the content pack's own location and item IDs and
+// names: comparing two (loot and connection checks), finding one in a short list (crafting
+// materials in an inventory), a table lookup (skills, music) and getting a symbol for text at
+// all. Times are nanoseconds per operation. Run from ProgrammingProject/ so Content/ resolves.
+
+namespace {
+
+struct Timer {
+	std::chrono::steady_clock::time_point start;
+
+	Timer() : start(std::chrono::steady_clock::now()) {
+	}
+
+	double nanosecondsPer(long long aCount) const {
+		return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / aCount;
+	}
+};
+
+// Every distinct ID and name the content gives locations and items, in content order
+std::vector<std::string> contentNames(const ContentPack& aContent) {
+	std::vector<std::string> names;
+	HashTable<std::string, int> seen;
+	auto add = [&](const std::string& aName) {
+		if (!aName.empty() && seen.search(aName) == nullptr) {
+			seen.insert(aName, 0);
+			names.push_back(aName);
+		}
+	};
+	for (int location = 0; location < aContent.getLocationCount(); ++location) {
+		add(aContent.getLocation(location).id);
+		add(aContent.getLocation(location).name);
+		for (const ContentPack::LootEntry& loot : aContent.getLoot(location)) {
+			add(loot.item.getID());
+			add(loot.item.getName());
+		}
+	}
+	return names;
+}
+
+void printRow(const char* aOperation, double aStringNs, double aSymbolNs) {
+	std::cout << "  " << std::left << std::setw(28) << aOperation << std::right << std::fixed << std::setprecision(1)
+		<< std::setw(10) << aStringNs << std::setw(10) << aSymbolNs << "\n";
+}
+
+void printUsage() {
+	std::cerr << "Usage: symbol_bench [options]\n"
+		<< "  --iterations N   Operations of each kind (default 10000000)\n"
+		<< "  --list N         Entries in the list searched, as an inventory (default 20)\n"
+		<< "  --seed N         Seed for which names are compared (default 1)\n";
+}
+
+bool parseInteger(const char* aText, long long& aValue) {
+	char* end = nullptr;
+	aValue = std::strtoll(aText, &end, 10);
+	return end != aText && *end == '\0';
+}
+
+}
+
+int main(int argc, char* argv[]) {
+	long long iterations = 10000000;
+	long long listSize = 20;
+	long long seed = 1;
+
+	for (int i = 1; i < argc; ++i) {
+		std::string option = argv[i];
+		bool valid = true;
+
+		if (option == "--help" || option == "-h") {
+			printUsage();
+			return 0;
+		}
+		else if (option == "--iterations") {
+			valid = i + 1 < argc && parseInteger(argv[++i], iterations) && iterations > 0;
+		}
+		else if (option == "--list") {
+			valid = i + 1 < argc && parseInteger(argv[++i], listSize) && listSize > 0 && listSize <= 1000;
+		}
+		else if (option == "--seed") {
+			valid = i + 1 < argc && parseInteger(argv[++i], seed);
+		}
+		else {
+			valid = false;
+		}
+
+		if (!valid) {
+			std::cerr << "Invalid option: " << option << "\n";
+			printUsage();
+			return 1;
+		}
+	}
+
+	ContentPack content;
+	if (!content.load()) {
+		std::cerr << "Failed to load content: " << content.getLastError() << "\n";
+		return 1;
+	}
+	std::vector<std::string> names = contentNames(content);
+	std::vector<Symbol> symbols;
+	for (const std::string& name : names) {
+		symbols.push_back(Symbol(name));
+	}
+
+	// Which names each operation works on, drawn once so both sides see the same ones
+	Random random(static_cast<std::uint64_t>(seed));
+	const int PICKS = 4096;
+	std::vector<int> picks;
+	for (int i = 0; i < PICKS; ++i) {
+		picks.push_back(random.nextInt(static_cast<int>(names.size())));
+	}
+	std::vector<std::string> list;
+	std::vector<Symbol> symbolList;
+	for (long long i = 0; i < listSize; ++i) {
+		int pick = random.nextInt(static_cast<int>(names.size()));
+		list.push_back(names[pick]);
+		symbolList.push_back(symbols[pick]);
+	}
+	HashTable<std::string, int> stringTable;
+	HashTable<Symbol, int> symbolTable;
+	for (std::size_t i = 0; i < names.size(); ++i) {
+		stringTable.insert(names[i], static_cast<int>(i));
+		symbolTable.insert(symbols[i], static_cast<int>(i));
+	}
+
+	std::cout << names.size() << " distinct location and item IDs and names, " << iterations << " operations each\n";
+	std::cout << "  " << std::left << std::setw(28) << "operation (ns)" << std::right << std::setw(10) << "string"
+		<< std::setw(10) << "symbol\n";
+	long long checksum = 0;
+
+	Timer stringEqual;
+	for (long long i = 0; i < iterations; ++i) {
+		checksum += names[picks[i % PICKS]] == names[picks[(i + 1) % PICKS]] ? 1 : 0;
+	}
+	double stringEqualNs = stringEqual.nanosecondsPer(iterations);
+	Timer symbolEqual;
+	for (long long i = 0; i < iterations; ++i) {
+		checksum += symbols[picks[i % PICKS]] == symbols[picks[(i + 1) % PICKS]] ? 1 : 0;
+	}
+	printRow("compare two", stringEqualNs, symbolEqual.nanosecondsPer(iterations));
+
+	long long searches = iterations / listSize + 1;
+	Timer stringFind;
+	for (long long i = 0; i < searches; ++i) {
+		const std::string& wanted = names[picks[i % PICKS]];
+		for (const std::string& entry : list) {
+			if (entry == wanted) {
+				checksum++;
+				break;
+			}
+		}
+	}
+	double stringFindNs = stringFind.nanosecondsPer(searches);
+	Timer symbolFind;
+	for (long long i = 0; i < searches; ++i) {
+		Symbol wanted = symbols[picks[i % PICKS]];
+		for (Symbol entry : symbolList) {
+			if (entry == wanted) {
+				checksum++;
+				break;
+			}
+		}
+	}
+	std::string findName = "find in a list of " + std::to_string(listSize);
+	printRow(findName.c_str(), stringFindNs, symbolFind.nanosecondsPer(searches));
+
+	Timer stringLookup;
+	for (long long i = 0; i < iterations; ++i) {
+		checksum += *stringTable.search(names[picks[i % PICKS]]);
+	}
+	double stringLookupNs = stringLookup.nanosecondsPer(iterations);
+	Timer symbolLookup;
+	for (long long i = 0; i < iterations; ++i) {
+		checksum += *symbolTable.search(symbols[picks[i % PICKS]]);
+	}
+	printRow("table lookup", stringLookupNs, symbolLookup.nanosecondsPer(iterations));
+
+	// What each side pays to have its key at all: a copy of the text, or the intern table's lookup
+	Timer stringCopy;
+	for (long long i = 0; i < iterations; ++i) {
+		std::string copy = names[picks[i % PICKS]];
+		checksum += static_cast<long long>(copy.size());
+	}
+	double stringCopyNs = stringCopy.nanosecondsPer(iterations);
+	Timer symbolIntern;
+	for (long long i = 0; i < iterations; ++i) {
+		checksum += Symbol(names[picks[i % PICKS]]).getIndex();
+	}
+	printRow("copy / intern known text", stringCopyNs, symbolIntern.nanosecondsPer(iterations));
+
+	std::cout << "(checksum " << checksum << ")\n";
+	return 0;
+}
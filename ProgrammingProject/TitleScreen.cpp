@@ -1,18 +1,10 @@
 #include "TitleScreen.h"
+#include "Platform.h"
 #include <iostream>
 #include <cstdlib>
-#include <Windows.h>
 #include <iomanip>
-#include <thread>
-#include <chrono>
 #include <vector>
 
-#ifdef _WIN32
-#define CLEAR_SCREEN "cls"
-#else
-#define CLEAR_SCREEN "clear"
-#endif
-
 TitleScreen::TitleScreen(const std::string& title)
     : gameTitle(title), selectedIndex(0), lastRenderedIndex(-1), isRunning(false)
 {
@@ -23,7 +15,7 @@ TitleScreen::~TitleScreen() {
 }
 
 void TitleScreen::clearScreen() {
-    system(CLEAR_SCREEN);
+    Platform::clearScreen();
 }
 
 void TitleScreen::centerText(const std::string& text) {
@@ -89,18 +81,18 @@ void TitleScreen::drawTitle() {
 		centerText(line);
 		std::cout << "\n";
 		std::cout.flush();
-		std::this_thread::sleep_for(std::chrono::milliseconds(20));
+		Platform::sleepFor(20);
 	}
 
 	std::cout << "\n";
 	std::cout.flush();
-	std::this_thread::sleep_for(std::chrono::milliseconds(100));
+	Platform::sleepFor(100);
 
 	// Render top separator line
 	centerText("=======================");
 	std::cout << "\n";
 	std::cout.flush();
-	std::this_thread::sleep_for(std::chrono::milliseconds(80));
+	Platform::sleepFor(80);
 
 	// Type out the title character by character
 	std::string titleLine = "|   O U T B R E A K   |";
@@ -114,18 +106,18 @@ void TitleScreen::drawTitle() {
 		displayedText += titleLine[i];
 		std::cout << "\r" << padding << displayedText;
 		std::cout.flush();
-		std::this_thread::sleep_for(std::chrono::milliseconds(60));
+		Platform::sleepFor(60);
 	}
 
 	std::cout << "\n";
 	std::cout.flush();
-	std::this_thread::sleep_for(std::chrono::milliseconds(80));
+	Platform::sleepFor(80);
 
 	// Render bottom separator line
 	centerText("=======================");
 	std::cout << "\n";
 	std::cout.flush();
-	std::this_thread::sleep_for(std::chrono::milliseconds(100));
+	Platform::sleepFor(100);
 
 	std::cout << "\n";
 	std::cout.flush();
@@ -135,13 +127,11 @@ void TitleScreen::drawAtmosphere() {
 }
 
 void TitleScreen::drawMenuOptions() {
-    HANDLE h = GetStdHandle(STD_OUTPUT_HANDLE);
     const int firstMenuRow = 38;
     const int rowSpacing = 2;  // CHANGED from 1 to 2 to match actual spacing
 
     for (size_t i = 0; i < menuOptions.size(); ++i) {
-        COORD pos = { 0, (SHORT)(firstMenuRow + i * rowSpacing) };
-        SetConsoleCursorPosition(h, pos);
+        Platform::setCursorPosition(0, firstMenuRow + (int)i * rowSpacing);
         if (i == selectedIndex)
             centerText("[>>] " + menuOptions[i] + " [<<]");
         else
@@ -162,20 +152,18 @@ void TitleScreen::renderMenu() {
 	drawAtmosphere();
 	
 	// Render menu options with staggered appearance
-	HANDLE h = GetStdHandle(STD_OUTPUT_HANDLE);
 	const int firstMenuRow = 38;
 	const int rowSpacing = 2;
 
 	for (size_t i = 0; i < menuOptions.size(); ++i) {
-		COORD pos = { 0, (SHORT)(firstMenuRow + i * rowSpacing) };
-		SetConsoleCursorPosition(h, pos);
+		Platform::setCursorPosition(0, firstMenuRow + (int)i * rowSpacing);
 		if (i == selectedIndex)
 			centerText("[>>] " + menuOptions[i] + " [<<]");
 		else
 			centerText("[ ] " + menuOptions[i]);
 		std::cout << "\n";
 		std::cout.flush();
-		std::this_thread::sleep_for(std::chrono::milliseconds(150));
+		Platform::sleepFor(150);
 	}
 
 	drawFooter();
@@ -183,46 +171,42 @@ void TitleScreen::renderMenu() {
 }
 
 void TitleScreen::updateMenuSelection() {
-#ifdef _WIN32
     if (lastRenderedIndex == selectedIndex)
         return; // nothing to do
 
-    HANDLE h = GetStdHandle(STD_OUTPUT_HANDLE);
     const int firstMenuRow = 38;
     const int rowSpacing = 2;
 
     // Clear old selection
     if (lastRenderedIndex >= 0) {
-        COORD oldPos = { 0, (SHORT)(firstMenuRow + lastRenderedIndex * rowSpacing) };
-        SetConsoleCursorPosition(h, oldPos);
+        int oldRow = firstMenuRow + lastRenderedIndex * rowSpacing;
+        Platform::setCursorPosition(0, oldRow);
         std::string clearLine(GameEngine::CONSOLE_WIDTH, ' ');
         std::cout << clearLine;
-        SetConsoleCursorPosition(h, oldPos);
+        Platform::setCursorPosition(0, oldRow);
         centerText("[ ] " + menuOptions[lastRenderedIndex]);
     }
 
     // Draw new selection
-    COORD newPos = { 0, (SHORT)(firstMenuRow + selectedIndex * rowSpacing) };
-    SetConsoleCursorPosition(h, newPos);
+    int newRow = firstMenuRow + selectedIndex * rowSpacing;
+    Platform::setCursorPosition(0, newRow);
     std::string clearLine(GameEngine::CONSOLE_WIDTH, ' ');
     std::cout << clearLine;
-    SetConsoleCursorPosition(h, newPos);
+    Platform::setCursorPosition(0, newRow);
     centerText("[>>] " + menuOptions[selectedIndex] + " [<<]");
 
     std::cout.flush();
     lastRenderedIndex = selectedIndex;
-#endif
 }
 
 void TitleScreen::handleInput() {
-#ifdef _WIN32
     static bool upPressedLast = false;
     static bool downPressedLast = false;
     static bool enterPressedLast = false;
 
-    bool upPressed = (GetAsyncKeyState(VK_UP) & 0x8000) != 0;
-    bool downPressed = (GetAsyncKeyState(VK_DOWN) & 0x8000) != 0;
-    bool enterPressed = (GetAsyncKeyState(VK_RETURN) & 0x8000) != 0;
+    bool upPressed = Platform::isKeyDown(Platform::Key::UP);
+    bool downPressed = Platform::isKeyDown(Platform::Key::DOWN);
+    bool enterPressed = Platform::isKeyDown(Platform::Key::ENTER);
 
     if (upPressed && !upPressedLast) {
         if (selectedIndex > 0) {
@@ -244,8 +228,23 @@ void TitleScreen::handleInput() {
     downPressedLast = downPressed;
     enterPressedLast = enterPressed;
 
-    std::this_thread::sleep_for(std::chrono::milliseconds(50));
-#endif
+    Platform::sleepFor(50);
+}
+
+// Line-based selection for platforms without key polling.
+// End of input picks the last option (Exit) so a closed stdin cannot spin the menu forever.
+int TitleScreen::readSelectionLine() {
+    while (true) {
+        std::cout << "\n  Select option (1-" << menuOptions.size() << "): ";
+        std::string line;
+        if (!std::getline(std::cin, line)) {
+            return (int)menuOptions.size() - 1;
+        }
+        int choice = std::atoi(line.c_str());
+        if (choice >= 1 && choice <= (int)menuOptions.size()) {
+            return choice - 1;
+        }
+    }
 }
 
 bool TitleScreen::initialize(const std::vector<std::string>& options) {
@@ -263,6 +262,11 @@ int TitleScreen::run() {
     isRunning = true;
     renderMenu();
 
+    if (!Platform::supportsKeyPolling()) {
+        selectedIndex = readSelectionLine();
+        isRunning = false;
+    }
+
     while (isRunning) {
         handleInput();
     }
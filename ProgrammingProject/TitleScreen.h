@@ -4,8 +4,6 @@
 #include <string>
 #include <vector>
 #include <iostream>
-#include <thread>
-#include <chrono>
 #include "GameEngine.h"
 
 class TitleScreen {
@@ -40,6 +38,7 @@ public:
 	void renderMenu();
 	void updateMenuSelection();
 	void handleInput();
+	int readSelectionLine();
 	bool initialize(const std::vector<std::string>& options);
 	int run();
 };
@@ -0,0 +1,125 @@
+#include "WorkStealingPool.h"
+
+namespace {
+
+// Which pool and worker the calling thread belongs to, so nested submits stay local
+thread_local const WorkStealingPool* tCurrentPool = nullptr;
+thread_local int tCurrentWorker = -1;
+
+}
+
+// Constructor
+WorkStealingPool::WorkStealingPool(int aWorkerCount)
+	: fWorkerCount(aWorkerCount), fQueues(nullptr), fQueued(0), fUnfinished(0), fSteals(0), fNextQueue(0),
+	fStopping(false) {
+	if (fWorkerCount <= 0) {
+		fWorkerCount = static_cast<int>(std::thread::hardware_concurrency());
+		if (fWorkerCount <= 0) fWorkerCount = 1;
+	}
+
+	fQueues = new Queue[fWorkerCount];
+	fThreads.reserve(fWorkerCount);
+	for (int i = 0; i < fWorkerCount; ++i) {
+		fThreads.emplace_back(&WorkStealingPool::workerLoop, this, i);
+	}
+}
+
+void WorkStealingPool::submit(Task aTask) {
+	int target;
+	if (tCurrentPool == this) {
+		target = tCurrentWorker;
+	}
+	else {
+		target = static_cast<int>(fNextQueue.fetch_add(1, std::memory_order_relaxed) % fWorkerCount);
+	}
+
+	fUnfinished.fetch_add(1);
+	{
+		std::lock_guard<std::mutex> guard(fQueues[target].lock);
+		fQueues[target].tasks.push_back(std::move(aTask));
+	}
+	fQueued.fetch_add(1);
+
+	// Taking the state lock orders this wake-up after a sleeping worker's predicate check
+	std::lock_guard<std::mutex> guard(fStateLock);
+	fWorkAvailable.notify_one();
+}
+
+// Newest task from our own deque, else the oldest from someone else's
+bool WorkStealingPool::take(int aWorker, Task& aTask) {
+	{
+		Queue& own = fQueues[aWorker];
+		std::lock_guard<std::mutex> guard(own.lock);
+		if (!own.tasks.empty()) {
+			aTask = std::move(own.tasks.back());
+			own.tasks.pop_back();
+			fQueued.fetch_sub(1);
+			return true;
+		}
+	}
+
+	for (int offset = 1; offset < fWorkerCount; ++offset) {
+		Queue& victim = fQueues[(aWorker + offset) % fWorkerCount];
+		std::lock_guard<std::mutex> guard(victim.lock);
+		if (!victim.tasks.empty()) {
+			aTask = std::move(victim.tasks.front());
+			victim.tasks.pop_front();
+			fQueued.fetch_sub(1);
+			fSteals.fetch_add(1, std::memory_order_relaxed);
+			return true;
+		}
+	}
+	return false;
+}
+
+void WorkStealingPool::workerLoop(int aWorker) {
+	tCurrentPool = this;
+	tCurrentWorker = aWorker;
+
+	while (true) {
+		Task task;
+		if (take(aWorker, task)) {
+			task(aWorker);
+			task = nullptr; // Release captures before reporting completion
+
+			if (fUnfinished.fetch_sub(1) == 1) {
+				std::lock_guard<std::mutex> guard(fStateLock);
+				fAllDone.notify_all();
+			}
+			continue;
+		}
+
+		std::unique_lock<std::mutex> guard(fStateLock);
+		fWorkAvailable.wait(guard, [this] { return fStopping || fQueued.load() > 0; });
+		if (fStopping && fQueued.load() == 0) {
+			return;
+		}
+	}
+}
+
+void WorkStealingPool::wait() {
+	std::unique_lock<std::mutex> guard(fStateLock);
+	fAllDone.wait(guard, [this] { return fUnfinished.load() == 0; });
+}
+
+int WorkStealingPool::getWorkerCount() const {
+	return fWorkerCount;
+}
+
+std::int64_t WorkStealingPool::getStealCount() const {
+	return fSteals.load(std::memory_order_relaxed);
+}
+
+// Destructor
+WorkStealingPool::~WorkStealingPool() {
+	{
+		std::lock_guard<std::mutex> guard(fStateLock);
+		fStopping = true;
+	}
+	fWorkAvailable.notify_all();
+
+	for (std::thread& thread : fThreads) {
+		thread.join();
+	}
+	delete[] fQueues;
+}
@@ -0,0 +1,63 @@
+#ifndef WORKSTEALINGPOOL_H
+#define WORKSTEALINGPOOL_H
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Fixed set of worker threads, each with its own task deque.
+// A worker runs its newest task first (LIFO, so recursively split work stays cache-warm) and,
+// once empty, steals the oldest task from another worker (the biggest remaining chunk).
+// Tasks submitted from inside a task go to the running worker's deque; others are dealt round-robin.
+class WorkStealingPool {
+public:
+	typedef std::function<void(int)> Task; // Called with the index of the worker running it
+
+private:
+	struct alignas(64) Queue {
+		std::mutex lock;
+		std::deque<Task> tasks;
+	};
+
+	int fWorkerCount;
+	Queue* fQueues;
+	std::vector<std::thread> fThreads;
+
+	std::atomic<std::int64_t> fQueued; // Submitted, not yet taken by a worker
+	std::atomic<std::int64_t> fUnfinished; // Submitted, not yet finished
+	std::atomic<std::int64_t> fSteals;
+	std::atomic<unsigned> fNextQueue;
+
+	std::mutex fStateLock;
+	std::condition_variable fWorkAvailable;
+	std::condition_variable fAllDone;
+	bool fStopping;
+
+	bool take(int aWorker, Task& aTask);
+	void workerLoop(int aWorker);
+
+public:
+	// Constructor (0 workers means one per hardware thread)
+	explicit WorkStealingPool(int aWorkerCount = 0);
+
+	WorkStealingPool(const WorkStealingPool&) = delete;
+	WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+	void submit(Task aTask);
+
+	// Block until every submitted task, including ones they submitted, has finished.
+	// Not to be called from inside a task.
+	void wait();
+
+	int getWorkerCount() const;
+	std::int64_t getStealCount() const;
+
+	// Destructor (finishes queued tasks, then joins the workers)
+	~WorkStealingPool();
+};
+
+#endif /* WORKSTEALINGPOOL_H */
@@ -53,7 +53,8 @@ public:
 	virtual bool hasSpecialAbility() const { return false; }
 	virtual int getSpecialAbilityChance() const { return 0; }
 	virtual std::string useSpecialAbility(class Player* target) { return ""; }
-	virtual void onDeath(class Player* target) {} // Triggered when zombie dies
+	virtual std::string onDeath(class Player* target) { return ""; } // Triggered when zombie dies; returns what happened, for the combat screen
+	virtual int getDeathDamage() const { return 0; } // Damage onDeath deals to the player
 	virtual bool canUseSpecialAbility() const { return hasSpecialAbility(); }
 	virtual std::string getSpecialAbilityName() const { return "None"; }
 
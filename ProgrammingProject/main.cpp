@@ -1,19 +1,52 @@
 #include <iostream>
 #include <string>
-#include <thread>
-#include <chrono>
 #include "GameEngine.h"
+#include "GameSession.h"
 #include "AudioEngine.h"
-#include "GameplayEngine.h"
 #include "TitleScreen.h"
+#include "Platform.h"
+#include "Random.h"
+#include "ReplayLog.h"
+#include "SaveWriter.h"
 
-int main() {
-	// Initialize singletons
-	GameEngine* engine = GameEngine::getInstance();
+int main(int argc, char* argv[]) {
+	// --record FILE keeps an input log of each new game for the replay tool (the last one wins);
+	// --background-saves writes save slots on a separate thread; --compress-saves writes them compressed
+	std::string recordPath;
+	bool backgroundSaves = false;
+	bool compressSaves = false;
+	for (int i = 1; i < argc; ++i) {
+		std::string option = argv[i];
+		if (option == "--record" && i + 1 < argc) {
+			recordPath = argv[++i];
+		}
+		else if (option == "--background-saves") {
+			backgroundSaves = true;
+		}
+		else if (option == "--compress-saves") {
+			compressSaves = true;
+		}
+		else {
+			std::cerr << "Usage: outbreak [--record FILE] [--background-saves] [--compress-saves]\n";
+			return 1;
+		}
+	}
+
+	// The console plays a single session on the process-wide audio device
 	AudioEngine* audio = AudioEngine::getInstance(); // Auto-plays background music
+	GameSession* session = GameSession::getDefault();
+	GameEngine* engine = &session->getGameEngine();
+	SaveWriter* saveWriter = backgroundSaves ? new SaveWriter() : nullptr;
+	engine->setSaveWriter(saveWriter);
+	engine->setCompressSaves(compressSaves);
 
 	// Setup game
-	engine->initialize();
+	if (!session->initialize()) {
+		delete saveWriter;
+		GameSession::destroyDefault();
+		AudioEngine::destroyInstance();
+		return 1;
+	}
 
 	// Main game loop - returns to title screen after each session
 	bool gameRunning = true;
@@ -28,7 +61,22 @@ int main() {
 
 		switch (choice) {
 		case 0: // New Game
-			engine->handleNewGame();
+			if (recordPath.empty()) {
+				session->playNewGame(RandomStreams::generateSeed());
+			}
+			else {
+				ReplayLog replay;
+				replay.setSeed(RandomStreams::generateSeed());
+				InputRecorder recorder(std::cin.rdbuf(), replay);
+				std::streambuf* console = std::cin.rdbuf(&recorder);
+				session->playNewGame(replay.getSeed());
+				std::cin.rdbuf(console);
+
+				replay.setStateHash(session->getStateHash());
+				if (!replay.save(recordPath)) {
+					std::cerr << "  [ERROR] Could not write " << recordPath << "\n";
+				}
+			}
 			// After game ends, loop will return to title screen with title music
 			break;
 
@@ -38,20 +86,20 @@ int main() {
 			break;
 
 		case 2: // Exit
-			system("cls");
+			Platform::clearScreen();
 			std::cout << "\n\n  Thanks for playing OUTBREAK.\n";
 			std::cout << "  Stay safe, survivor...\n\n";
-			std::this_thread::sleep_for(std::chrono::milliseconds(1500));
+			Platform::sleepFor(1500);
 			gameRunning = false;
 			break;
 		}
 	}
 
-	// Cleanup singletons
+	// Cleanup (queued saves are written before the writer goes)
+	delete saveWriter;
 	audio->stopBackgroundMusic();
+	GameSession::destroyDefault();
 	AudioEngine::destroyInstance();
-	GameplayEngine::destroyInstance();
-	GameEngine::destroyInstance();
 
 	return 0;
 }
\ No newline at end of file